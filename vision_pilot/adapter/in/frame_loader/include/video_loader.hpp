@@ -21,6 +21,9 @@ public:
     bool start();
     bool stop();
 
+    // 파일/프레임셋 소스를 끝까지 읽었으면 true (카메라/스트림은 stop() 전까지 false)
+    bool isFinished() const;
+
 private:
     std::unique_ptr<VideoLoaderImpl> impl_;
 };
@@ -21,4 +21,9 @@ bool VideoLoader::stop()
 {
     return impl_->stop();
 }
+
+bool VideoLoader::isFinished() const
+{
+    return impl_->isFinished();
+}
 } // namespace vp::adapter::in::frame_loader
\ No newline at end of file
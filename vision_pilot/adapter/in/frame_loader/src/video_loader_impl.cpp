@@ -3,6 +3,7 @@
 #include "gaia_log.hpp"
 #include "gaia_string_util.hpp"
 #include "gaia_time.hpp"
+#include "gaia_trace.hpp"
 #include <exception>
 #include <opencv2/core.hpp>
 #include <opencv2/imgcodecs.hpp>
@@ -14,6 +15,7 @@ namespace
 std::shared_ptr<vp::domain::model::ImagePacket> createImagePacketFromMat(const cv::Mat &frame, uint64_t frame_id)
 {
     auto frame_packet = std::make_shared<vp::domain::model::ImagePacket>();
+    frame_packet->trace.mark(vp::domain::model::TracePoint::CAPTURED);
 
     auto &mono_packet = frame_packet->payload.emplace<vp::domain::model::MonoImagePacket>();
 
@@ -24,12 +26,20 @@ std::shared_ptr<vp::domain::model::ImagePacket> createImagePacketFromMat(const c
     mono_packet.frame.data.assign(frame.data, frame.data + (frame.total() * frame.elemSize())); // NOLINT: OPENCV
 
     frame_packet->timestamp = vp::getTime64();
+    frame_packet->source_time = frame_packet->timestamp; // 실시간 소스는 읽은 시각. 파일/프레임셋은 호출 측에서 덮어씀
     frame_packet->encoding = (frame.channels() == 1) ? vp::domain::model::ImageEncoding::MONO8 : vp::domain::model::ImageEncoding::BGR8; // TODO: 추후 RGB8 등도 지원
     frame_packet->format = vp::domain::model::ImageFormat::MONO;
     frame_packet->frame_id = frame_id;
 
     return frame_packet;
 }
+
+// 파일/프레임셋 소스의 frame_id 번째 프레임 시각 (ms). fps 간격으로 계산하므로 실행마다 같음
+uint64_t frameTimeMs(uint64_t frame_id, uint32_t fps)
+{
+    const uint64_t index = frame_id > 0 ? frame_id - 1 : 0;
+    return fps > 0 ? index * 1000 / fps : index * 33;
+}
 } // namespace
 
 namespace vp::adapter::in::frame_loader
@@ -72,10 +82,16 @@ bool VideoLoaderImpl::start()
     }
 
     running_ = true;
+    finished_ = false;
     worker_thread_ = std::thread(&VideoLoaderImpl::loadFrames, this);
     return true;
 }
 
+bool VideoLoaderImpl::isFinished() const
+{
+    return finished_;
+}
+
 bool VideoLoaderImpl::stop()
 {
     LOG_TRA("");
@@ -91,6 +107,7 @@ bool VideoLoaderImpl::stop()
 void VideoLoaderImpl::loadFrames()
 {
     LOG_INF("Frame loading started.");
+    TRACE_THREAD_NAME("loader");
 
     switch (config_.sourceType)
     {
@@ -111,6 +128,7 @@ void VideoLoaderImpl::loadFrames()
         break;
     }
 
+    finished_ = true;
     LOG_INF("Frame loading stopped.");
 }
 
@@ -123,14 +141,25 @@ void VideoLoaderImpl::loadFramesFromVideoFile()
 
     while (running_)
     {
-        std::this_thread::sleep_for(std::chrono::milliseconds(sleep_ms));
-        if (!video_capture_->read(frame))
+        if (config_.paceToFps)
         {
-            continue;
+            std::this_thread::sleep_for(std::chrono::milliseconds(sleep_ms));
+        }
+        bool read_ok = false;
+        {
+            TRACE_SCOPE("loader.read");
+            read_ok = video_capture_->read(frame);
+        }
+        if (!read_ok)
+        {
+            LOG_INF("End of video file reached after {} frames.", frame_id_);
+            break;
         }
 
-        // 1. 데이터 패킷 생성
+        // 1. 데이터 패킷 생성 (영상 내 위치를 소스 시각으로 사용, 위치를 못 읽으면 fps 로 계산)
         auto frame_packet = ::createImagePacketFromMat(frame, ++frame_id_);
+        const double position_ms = video_capture_->get(cv::CAP_PROP_POS_MSEC);
+        frame_packet->source_time = position_ms > 0.0 ? static_cast<uint64_t>(position_ms + 0.5) : ::frameTimeMs(frame_id_, config_.fps);
 
         // 2. 이벤트를 생성하여 큐에 Push (std::variant 사용)
         domain::model::Event evt;
@@ -139,7 +168,11 @@ void VideoLoaderImpl::loadFramesFromVideoFile()
         evt.source = "VideoLoader";
         evt.data = frame_packet; // ImageEventPayload (shared_ptr)로 자동 변환됨
 
-        event_queue_.push(std::move(evt));
+        frame_packet->trace.mark(domain::model::TracePoint::ENQUEUED);
+        if (!event_queue_.push(std::move(evt)))
+        {
+            break; // 큐가 닫힘
+        }
     }
 }
 
@@ -151,7 +184,12 @@ void VideoLoaderImpl::loadFramesFromCameraDevice()
 
     while (running_)
     {
-        if (!video_capture_->read(frame))
+        bool read_ok = false;
+        {
+            TRACE_SCOPE("loader.read");
+            read_ok = video_capture_->read(frame);
+        }
+        if (!read_ok)
         {
             continue;
         }
@@ -164,7 +202,11 @@ void VideoLoaderImpl::loadFramesFromCameraDevice()
         evt.source = "VideoLoader";
         evt.data = frame_packet;
 
-        event_queue_.push(std::move(evt));
+        frame_packet->trace.mark(domain::model::TracePoint::ENQUEUED);
+        if (!event_queue_.push(std::move(evt)))
+        {
+            break; // 큐가 닫힘
+        }
     }
 }
 
@@ -176,7 +218,12 @@ void VideoLoaderImpl::loadFramesFromRtspStream()
 
     while (running_)
     {
-        if (!video_capture_->read(frame))
+        bool read_ok = false;
+        {
+            TRACE_SCOPE("loader.read");
+            read_ok = video_capture_->read(frame);
+        }
+        if (!read_ok)
         {
             continue;
         }
@@ -189,7 +236,11 @@ void VideoLoaderImpl::loadFramesFromRtspStream()
         evt.source = "VideoLoader";
         evt.data = frame_packet;
 
-        event_queue_.push(std::move(evt));
+        frame_packet->trace.mark(domain::model::TracePoint::ENQUEUED);
+        if (!event_queue_.push(std::move(evt)))
+        {
+            break; // 큐가 닫힘
+        }
     }
 }
 
@@ -208,9 +259,13 @@ void VideoLoaderImpl::loadFramesFromFrameSet()
             break;
         }
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(sleep_ms));
+        if (config_.paceToFps)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(sleep_ms));
+        }
 
         auto frame_packet = ::createImagePacketFromMat(frm, ++frame_id_);
+        frame_packet->source_time = ::frameTimeMs(frame_id_, config_.fps);
 
         domain::model::Event evt;
         evt.type = domain::model::EventType::IMAGE;
@@ -218,7 +273,11 @@ void VideoLoaderImpl::loadFramesFromFrameSet()
         evt.source = "VideoLoader";
         evt.data = frame_packet;
 
-        event_queue_.push(std::move(evt));
+        frame_packet->trace.mark(domain::model::TracePoint::ENQUEUED);
+        if (!event_queue_.push(std::move(evt)))
+        {
+            break; // 큐가 닫힘
+        }
     }
 }
 
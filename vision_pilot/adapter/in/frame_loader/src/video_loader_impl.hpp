@@ -18,6 +18,7 @@ public:
 
     bool start();
     bool stop();
+    bool isFinished() const;
 
 private:
     void loadFrames();
@@ -31,6 +32,7 @@ private:
 
     const config::VideoLoaderConfig &config_;
     std::atomic_bool running_ = false;
+    std::atomic_bool finished_ = false; // 소스 끝까지 읽었거나 큐가 닫혀 읽기 스레드 종료
     std::thread worker_thread_;
 
     infrastructure::event::EventQueue &event_queue_; // 포트 대신 큐 참조
@@ -0,0 +1,147 @@
+#include "inference_backend.hpp"
+#include "synthetic_yolo_model.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <opencv2/core.hpp>
+
+namespace vp::adapter::out
+{
+// 모델 파일이 필요하므로 VP_YOLO_MODEL 환경 변수로 경로 지정 (없으면 건너뜀)
+// Args: {backend (0 = OPENCV_DNN, 1 = ONNXRUNTIME), precision (0 = FP32, 1 = FP16, 2 = INT8)}
+// 양자화 모델은 같은 경로에 모델을 바꿔 실행하여 지연 시간을 비교
+class InferenceBackendBench : public benchmark::Fixture
+{
+public:
+    void SetUp(const ::benchmark::State &state) override
+    {
+        const char *model_path = std::getenv("VP_YOLO_MODEL");
+        if (model_path == nullptr)
+        {
+            return;
+        }
+
+        config::YoloConfig config;
+        config.backend = static_cast<config::InferenceBackendType>(state.range(0));
+        config.precision = static_cast<config::ModelPrecision>(state.range(1));
+        backend_ = createInferenceBackend(config);
+        if (backend_ == nullptr || !backend_->load(model_path))
+        {
+            backend_.reset();
+            return;
+        }
+
+        // 입력 형식은 모델을 따름 (값 범위는 추론 시간에 영향 없음)
+        const int sizes[] = {1, 3, config.inputHeight, config.inputWidth};
+        input_.create(4, sizes, backend_->inputSpec().depth);
+        input_.setTo(cv::Scalar::all(0.5));
+    }
+
+    void TearDown(const ::benchmark::State &) override
+    {
+        backend_.reset();
+    }
+
+protected:
+    std::unique_ptr<InferenceBackend> backend_;
+    cv::Mat input_;
+    cv::Mat output_;
+};
+
+BENCHMARK_DEFINE_F(InferenceBackendBench, Infer)
+(benchmark::State &state)
+{
+    if (!backend_)
+    {
+        state.SkipWithError("VP_YOLO_MODEL not set or backend unavailable");
+        return;
+    }
+
+    for (auto _ : state)
+    {
+        (void)_;
+        backend_->infer(input_, output_);
+        benchmark::DoNotOptimize(output_.data);
+    }
+}
+BENCHMARK_REGISTER_F(InferenceBackendBench, Infer)
+    ->Args({0, 0})
+    ->Args({0, 1})
+    ->Args({0, 2})
+    ->Args({1, 0})
+    ->Unit(benchmark::kMillisecond);
+
+// 모델 파일 없이 합성 모델로 입력 크기/스레드 수별 추론 시간 측정
+// Args: {backend (0 = OPENCV_DNN, 1 = ONNXRUNTIME), 입력 너비, 입력 높이, 스레드 수}
+class SyntheticBackendBench : public benchmark::Fixture
+{
+public:
+    void SetUp(const ::benchmark::State &state) override
+    {
+        const std::string &model_path = syntheticYoloModelPath();
+        if (model_path.empty())
+        {
+            return;
+        }
+
+        config::YoloConfig config;
+        config.backend = static_cast<config::InferenceBackendType>(state.range(0));
+        config.numThreads = static_cast<int>(state.range(3));
+        // OPENCV_DNN 스레드 수는 프로세스 전역이라 assembly 처럼 직접 설정 (-1: 기본값)
+        cv::setNumThreads(config.numThreads > 0 ? config.numThreads : -1);
+        backend_ = createInferenceBackend(config);
+        if (backend_ == nullptr || !backend_->load(model_path))
+        {
+            backend_.reset();
+            return;
+        }
+
+        const int sizes[] = {1, 3, static_cast<int>(state.range(2)), static_cast<int>(state.range(1))};
+        input_.create(4, sizes, backend_->inputSpec().depth);
+        input_.setTo(cv::Scalar::all(0.5));
+    }
+
+    void TearDown(const ::benchmark::State &) override
+    {
+        backend_.reset();
+    }
+
+protected:
+    std::unique_ptr<InferenceBackend> backend_;
+    cv::Mat input_;
+    cv::Mat output_;
+};
+
+BENCHMARK_DEFINE_F(SyntheticBackendBench, Infer)
+(benchmark::State &state)
+{
+    if (!backend_)
+    {
+        state.SkipWithError("synthetic model or backend unavailable");
+        return;
+    }
+
+    // 첫 추론은 그래프 초기화를 포함하므로 측정에서 제외
+    if (!backend_->infer(input_, output_))
+    {
+        state.SkipWithError("inference failed");
+        return;
+    }
+    for (auto _ : state)
+    {
+        (void)_;
+        backend_->infer(input_, output_);
+        benchmark::DoNotOptimize(output_.data);
+    }
+    state.counters["Anchors"] = static_cast<double>(output_.dims == 3 ? output_.size[2] : 0);
+}
+BENCHMARK_REGISTER_F(SyntheticBackendBench, Infer)
+    ->ArgsProduct({{0}, {320, 640}, {320, 640}, {1, 2, 4}})
+    ->Args({0, 640, 384, 1}) // 동적 입력 (16:9 프레임)
+    ->Args({0, 640, 384, 4})
+#ifdef VP_WITH_ONNXRUNTIME
+    ->ArgsProduct({{1}, {320, 640}, {320, 640}, {1, 2, 4}})
+    ->Args({1, 640, 384, 1})
+    ->Args({1, 640, 384, 4})
+#endif
+    ->Unit(benchmark::kMillisecond);
+} // namespace vp::adapter::out
@@ -0,0 +1,130 @@
+#include "instance_decoder.hpp"
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <random>
+
+namespace vp::adapter::out
+{
+// YOLOv8-seg 640x640: 프로토타입 [1, 32, 160, 160], 박스 range(0) 개
+class InstanceDecoderFixture : public benchmark::Fixture
+{
+public:
+    static constexpr int kInput = 640;
+    static constexpr int kProto = 160;
+    static constexpr int kMasks = 32;
+    static constexpr int kDims = 4 + 80 + kMasks;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        const int count = static_cast<int>(state.range(0));
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> pos(60.0f, 580.0f);
+        std::uniform_real_distribution<float> size(20.0f, 120.0f);
+
+        protos_.resize(static_cast<size_t>(kMasks) * kProto * kProto);
+        for (auto &v : protos_)
+        {
+            v = value(rng);
+        }
+        output_.assign(static_cast<size_t>(kDims) * count, 0.0f);
+        candidates_.clear();
+        for (int a = 0; a < count; ++a)
+        {
+            for (int m = 0; m < kMasks; ++m)
+            {
+                output_[static_cast<size_t>(kDims - kMasks + m) * count + a] = value(rng);
+            }
+            DetectionCandidate c;
+            c.cx = pos(rng);
+            c.cy = pos(rng);
+            c.w = size(rng);
+            c.h = size(rng);
+            c.anchor = a;
+            candidates_.push_back(c);
+        }
+        letterbox_.resized_w = kInput;
+        letterbox_.resized_h = kInput;
+    }
+
+    void TearDown(const ::benchmark::State &) override
+    {
+    }
+
+protected:
+    cv::Mat outputMat()
+    {
+        const int sizes[] = {1, kDims, static_cast<int>(candidates_.size())};
+        return cv::Mat(3, sizes, CV_32F, output_.data());
+    }
+
+    std::vector<float> protos_;
+    std::vector<float> output_;
+    std::vector<DetectionCandidate> candidates_;
+    LetterboxInfo letterbox_;
+};
+
+// 기존 방식: 박스마다 프로토타입 전체 해상도로 계수 x 프로토타입 + sigmoid 후 박스 밖을 지움
+BENCHMARK_DEFINE_F(InstanceDecoderFixture, fullResolutionSigmoid)
+(benchmark::State &state)
+{
+    const int count = static_cast<int>(candidates_.size());
+    std::vector<float> mask(static_cast<size_t>(kProto) * kProto);
+    std::vector<uint8_t> binary(mask.size());
+    for (auto _ : state)
+    {
+        (void)_;
+        for (const auto &c : candidates_)
+        {
+            std::fill(mask.begin(), mask.end(), 0.0f);
+            for (int m = 0; m < kMasks; ++m)
+            {
+                const float k = output_[static_cast<size_t>(kDims - kMasks + m) * count + c.anchor];
+                const float *plane = protos_.data() + static_cast<size_t>(m) * kProto * kProto;
+                for (size_t i = 0; i < mask.size(); ++i)
+                {
+                    mask[i] += k * plane[i];
+                }
+            }
+            const float s = static_cast<float>(kProto) / kInput;
+            for (int y = 0; y < kProto; ++y)
+            {
+                for (int x = 0; x < kProto; ++x)
+                {
+                    const bool inside = x >= (c.cx - 0.5f * c.w) * s && x < (c.cx + 0.5f * c.w) * s && y >= (c.cy - 0.5f * c.h) * s &&
+                                        y < (c.cy + 0.5f * c.h) * s;
+                    const float p = 1.0f / (1.0f + std::exp(-mask[y * kProto + x]));
+                    binary[y * kProto + x] = inside && p > 0.5f ? 255 : 0;
+                }
+            }
+            benchmark::DoNotOptimize(binary.data());
+        }
+    }
+}
+BENCHMARK_REGISTER_F(InstanceDecoderFixture, fullResolutionSigmoid)->Arg(1)->Arg(10)->Arg(50);
+
+// InstanceDecoder: 박스 영역만 행 단위 SIMD 누적 + logit 비교
+BENCHMARK_DEFINE_F(InstanceDecoderFixture, boxRegionLogit)
+(benchmark::State &state)
+{
+    InstanceLayout layout;
+    layout.task = config::YoloTask::SEGMENT;
+    layout.num_masks = kMasks;
+    InstanceDecoder decoder;
+    decoder.setLayout(layout);
+    const int sizes[] = {1, kMasks, kProto, kProto};
+    decoder.setPrototypes(cv::Mat(4, sizes, CV_32F, protos_.data()), 0);
+    const cv::Mat output = outputMat();
+    vp::domain::model::InstanceResult instance;
+    for (auto _ : state)
+    {
+        (void)_;
+        for (const auto &c : candidates_)
+        {
+            decoder.decode(output, {}, 0, c, letterbox_, cv::Size(kInput, kInput), instance);
+            benchmark::DoNotOptimize(instance.mask.data.data());
+        }
+    }
+}
+BENCHMARK_REGISTER_F(InstanceDecoderFixture, boxRegionLogit)->Arg(1)->Arg(10)->Arg(50);
+} // namespace vp::adapter::out
@@ -0,0 +1,157 @@
+#include "nms_engine.hpp"
+#include <benchmark/benchmark.h>
+#include <opencv2/dnn.hpp>
+#include <random>
+
+namespace vp::adapter::out
+{
+// 혼잡한 도심 장면을 흉내: 객체마다 주변에 겹치는 후보가 여러 개 생성됨
+class NmsEngineFixture : public benchmark::Fixture
+{
+public:
+    void SetUp(const ::benchmark::State &state) override
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> pos(0.0f, 600.0f);
+        std::uniform_real_distribution<float> size(20.0f, 120.0f);
+        std::uniform_real_distribution<float> jitter(-8.0f, 8.0f);
+        std::uniform_real_distribution<float> score(0.25f, 1.0f);
+        std::uniform_int_distribution<int> cls(0, 7);
+
+        candidates_.clear();
+        while (candidates_.size() < count)
+        {
+            const float cx = pos(rng);
+            const float cy = pos(rng);
+            const float w = size(rng);
+            const float h = size(rng);
+            const int class_id = cls(rng);
+            for (int k = 0; k < 8 && candidates_.size() < count; ++k)
+            {
+                candidates_.push_back({cx + jitter(rng), cy + jitter(rng), w + jitter(rng), h + jitter(rng), score(rng), class_id});
+            }
+        }
+
+        boxes_.clear();
+        scores_.clear();
+        class_ids_.clear();
+        for (const auto &c : candidates_)
+        {
+            boxes_.emplace_back(c.cx - 0.5f * c.w, c.cy - 0.5f * c.h, c.w, c.h);
+            scores_.push_back(c.score);
+            class_ids_.push_back(c.class_id);
+        }
+    }
+
+    void TearDown(const ::benchmark::State &) override
+    {
+    }
+
+protected:
+    std::vector<DetectionCandidate> candidates_;
+    std::vector<cv::Rect2d> boxes_;
+    std::vector<float> scores_;
+    std::vector<int> class_ids_;
+};
+
+BENCHMARK_DEFINE_F(NmsEngineFixture, engineAgnostic)
+(benchmark::State &state)
+{
+    NmsEngine engine;
+    NmsOptions options;
+    options.per_class = false;
+    std::vector<int> keep;
+    for (auto _ : state)
+    {
+        (void)_;
+        auto input = candidates_;
+        engine.run(input, options, keep);
+        benchmark::DoNotOptimize(keep.data());
+    }
+    state.counters["Kept"] = static_cast<double>(keep.size());
+}
+BENCHMARK_REGISTER_F(NmsEngineFixture, engineAgnostic)->RangeMultiplier(4)->Range(64, 4096);
+
+BENCHMARK_DEFINE_F(NmsEngineFixture, engineAgnosticTopK)
+(benchmark::State &state)
+{
+    NmsEngine engine;
+    NmsOptions options;
+    options.per_class = false;
+    options.top_k = 1000;
+    std::vector<int> keep;
+    for (auto _ : state)
+    {
+        (void)_;
+        auto input = candidates_;
+        engine.run(input, options, keep);
+        benchmark::DoNotOptimize(keep.data());
+    }
+    state.counters["Kept"] = static_cast<double>(keep.size());
+}
+BENCHMARK_REGISTER_F(NmsEngineFixture, engineAgnosticTopK)->RangeMultiplier(4)->Range(64, 4096);
+
+BENCHMARK_DEFINE_F(NmsEngineFixture, opencvAgnostic)
+(benchmark::State &state)
+{
+    std::vector<int> keep;
+    for (auto _ : state)
+    {
+        (void)_;
+        cv::dnn::NMSBoxes(boxes_, scores_, 0.25f, 0.45f, keep);
+        benchmark::DoNotOptimize(keep.data());
+    }
+    state.counters["Kept"] = static_cast<double>(keep.size());
+}
+BENCHMARK_REGISTER_F(NmsEngineFixture, opencvAgnostic)->RangeMultiplier(4)->Range(64, 4096);
+
+BENCHMARK_DEFINE_F(NmsEngineFixture, enginePerClass)
+(benchmark::State &state)
+{
+    NmsEngine engine;
+    NmsOptions options;
+    std::vector<int> keep;
+    for (auto _ : state)
+    {
+        (void)_;
+        auto input = candidates_;
+        engine.run(input, options, keep);
+        benchmark::DoNotOptimize(keep.data());
+    }
+    state.counters["Kept"] = static_cast<double>(keep.size());
+}
+BENCHMARK_REGISTER_F(NmsEngineFixture, enginePerClass)->RangeMultiplier(4)->Range(64, 4096);
+
+BENCHMARK_DEFINE_F(NmsEngineFixture, opencvPerClass)
+(benchmark::State &state)
+{
+    std::vector<int> keep;
+    for (auto _ : state)
+    {
+        (void)_;
+        cv::dnn::NMSBoxesBatched(boxes_, scores_, class_ids_, 0.25f, 0.45f, keep);
+        benchmark::DoNotOptimize(keep.data());
+    }
+    state.counters["Kept"] = static_cast<double>(keep.size());
+}
+BENCHMARK_REGISTER_F(NmsEngineFixture, opencvPerClass)->RangeMultiplier(4)->Range(64, 4096);
+
+BENCHMARK_DEFINE_F(NmsEngineFixture, engineSoftGaussian)
+(benchmark::State &state)
+{
+    NmsEngine engine;
+    NmsOptions options;
+    options.method = config::NmsMethod::SOFT_GAUSSIAN;
+    std::vector<int> keep;
+    for (auto _ : state)
+    {
+        (void)_;
+        auto input = candidates_;
+        engine.run(input, options, keep);
+        benchmark::DoNotOptimize(keep.data());
+    }
+    state.counters["Kept"] = static_cast<double>(keep.size());
+}
+BENCHMARK_REGISTER_F(NmsEngineFixture, engineSoftGaussian)->RangeMultiplier(4)->Range(64, 4096);
+} // namespace vp::adapter::out
@@ -0,0 +1,81 @@
+#include "synthetic_yolo_model.hpp"
+#include "yolov8_adapter.hpp"
+#include <benchmark/benchmark.h>
+#include <opencv2/core.hpp>
+
+namespace vp::adapter::out
+{
+// Args: {pipelineOverlap (0/1), 스레드 수}. 1920x1080 프레임을 640 타일 (+ 전체 프레임) 로 나눠 한 장씩 추론
+// 한 호출에 배치가 여러 개 생기므로 전처리/추론/후처리 겹침 효과를 호출 단위 처리량으로 비교
+class PipelineBench : public benchmark::Fixture
+{
+public:
+    void SetUp(const ::benchmark::State &state) override
+    {
+        const std::string &model_path = syntheticYoloModelPath();
+        if (model_path.empty())
+        {
+            return;
+        }
+
+        config_ = config::YoloConfig();
+        config_.modelPath = model_path;
+        config_.inputWidth = 320;
+        config_.inputHeight = 320;
+        config_.maxBatchSize = 1;
+        config_.warmupRuns = 1;
+        config_.tiling.enable = true;
+        config_.pipelineOverlap = state.range(0) != 0;
+        config_.numThreads = static_cast<int>(state.range(1));
+        cv::setNumThreads(config_.numThreads > 0 ? config_.numThreads : -1);
+        adapter_ = std::make_unique<YOLOv8Adapter>(config_);
+        if (!adapter_->initialize())
+        {
+            adapter_.reset();
+            return;
+        }
+
+        vp::domain::model::MonoImagePacket payload;
+        payload.frame.width = 1920;
+        payload.frame.height = 1080;
+        payload.frame.channels = 3;
+        payload.frame.step = 1920 * 3;
+        payload.frame.data.resize(static_cast<size_t>(payload.frame.step) * payload.frame.height);
+        cv::Mat frame(1080, 1920, CV_8UC3, payload.frame.data.data());
+        cv::randu(frame, cv::Scalar::all(0), cv::Scalar::all(255));
+        packet_.encoding = vp::domain::model::ImageEncoding::BGR8;
+        packet_.payload = std::move(payload);
+    }
+
+    void TearDown(const ::benchmark::State &) override
+    {
+        adapter_.reset();
+    }
+
+protected:
+    config::YoloConfig config_; // adapter_ 가 참조하므로 adapter_ 보다 오래 유지
+    std::unique_ptr<YOLOv8Adapter> adapter_;
+    vp::domain::model::ImagePacket packet_;
+};
+
+BENCHMARK_DEFINE_F(PipelineBench, DetectTiled)
+(benchmark::State &state)
+{
+    if (!adapter_)
+    {
+        state.SkipWithError("synthetic model or backend unavailable");
+        return;
+    }
+
+    for (auto _ : state)
+    {
+        (void)_;
+        auto detections = adapter_->detectObject(packet_);
+        benchmark::DoNotOptimize(detections.data());
+    }
+}
+BENCHMARK_REGISTER_F(PipelineBench, DetectTiled)
+    ->ArgsProduct({{0, 1}, {1, 4}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+} // namespace vp::adapter::out
@@ -0,0 +1,192 @@
+#include "letterbox_preprocessor.hpp"
+#include "yolov8_decoder.hpp"
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <opencv2/core.hpp>
+#include <random>
+
+namespace vp::adapter::out
+{
+namespace
+{
+// Arg: 0 = FP32, 1 = FP16, 2 = UINT8 (per-tensor scale), 3 = INT8 (zero_point -128)
+TensorSpec makeSpec(int64_t arg, float max_value)
+{
+    switch (arg)
+    {
+    case 1:
+        return {CV_16F};
+    case 2:
+        return {CV_8U, max_value / 255.0f, 0};
+    case 3:
+        return {CV_8S, max_value / 255.0f, -128};
+    default:
+        return {CV_32F};
+    }
+}
+
+float dequantize(const cv::Mat &tensor, const TensorSpec &spec, size_t index)
+{
+    switch (tensor.depth())
+    {
+    case CV_16F:
+        return static_cast<float>(tensor.ptr<cv::float16_t>()[index]);
+    case CV_8U:
+        return static_cast<float>(tensor.ptr<uchar>()[index] - spec.zero_point) * spec.scale;
+    case CV_8S:
+        return static_cast<float>(tensor.ptr<schar>()[index] - spec.zero_point) * spec.scale;
+    default:
+        return tensor.ptr<float>()[index];
+    }
+}
+
+void convertTensor(const std::vector<float> &src, const TensorSpec &spec, cv::Mat &dst)
+{
+    for (size_t i = 0; i < src.size(); ++i)
+    {
+        switch (spec.depth)
+        {
+        case CV_16F:
+            dst.ptr<cv::float16_t>()[i] = cv::float16_t(src[i]);
+            break;
+        case CV_8U:
+            dst.ptr<uchar>()[i] = cv::saturate_cast<uchar>(src[i] / spec.scale + spec.zero_point);
+            break;
+        case CV_8S:
+            dst.ptr<schar>()[i] = cv::saturate_cast<schar>(src[i] / spec.scale + spec.zero_point);
+            break;
+        default:
+            dst.ptr<float>()[i] = src[i];
+            break;
+        }
+    }
+}
+} // namespace
+
+// 출력 텐서 형식별 디코딩 시간과 양자화 오차 (합성 [1, 84, 8400] 출력)
+class TensorPrecisionFixture : public benchmark::Fixture
+{
+public:
+    static constexpr int kClasses = 80;
+    static constexpr int kDims = 4 + kClasses;
+    static constexpr int kAnchors = 8400;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> coord(0.0f, 640.0f);
+        std::uniform_real_distribution<float> low(0.0f, 0.2f);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        std::uniform_int_distribution<int> cls(0, kClasses - 1);
+
+        data_.assign(static_cast<size_t>(kDims) * kAnchors, 0.0f);
+        for (int a = 0; a < kAnchors; ++a)
+        {
+            for (int d = 0; d < 4; ++d)
+            {
+                data_[static_cast<size_t>(d) * kAnchors + a] = coord(rng);
+            }
+            for (int c = 0; c < kClasses; ++c)
+            {
+                data_[static_cast<size_t>(4 + c) * kAnchors + a] = low(rng);
+            }
+            if (unit(rng) < 0.01f)
+            {
+                data_[static_cast<size_t>(4 + cls(rng)) * kAnchors + a] = 0.3f + 0.7f * unit(rng);
+            }
+        }
+
+        spec_ = makeSpec(state.range(0), 640.0f);
+        const int sizes[] = {1, kDims, kAnchors};
+        output_.create(3, sizes, spec_.depth);
+        convertTensor(data_, spec_, output_);
+
+        // 원본 대비 최대 오차 (점수 행 / 좌표 행)
+        score_error_ = 0.0f;
+        box_error_ = 0.0f;
+        for (size_t i = 0; i < data_.size(); ++i)
+        {
+            const float error = std::abs(dequantize(output_, spec_, i) - data_[i]);
+            auto &max_error = i < static_cast<size_t>(4) * kAnchors ? box_error_ : score_error_;
+            max_error = std::max(max_error, error);
+        }
+    }
+
+    void TearDown(const ::benchmark::State &) override
+    {
+    }
+
+protected:
+    std::vector<float> data_;
+    TensorSpec spec_;
+    cv::Mat output_;
+    float score_error_ = 0.0f;
+    float box_error_ = 0.0f;
+};
+
+BENCHMARK_DEFINE_F(TensorPrecisionFixture, decode)
+(benchmark::State &state)
+{
+    YOLOv8Decoder decoder;
+    std::vector<DetectionCandidate> candidates;
+    for (auto _ : state)
+    {
+        (void)_;
+        decoder.decode(output_, 0.25f, candidates, 0, spec_);
+        benchmark::DoNotOptimize(candidates.data());
+    }
+    state.counters["Candidates"] = static_cast<double>(candidates.size());
+    state.counters["ScoreErr"] = score_error_;
+    state.counters["BoxErr"] = box_error_;
+}
+BENCHMARK_REGISTER_F(TensorPrecisionFixture, decode)->DenseRange(0, 3);
+
+// 관심 클래스 10 개만 평가 (ClassFilter)
+BENCHMARK_DEFINE_F(TensorPrecisionFixture, decode_class_filter)
+(benchmark::State &state)
+{
+    YOLOv8Decoder decoder;
+    ClassFilter filter;
+    filter.class_ids = {0, 1, 2, 3, 5, 7, 9, 11, 12, 13};
+    decoder.setClassFilter(filter);
+    std::vector<DetectionCandidate> candidates;
+    for (auto _ : state)
+    {
+        (void)_;
+        decoder.decode(output_, 0.25f, candidates, 0, spec_);
+        benchmark::DoNotOptimize(candidates.data());
+    }
+    state.counters["Candidates"] = static_cast<double>(candidates.size());
+}
+BENCHMARK_REGISTER_F(TensorPrecisionFixture, decode_class_filter)->DenseRange(0, 3);
+
+// 입력 텐서 형식별 레터박스 전처리 시간과 FP32 대비 오차 (1280x720 BGR -> 640x640)
+static void letterbox(benchmark::State &state)
+{
+    cv::Mat image(720, 1280, CV_8UC3);
+    cv::randu(image, cv::Scalar::all(0), cv::Scalar::all(255));
+
+    LetterboxPreprocessor reference;
+    LetterboxInfo info;
+    const auto expected = reference.run(image, true, 640, 640, info).clone();
+
+    LetterboxPreprocessor preprocessor;
+    const auto spec = makeSpec(state.range(0), 1.0f);
+    preprocessor.setTensorSpec(spec);
+    for (auto _ : state)
+    {
+        (void)_;
+        const auto &blob = preprocessor.run(image, true, 640, 640, info);
+        benchmark::DoNotOptimize(blob.data);
+    }
+
+    const auto &blob = preprocessor.run(image, true, 640, 640, info);
+    float max_error = 0.0f;
+    for (size_t i = 0; i < blob.total(); ++i)
+    {
+        max_error = std::max(max_error, std::abs(dequantize(blob, spec, i) - expected.ptr<float>()[i]));
+    }
+    state.counters["MaxErr"] = max_error;
+}
+BENCHMARK(letterbox)->DenseRange(0, 3)->Unit(benchmark::kMicrosecond);
+} // namespace vp::adapter::out
@@ -0,0 +1,279 @@
+#include "synthetic_yolo_model.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <vector>
+
+namespace
+{
+// onnx.proto 필드 번호 / 열거값 (필요한 것만)
+enum OnnxField : int
+{
+    MODEL_IR_VERSION = 1,
+    MODEL_PRODUCER_NAME = 2,
+    MODEL_GRAPH = 7,
+    MODEL_OPSET_IMPORT = 8,
+    OPSET_VERSION = 2,
+    GRAPH_NODE = 1,
+    GRAPH_NAME = 2,
+    GRAPH_INITIALIZER = 5,
+    GRAPH_INPUT = 11,
+    GRAPH_OUTPUT = 12,
+    NODE_INPUT = 1,
+    NODE_OUTPUT = 2,
+    NODE_NAME = 3,
+    NODE_OP_TYPE = 4,
+    NODE_ATTRIBUTE = 5,
+    ATTR_NAME = 1,
+    ATTR_I = 3,
+    ATTR_INTS = 8,
+    ATTR_TYPE = 20,
+    TENSOR_DIMS = 1,
+    TENSOR_DATA_TYPE = 2,
+    TENSOR_NAME = 8,
+    TENSOR_RAW_DATA = 9,
+    VALUE_NAME = 1,
+    VALUE_TYPE = 2,
+    TYPE_TENSOR = 1,
+    TENSOR_TYPE_ELEM = 1,
+    TENSOR_TYPE_SHAPE = 2,
+    SHAPE_DIM = 1,
+    DIM_VALUE = 1,
+    DIM_PARAM = 2,
+};
+
+constexpr int kAttrInt = 2;
+constexpr int kAttrInts = 7;
+constexpr int kFloat = 1;
+constexpr int kInt64 = 7;
+constexpr int kIrVersion = 8;
+constexpr int kOpsetVersion = 13;
+
+// protobuf 와이어 형식 인코더 (varint / length-delimited 만 사용)
+class ProtoWriter
+{
+public:
+    ProtoWriter &varint(int field, int64_t value)
+    {
+        this->key(field, 0);
+        this->raw(static_cast<uint64_t>(value));
+        return *this;
+    }
+
+    ProtoWriter &bytes(int field, const void *data, size_t size)
+    {
+        this->key(field, 2);
+        this->raw(size);
+        buffer_.append(static_cast<const char *>(data), size);
+        return *this;
+    }
+
+    ProtoWriter &string(int field, const std::string &value) { return this->bytes(field, value.data(), value.size()); }
+    ProtoWriter &message(int field, const ProtoWriter &message) { return this->string(field, message.buffer_); }
+    const std::string &data() const { return buffer_; }
+
+private:
+    void key(int field, int wire_type) { this->raw(static_cast<uint64_t>(field) << 3 | static_cast<uint64_t>(wire_type)); }
+
+    void raw(uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            buffer_.push_back(static_cast<char>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        buffer_.push_back(static_cast<char>(value));
+    }
+
+    std::string buffer_;
+};
+
+ProtoWriter intsAttribute(const std::string &name, const std::vector<int64_t> &values)
+{
+    ProtoWriter attr;
+    attr.string(ATTR_NAME, name).varint(ATTR_TYPE, kAttrInts);
+    for (int64_t v : values)
+    {
+        attr.varint(ATTR_INTS, v);
+    }
+    return attr;
+}
+
+ProtoWriter intAttribute(const std::string &name, int64_t value)
+{
+    ProtoWriter attr;
+    attr.string(ATTR_NAME, name).varint(ATTR_TYPE, kAttrInt).varint(ATTR_I, value);
+    return attr;
+}
+
+// dims: 양수는 고정 크기, 빈 문자열이 아닌 params 는 동적 차원 이름
+ProtoWriter valueInfo(const std::string &name, const std::vector<int64_t> &dims, const std::vector<std::string> &params)
+{
+    ProtoWriter shape;
+    for (size_t i = 0; i < dims.size(); ++i)
+    {
+        ProtoWriter dim;
+        if (!params[i].empty())
+        {
+            dim.string(DIM_PARAM, params[i]);
+        }
+        else
+        {
+            dim.varint(DIM_VALUE, dims[i]);
+        }
+        shape.message(SHAPE_DIM, dim);
+    }
+    ProtoWriter tensor_type;
+    tensor_type.varint(TENSOR_TYPE_ELEM, kFloat).message(TENSOR_TYPE_SHAPE, shape);
+    ProtoWriter type;
+    type.message(TYPE_TENSOR, tensor_type);
+    ProtoWriter info;
+    info.string(VALUE_NAME, name).message(VALUE_TYPE, type);
+    return info;
+}
+
+class GraphBuilder
+{
+public:
+    explicit GraphBuilder(uint32_t seed) : rng_(seed) {}
+
+    void node(const std::string &op_type, const std::vector<std::string> &inputs, const std::string &output,
+              const std::vector<ProtoWriter> &attributes = {})
+    {
+        ProtoWriter node;
+        for (const auto &input : inputs)
+        {
+            node.string(NODE_INPUT, input);
+        }
+        node.string(NODE_OUTPUT, output).string(NODE_NAME, output).string(NODE_OP_TYPE, op_type);
+        for (const auto &attribute : attributes)
+        {
+            node.message(NODE_ATTRIBUTE, attribute);
+        }
+        graph_.message(GRAPH_NODE, node);
+    }
+
+    // kernel x kernel Conv (+ Relu). 반환: 출력 이름
+    std::string conv(const std::string &input, int in_channels, int out_channels, int kernel, int stride, bool relu, float bias)
+    {
+        const std::string name = "conv" + std::to_string(++count_);
+        const float limit = std::sqrt(3.0f / static_cast<float>(in_channels * kernel * kernel)); // 분산 1/fan_in
+        std::uniform_real_distribution<float> weight(-limit, limit);
+        std::vector<float> w(static_cast<size_t>(out_channels) * in_channels * kernel * kernel);
+        for (auto &v : w)
+        {
+            v = weight(rng_);
+        }
+        this->floatInitializer(name + ".weight", {out_channels, in_channels, kernel, kernel}, w);
+        this->floatInitializer(name + ".bias", {out_channels}, std::vector<float>(out_channels, bias));
+
+        const int pad = kernel / 2;
+        this->node("Conv", {input, name + ".weight", name + ".bias"}, name,
+                   {intsAttribute("kernel_shape", {kernel, kernel}), intsAttribute("strides", {stride, stride}), intsAttribute("pads", {pad, pad, pad, pad})});
+        if (!relu)
+        {
+            return name;
+        }
+        this->node("Relu", {name}, name + ".relu");
+        return name + ".relu";
+    }
+
+    void floatInitializer(const std::string &name, const std::vector<int64_t> &dims, const std::vector<float> &values)
+    {
+        ProtoWriter tensor;
+        for (int64_t d : dims)
+        {
+            tensor.varint(TENSOR_DIMS, d);
+        }
+        tensor.varint(TENSOR_DATA_TYPE, kFloat).string(TENSOR_NAME, name).bytes(TENSOR_RAW_DATA, values.data(), values.size() * sizeof(float));
+        graph_.message(GRAPH_INITIALIZER, tensor);
+    }
+
+    void int64Initializer(const std::string &name, const std::vector<int64_t> &values)
+    {
+        // raw_data 는 little-endian
+        std::string raw(values.size() * sizeof(int64_t), '\0');
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            const uint64_t v = static_cast<uint64_t>(values[i]);
+            for (size_t b = 0; b < sizeof(int64_t); ++b)
+            {
+                raw[i * sizeof(int64_t) + b] = static_cast<char>((v >> (8 * b)) & 0xff);
+            }
+        }
+        ProtoWriter tensor;
+        tensor.varint(TENSOR_DIMS, static_cast<int64_t>(values.size())).varint(TENSOR_DATA_TYPE, kInt64).string(TENSOR_NAME, name).bytes(TENSOR_RAW_DATA, raw.data(), raw.size());
+        graph_.message(GRAPH_INITIALIZER, tensor);
+    }
+
+    ProtoWriter &graph() { return graph_; }
+
+private:
+    std::mt19937 rng_;
+    ProtoWriter graph_;
+    int count_ = 0;
+};
+} // namespace
+
+namespace vp::adapter::out
+{
+
+bool writeSyntheticYoloModel(const std::string &path, const SyntheticYoloSpec &spec)
+{
+    const int w = std::max(1, spec.width);
+    const int outputs = 4 + spec.num_classes;
+    GraphBuilder builder(42);
+
+    // 백본: stride 2 / 4 / 8 / 16 / 32
+    std::string x = builder.conv("images", 3, w, 3, 2, true, 0.0f);
+    x = builder.conv(x, w, 2 * w, 3, 2, true, 0.0f);
+    const std::string p3 = builder.conv(x, 2 * w, 4 * w, 3, 2, true, 0.0f);
+    const std::string p4 = builder.conv(p3, 4 * w, 8 * w, 3, 2, true, 0.0f);
+    const std::string p5 = builder.conv(p4, 8 * w, 8 * w, 3, 2, true, 0.0f);
+
+    // 헤드: 박스 Conv 편향 0, 클래스 Conv 편향 class_bias (앵커별 점수 분포를 조절)
+    const int head_inputs[] = {4 * w, 8 * w, 8 * w};
+    const std::string features[] = {p3, p4, p5};
+    std::vector<std::string> heads;
+    for (int i = 0; i < 3; ++i)
+    {
+        const std::string box = builder.conv(features[i], head_inputs[i], 4, 1, 1, false, 0.0f);
+        const std::string cls = builder.conv(features[i], head_inputs[i], spec.num_classes, 1, 1, false, spec.class_bias);
+        const std::string head = "head" + std::to_string(i);
+        builder.node("Concat", {box, cls}, head, {intAttribute("axis", 1)});
+        builder.int64Initializer(head + ".shape", {0, outputs, -1});
+        builder.node("Reshape", {head, head + ".shape"}, head + ".flat");
+        heads.push_back(head + ".flat");
+    }
+    builder.node("Concat", heads, "anchors", {intAttribute("axis", 2)});
+    builder.node("Sigmoid", {"anchors"}, "output0");
+
+    auto &graph = builder.graph();
+    graph.string(GRAPH_NAME, "synthetic_yolo");
+    graph.message(GRAPH_INPUT, valueInfo("images", {0, 3, 0, 0}, {"batch", "", "height", "width"}));
+    graph.message(GRAPH_OUTPUT, valueInfo("output0", {0, outputs, 0}, {"batch", "", "anchors"}));
+
+    ProtoWriter opset;
+    opset.varint(OPSET_VERSION, kOpsetVersion);
+    ProtoWriter model;
+    model.varint(MODEL_IR_VERSION, kIrVersion).string(MODEL_PRODUCER_NAME, "adapter_yolov8_bench").message(MODEL_GRAPH, graph).message(MODEL_OPSET_IMPORT, opset);
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(model.data().data(), static_cast<std::streamsize>(model.data().size()));
+    return out.good();
+}
+
+const std::string &syntheticYoloModelPath()
+{
+    static const std::string path = []
+    {
+        const auto file = std::filesystem::temp_directory_path() / "adapter_yolov8_bench_synthetic.onnx";
+        return writeSyntheticYoloModel(file.string()) ? file.string() : std::string();
+    }();
+    return path;
+}
+
+} // namespace vp::adapter::out
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <string>
+
+namespace vp::adapter::out
+{
+
+// 합성 YOLO 모델 구성. 가중치는 고정 시드 난수이므로 탐지 결과는 의미 없고 연산량/메모리 흐름만 YOLO 와 비슷함
+struct SyntheticYoloSpec
+{
+    int num_classes = 80;
+    int width = 16;             // 첫 단계 채널 수 (단계마다 2 배, 최대 8 배)
+    float class_bias = -6.0f;   // 클래스 점수 sigmoid 전 편향 (작을수록 기준을 넘는 앵커가 적음)
+};
+
+/**
+ * @brief 벤치마크용 YOLOv8 형태 ONNX 모델을 path 에 생성 (외부 도구/네트워크 불필요)
+ *
+ * 입력 images [N, 3, H, W] (N/H/W 동적, H/W 는 32 배수) -> stride 2 Conv + Relu 5 단계 ->
+ * stride 8/16/32 특징마다 1x1 Conv 헤드 (4 + classes 채널) -> Reshape [N, C, -1] -> Concat -> Sigmoid
+ * 출력 output0 [N, 4 + classes, anchors] 는 YOLOv8Decoder 입력 형식과 같다.
+ */
+bool writeSyntheticYoloModel(const std::string &path, const SyntheticYoloSpec &spec = {});
+
+// 기본 구성의 합성 모델을 임시 디렉터리에 한 번 생성하고 경로 반환 (실패 시 빈 문자열)
+const std::string &syntheticYoloModelPath();
+
+} // namespace vp::adapter::out
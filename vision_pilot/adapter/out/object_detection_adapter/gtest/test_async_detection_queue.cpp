@@ -0,0 +1,182 @@
+#include "async_detection_queue.hpp"
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace vp::adapter::out
+{
+class AsyncDetectionQueueTest : public ::testing::Test
+{
+protected:
+    // frame_id 를 confidence 에 담아 돌려주는 탐지기. 호출마다 배치 크기/단계를 기록
+    AsyncDetectionQueue::BatchDetector makeDetector(int delay_ms)
+    {
+        return [this, delay_ms](const std::vector<const vp::domain::model::ImagePacket *> &images, vp::port::out::DetectionLevel level)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(delay_ms));
+            std::vector<std::vector<vp::domain::model::Detection>> results;
+            for (const auto *image : images)
+            {
+                vp::domain::model::Detection det;
+                det.confidence = static_cast<float>(image->frame_id);
+                results.push_back({det});
+            }
+            std::lock_guard<std::mutex> lock(mutex_);
+            batches_.emplace_back(images.size(), level);
+            return results;
+        };
+    }
+
+    vp::port::out::DetectionCallback makeCallback()
+    {
+        return [this](uint64_t frame_id, std::vector<vp::domain::model::Detection> detections)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            completed_.push_back(frame_id);
+            confidences_.push_back(detections.empty() ? -1.0f : detections.front().confidence);
+        };
+    }
+
+    static vp::domain::model::ImagePacket makeFrame(uint64_t frame_id)
+    {
+        vp::domain::model::ImagePacket packet;
+        packet.frame_id = frame_id;
+        return packet;
+    }
+
+    std::mutex mutex_;
+    std::vector<std::pair<size_t, vp::port::out::DetectionLevel>> batches_;
+    std::vector<uint64_t> completed_;
+    std::vector<float> confidences_;
+};
+
+TEST_F(AsyncDetectionQueueTest, ShouldCompleteRequestsInOrderAndBatchPendingFrames)
+{
+    constexpr uint64_t kFrameCount = 20;
+    AsyncDetectionQueue queue(8, 4, this->makeDetector(2));
+    for (uint64_t id = 1; id <= kFrameCount; ++id)
+    {
+        queue.submit(makeFrame(id), vp::port::out::DetectionLevel::FULL, this->makeCallback());
+    }
+    queue.waitIdle();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ASSERT_EQ(completed_.size(), kFrameCount);
+    for (uint64_t i = 0; i < kFrameCount; ++i)
+    {
+        EXPECT_EQ(completed_[i], i + 1);
+        EXPECT_FLOAT_EQ(confidences_[i], static_cast<float>(i + 1));
+    }
+    size_t max_batch = 0;
+    for (const auto &batch : batches_)
+    {
+        max_batch = std::max(max_batch, batch.first);
+    }
+    EXPECT_GT(max_batch, 1u); // 탐지 중에 쌓인 요청은 묶어서 처리
+    EXPECT_LE(max_batch, 4u);
+}
+
+TEST_F(AsyncDetectionQueueTest, ShouldNotMixDetectionLevelsInOneBatch)
+{
+    {
+        // 첫 요청이 탐지되는 동안 나머지가 쌓이도록 탐지기를 느리게 함
+        AsyncDetectionQueue queue(8, 8, this->makeDetector(5));
+        queue.submit(makeFrame(1), vp::port::out::DetectionLevel::FULL, this->makeCallback());
+        queue.submit(makeFrame(2), vp::port::out::DetectionLevel::FULL, this->makeCallback());
+        queue.submit(makeFrame(3), vp::port::out::DetectionLevel::REDUCED, this->makeCallback());
+        queue.submit(makeFrame(4), vp::port::out::DetectionLevel::FULL, this->makeCallback());
+        queue.waitIdle();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    EXPECT_EQ(completed_, (std::vector<uint64_t>{1, 2, 3, 4}));
+    size_t reduced = 0;
+    for (const auto &batch : batches_)
+    {
+        if (batch.second == vp::port::out::DetectionLevel::REDUCED)
+        {
+            EXPECT_EQ(batch.first, 1u);
+            ++reduced;
+        }
+    }
+    EXPECT_EQ(reduced, 1u);
+}
+
+TEST_F(AsyncDetectionQueueTest, ShouldDrainPendingRequestsOnDestruction)
+{
+    constexpr uint64_t kFrameCount = 6;
+    {
+        AsyncDetectionQueue queue(kFrameCount, 2, this->makeDetector(1));
+        for (uint64_t id = 1; id <= kFrameCount; ++id)
+        {
+            queue.submit(makeFrame(id), vp::port::out::DetectionLevel::FULL, this->makeCallback());
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    EXPECT_EQ(completed_.size(), kFrameCount);
+}
+
+TEST_F(AsyncDetectionQueueTest, ShouldBlockSubmitWhenQueueIsFull)
+{
+    std::atomic<int> detecting{0};
+    std::atomic<bool> release{false};
+    AsyncDetectionQueue queue(1, 1, [&](const std::vector<const vp::domain::model::ImagePacket *> &images, vp::port::out::DetectionLevel)
+                              {
+                                  ++detecting;
+                                  while (!release)
+                                  {
+                                      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                                  }
+                                  return std::vector<std::vector<vp::domain::model::Detection>>(images.size()); });
+
+    queue.submit(makeFrame(1), vp::port::out::DetectionLevel::FULL, this->makeCallback());
+    while (detecting == 0)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    queue.submit(makeFrame(2), vp::port::out::DetectionLevel::FULL, this->makeCallback()); // 대기열 한 칸 차지
+
+    std::atomic<bool> submitted{false};
+    std::thread producer([&]
+                         {
+        queue.submit(makeFrame(3), vp::port::out::DetectionLevel::FULL, this->makeCallback());
+        submitted = true; });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(submitted);
+
+    release = true;
+    producer.join();
+    queue.waitIdle();
+    EXPECT_TRUE(submitted);
+    std::lock_guard<std::mutex> lock(mutex_);
+    EXPECT_EQ(completed_, (std::vector<uint64_t>{1, 2, 3}));
+}
+
+TEST_F(AsyncDetectionQueueTest, ShouldCompleteWithEmptyResultsWhenDetectionThrows)
+{
+    auto detect = this->makeDetector(0);
+    {
+        // 한 장씩 탐지. 2 번 프레임 탐지에서 예외 -> 빈 결과로 완료하고 다음 요청은 계속 처리
+        AsyncDetectionQueue queue(8, 1, [&](const std::vector<const vp::domain::model::ImagePacket *> &images, vp::port::out::DetectionLevel level)
+                                  {
+            if (images.front()->frame_id == 2)
+            {
+                throw std::runtime_error("inference failed");
+            }
+            return detect(images, level); });
+        for (uint64_t id = 1; id <= 3; ++id)
+        {
+            queue.submit(makeFrame(id), vp::port::out::DetectionLevel::FULL, this->makeCallback());
+        }
+        queue.waitIdle();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    EXPECT_EQ(completed_, (std::vector<uint64_t>{1, 2, 3}));
+    EXPECT_EQ(confidences_, (std::vector<float>{1.0f, -1.0f, 3.0f}));
+}
+} // namespace vp::adapter::out
@@ -0,0 +1,151 @@
+#include "detection_cache.hpp"
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+
+namespace vp::adapter::out
+{
+class DetectionCacheTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        std::remove(kPath);
+    }
+    void TearDown() override
+    {
+        std::remove(kPath);
+    }
+
+    static std::vector<vp::domain::model::Detection> makeDetections(int count)
+    {
+        std::vector<vp::domain::model::Detection> detections;
+        for (int i = 0; i < count; ++i)
+        {
+            vp::domain::model::Detection det;
+            det.class_id = vp::domain::model::ClassIdHelper::fromInt(i);
+            det.confidence = 0.5f + 0.1f * i;
+            det.bbox = {10.0f * i, 20.0f, 30.0f, 40.0f};
+            detections.push_back(det);
+        }
+        return detections;
+    }
+
+    static constexpr const char *kPath = "test_detection_cache.bin";
+};
+
+TEST_F(DetectionCacheTest, ShouldReturnStoredDetectionsAcrossReopen)
+{
+    {
+        DetectionCache cache;
+        ASSERT_TRUE(cache.open(kPath));
+        std::vector<vp::domain::model::Detection> found;
+        EXPECT_FALSE(cache.find(1, found));
+        cache.store(1, makeDetections(3));
+        cache.store(2, {}); // 탐지 결과가 없는 프레임도 캐시
+        cache.store(1, makeDetections(2)); // 마지막 기록 우선
+    }
+
+    DetectionCache cache;
+    ASSERT_TRUE(cache.open(kPath));
+    EXPECT_EQ(cache.size(), 2u);
+
+    std::vector<vp::domain::model::Detection> found;
+    ASSERT_TRUE(cache.find(1, found));
+    ASSERT_EQ(found.size(), 2u);
+    EXPECT_EQ(found[1].class_id, vp::domain::model::ClassId::BICYCLE);
+    EXPECT_FLOAT_EQ(found[1].bbox.x, 10.0f);
+
+    found = makeDetections(1);
+    ASSERT_TRUE(cache.find(2, found));
+    EXPECT_TRUE(found.empty());
+    EXPECT_FALSE(cache.find(3, found));
+    EXPECT_EQ(cache.hits(), 2u);
+    EXPECT_EQ(cache.misses(), 1u);
+}
+
+TEST_F(DetectionCacheTest, ShouldDropTruncatedRecordAndKeepAppending)
+{
+    {
+        DetectionCache cache;
+        ASSERT_TRUE(cache.open(kPath));
+        cache.store(1, makeDetections(1));
+    }
+    {
+        // 비정상 종료로 레코드 일부만 기록된 상태
+        std::ofstream out(kPath, std::ios::binary | std::ios::app);
+        const uint64_t key = 2;
+        const uint32_t count[] = {4, 0};
+        out.write(reinterpret_cast<const char *>(&key), sizeof(key));
+        out.write(reinterpret_cast<const char *>(count), sizeof(count));
+    }
+
+    DetectionCache cache;
+    ASSERT_TRUE(cache.open(kPath));
+    EXPECT_EQ(cache.size(), 1u);
+    std::vector<vp::domain::model::Detection> found;
+    EXPECT_TRUE(cache.find(1, found));
+    EXPECT_FALSE(cache.find(2, found));
+}
+
+TEST_F(DetectionCacheTest, ShouldStartOverWhenFormatDiffers)
+{
+    {
+        std::ofstream out(kPath, std::ios::binary);
+        out << "not a detection cache";
+    }
+
+    DetectionCache cache;
+    ASSERT_TRUE(cache.open(kPath));
+    EXPECT_EQ(cache.size(), 0u);
+    cache.store(7, makeDetections(2));
+    cache.close();
+
+    ASSERT_TRUE(cache.open(kPath));
+    EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST_F(DetectionCacheTest, ShouldHashContentIndependentOfChunking)
+{
+    std::vector<unsigned char> data(1000);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<unsigned char>(i * 31);
+    }
+
+    const uint64_t whole = DetectionCache::hashBytes(data.data(), data.size());
+    const uint64_t chunked = DetectionCache::hashBytes(data.data() + 512, data.size() - 512, DetectionCache::hashBytes(data.data(), 512));
+    EXPECT_EQ(whole, chunked);
+
+    data[999] ^= 1;
+    EXPECT_NE(DetectionCache::hashBytes(data.data(), data.size()), whole);
+    data[999] ^= 1;
+    data[0] ^= 0x80;
+    EXPECT_NE(DetectionCache::hashBytes(data.data(), data.size()), whole);
+}
+
+TEST_F(DetectionCacheTest, ShouldSpreadEveryByteToLowKeyBits)
+{
+    std::vector<unsigned char> data(64);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<unsigned char>(i * 7);
+    }
+    const uint64_t base = DetectionCache::hashBytes(data.data(), data.size());
+
+    // 단어의 어느 바이트가 바뀌어도 하위 32 비트까지 달라져야 함 (곱셈만 쓰면 상위 바이트는 상위 비트에만 영향)
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] ^= 0x80;
+        const uint64_t changed = DetectionCache::hashBytes(data.data(), data.size());
+        EXPECT_NE((changed ^ base) & 0xffffffffull, 0u) << "byte " << i;
+        EXPECT_NE(DetectionCache::finishHash(changed), DetectionCache::finishHash(base));
+        data[i] ^= 0x80;
+    }
+
+    // 끝에 0 이 붙은 입력과 구분
+    const unsigned char short_input[] = {1, 2, 3};
+    const unsigned char padded_input[] = {1, 2, 3, 0};
+    EXPECT_NE(DetectionCache::hashBytes(short_input, sizeof(short_input)), DetectionCache::hashBytes(padded_input, sizeof(padded_input)));
+}
+} // namespace vp::adapter::out
@@ -0,0 +1,126 @@
+#include "inference_pool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+
+namespace vp::adapter::out
+{
+TEST(InferencePoolTest, ShouldRunEveryTaskOnceAndWaitForCompletion)
+{
+    InferencePool pool{3};
+    EXPECT_EQ(pool.threadCount(), 3);
+
+    for (int round = 0; round < 20; ++round)
+    {
+        std::vector<std::atomic<int>> counts(7);
+        pool.run(counts.size(), [&](size_t i)
+                 { counts[i].fetch_add(1); });
+        for (const auto &count : counts)
+        {
+            EXPECT_EQ(count.load(), 1);
+        }
+    }
+}
+
+TEST(InferencePoolTest, ShouldRunTasksConcurrently)
+{
+    InferencePool pool{2};
+    std::atomic<int> running{0};
+    std::atomic<int> max_running{0};
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+
+    pool.run(2, [&](size_t)
+             {
+        const int now = running.fetch_add(1) + 1;
+        max_running = std::max(max_running.load(), now);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            threads.insert(std::this_thread::get_id());
+        }
+        // 다른 작업이 시작될 때까지 잠시 대기
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(500);
+        while (running.load() < 2 && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+        running.fetch_sub(1); });
+
+    EXPECT_EQ(max_running.load(), 2);
+    EXPECT_EQ(threads.size(), 2u);
+}
+
+TEST(InferencePoolTest, ShouldRunOnCallerThreadWithSingleThread)
+{
+    InferencePool pool{1};
+    std::set<std::thread::id> threads;
+    pool.run(4, [&](size_t)
+             { threads.insert(std::this_thread::get_id()); });
+
+    ASSERT_EQ(threads.size(), 1u);
+    EXPECT_EQ(*threads.begin(), std::this_thread::get_id());
+}
+
+TEST(InferencePoolTest, ShouldRethrowTaskExceptionOnCaller)
+{
+    InferencePool pool{3};
+    for (size_t failing = 0; failing < 8; ++failing)
+    {
+        // 작업 스레드에서 던진 예외도 종료 없이 호출 스레드로 전달
+        std::atomic<int> finished{0};
+        EXPECT_THROW(pool.run(8, [&](size_t i)
+                              {
+            if (i == failing)
+            {
+                throw std::runtime_error("task failed");
+            }
+            finished.fetch_add(1); }),
+                     std::runtime_error);
+        EXPECT_LT(finished.load(), 8);
+
+        // 예외 후에도 풀은 계속 사용 가능
+        std::atomic<int> count{0};
+        pool.run(5, [&](size_t)
+                 { count.fetch_add(1); });
+        EXPECT_EQ(count.load(), 5);
+    }
+}
+
+TEST(InferencePoolTest, ShouldPinWorkerThreadsToAffinity)
+{
+    Affinity affinity;
+    affinity.enable = true;
+    affinity.cpu_index = 0;
+    affinity.cpu_count = 1;
+    InferencePool pool{2, affinity};
+
+    const auto caller = std::this_thread::get_id();
+    std::atomic<int> running{0};
+    std::atomic<int> worker_cpus{-1}; // 작업 스레드에서 실행된 작업이 본 허용 CPU 수
+    std::atomic<bool> worker_cpu0{false};
+    pool.run(2, [&](size_t)
+             {
+        running.fetch_add(1);
+        if (std::this_thread::get_id() != caller)
+        {
+            cpu_set_t cpuset;
+            CPU_ZERO(&cpuset);
+            pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+            worker_cpus = CPU_COUNT(&cpuset);
+            worker_cpu0 = CPU_ISSET(0, &cpuset);
+        }
+        // 두 작업이 서로 다른 스레드에서 실행되도록 다른 작업이 시작될 때까지 대기
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(500);
+        while (running.load() < 2 && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        } });
+
+    EXPECT_EQ(worker_cpus.load(), 1);
+    EXPECT_TRUE(worker_cpu0.load());
+}
+} // namespace vp::adapter::out
@@ -0,0 +1,233 @@
+#include "instance_decoder.hpp"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <random>
+
+namespace vp::adapter::out
+{
+class InstanceDecoderTest : public ::testing::Test
+{
+protected:
+    static constexpr int kClasses = 2;
+    static constexpr int kMasks = 4;
+    static constexpr int kAnchors = 3;
+    static constexpr int kInput = 64;
+    static constexpr int kProto = 16; // 입력의 1/4
+
+    void SetUp() override
+    {
+        layout_.task = config::YoloTask::SEGMENT;
+        layout_.num_masks = kMasks;
+        layout_.mask_threshold = 0.5f;
+        decoder_.setLayout(layout_);
+
+        // 프로토타입: FP16 으로 정확히 표현되는 값 (1/64 단위)
+        std::mt19937 rng(3);
+        std::uniform_int_distribution<int> step(-64, 64);
+        protos_.resize(static_cast<size_t>(kMasks) * kProto * kProto);
+        for (auto &v : protos_)
+        {
+            v = static_cast<float>(step(rng)) / 64.0f;
+        }
+
+        // 출력 [1, 4 + classes + masks, anchors]: 앵커 1 의 마스크 계수만 의미 있음
+        output_.assign(static_cast<size_t>(4 + kClasses + kMasks) * kAnchors, 0.0f);
+        const float coefficients[kMasks] = {1.0f, -0.5f, 0.25f, 0.75f};
+        for (int m = 0; m < kMasks; ++m)
+        {
+            output_[static_cast<size_t>(4 + kClasses + m) * kAnchors + 1] = coefficients[m];
+        }
+    }
+
+    cv::Mat outputMat()
+    {
+        const int sizes[] = {1, 4 + kClasses + kMasks, kAnchors};
+        return cv::Mat(3, sizes, CV_32F, output_.data());
+    }
+
+    cv::Mat protoMat()
+    {
+        const int sizes[] = {1, kMasks, kProto, kProto};
+        return cv::Mat(4, sizes, CV_32F, protos_.data());
+    }
+
+    // 프로토타입 픽셀 (x, y) 의 sigmoid(계수 x 프로토타입) > 기준 여부
+    bool referencePixel(int x, int y) const
+    {
+        float sum = 0.0f;
+        for (int m = 0; m < kMasks; ++m)
+        {
+            sum += output_[static_cast<size_t>(4 + kClasses + m) * kAnchors + 1] * protos_[(static_cast<size_t>(m) * kProto + y) * kProto + x];
+        }
+        return 1.0f / (1.0f + std::exp(-sum)) > layout_.mask_threshold;
+    }
+
+    static DetectionCandidate candidate(float cx, float cy, float w, float h)
+    {
+        DetectionCandidate c;
+        c.cx = cx;
+        c.cy = cy;
+        c.w = w;
+        c.h = h;
+        c.score = 0.9f;
+        c.class_id = 0;
+        c.anchor = 1;
+        return c;
+    }
+
+    InstanceLayout layout_;
+    InstanceDecoder decoder_;
+    std::vector<float> protos_;
+    std::vector<float> output_;
+};
+
+TEST_F(InstanceDecoderTest, ShouldMatchReferenceMaskInsideBox)
+{
+    LetterboxInfo letterbox;
+    letterbox.resized_w = kInput;
+    letterbox.resized_h = kInput;
+
+    ASSERT_TRUE(decoder_.setPrototypes(protoMat(), 0));
+    vp::domain::model::InstanceResult instance;
+    decoder_.decode(outputMat(), {}, 0, candidate(30.0f, 26.0f, 20.0f, 12.0f), letterbox, cv::Size(kInput, kInput), instance);
+
+    // 박스 (20, 20) ~ (40, 32) -> 프로토타입 (5, 5) ~ (10, 8)
+    const auto &mask = instance.mask;
+    ASSERT_EQ(mask.width, 5);
+    ASSERT_EQ(mask.height, 3);
+    EXPECT_FLOAT_EQ(mask.region.x, 20.0f);
+    EXPECT_FLOAT_EQ(mask.region.y, 20.0f);
+    EXPECT_FLOAT_EQ(mask.region.width, 20.0f);
+    EXPECT_FLOAT_EQ(mask.region.height, 12.0f);
+    for (int y = 0; y < mask.height; ++y)
+    {
+        for (int x = 0; x < mask.width; ++x)
+        {
+            EXPECT_EQ(mask.data[y * mask.width + x] != 0, referencePixel(5 + x, 5 + y)) << x << ", " << y;
+        }
+    }
+    EXPECT_TRUE(instance.keypoints.empty());
+}
+
+TEST_F(InstanceDecoderTest, ShouldClipMaskToLetterboxContent)
+{
+    // 원본 128x64 -> 입력 64x32 + 상하 패딩 16
+    LetterboxInfo letterbox;
+    letterbox.scale = 0.5f;
+    letterbox.pad_y = 16;
+    letterbox.resized_w = kInput;
+    letterbox.resized_h = 32;
+
+    ASSERT_TRUE(decoder_.setPrototypes(protoMat(), 0));
+    vp::domain::model::InstanceResult instance;
+    decoder_.decode(outputMat(), {}, 0, candidate(32.0f, 20.0f, 16.0f, 16.0f), letterbox, cv::Size(kInput, kInput), instance);
+
+    // 박스 y 12 ~ 28 중 패딩(< 16)은 제외 -> 프로토타입 y 4 ~ 7, 원본 y 0 ~ 24
+    const auto &mask = instance.mask;
+    ASSERT_EQ(mask.height, 3);
+    ASSERT_EQ(mask.width, 4);
+    EXPECT_FLOAT_EQ(mask.region.y, 0.0f);
+    EXPECT_FLOAT_EQ(mask.region.height, 24.0f);
+    EXPECT_FLOAT_EQ(mask.region.x, 48.0f);
+    EXPECT_FLOAT_EQ(mask.region.width, 32.0f);
+    for (int y = 0; y < mask.height; ++y)
+    {
+        for (int x = 0; x < mask.width; ++x)
+        {
+            EXPECT_EQ(mask.data[y * mask.width + x] != 0, referencePixel(6 + x, 4 + y));
+        }
+    }
+}
+
+TEST_F(InstanceDecoderTest, ShouldProduceSameMaskFromHalfPrecisionPrototypes)
+{
+    LetterboxInfo letterbox;
+    letterbox.resized_w = kInput;
+    letterbox.resized_h = kInput;
+    const auto box = candidate(32.0f, 32.0f, 48.0f, 40.0f);
+
+    vp::domain::model::InstanceResult expected;
+    ASSERT_TRUE(decoder_.setPrototypes(protoMat(), 0));
+    decoder_.decode(outputMat(), {}, 0, box, letterbox, cv::Size(kInput, kInput), expected);
+
+    std::vector<cv::float16_t> half;
+    for (float v : protos_)
+    {
+        half.push_back(cv::float16_t(v));
+    }
+    const int sizes[] = {1, kMasks, kProto, kProto};
+    vp::domain::model::InstanceResult actual;
+    ASSERT_TRUE(decoder_.setPrototypes(cv::Mat(4, sizes, CV_16F, half.data()), 0));
+    decoder_.decode(outputMat(), {}, 0, box, letterbox, cv::Size(kInput, kInput), actual);
+
+    EXPECT_EQ(actual.mask.width, expected.mask.width);
+    EXPECT_EQ(actual.mask.height, expected.mask.height);
+    EXPECT_EQ(actual.mask.data, expected.mask.data);
+}
+
+TEST_F(InstanceDecoderTest, ShouldRejectPrototypesWithUnexpectedShape)
+{
+    const int sizes[] = {1, kMasks + 1, kProto, kProto};
+    std::vector<float> protos(static_cast<size_t>(kMasks + 1) * kProto * kProto, 0.0f);
+    EXPECT_FALSE(decoder_.setPrototypes(cv::Mat(4, sizes, CV_32F, protos.data()), 0));
+    EXPECT_FALSE(decoder_.setPrototypes(protoMat(), 1));
+
+    // 프로토타입이 없으면 마스크 없이 진행
+    LetterboxInfo letterbox;
+    letterbox.resized_w = kInput;
+    letterbox.resized_h = kInput;
+    vp::domain::model::InstanceResult instance;
+    decoder_.decode(outputMat(), {}, 0, candidate(32.0f, 32.0f, 16.0f, 16.0f), letterbox, cv::Size(kInput, kInput), instance);
+    EXPECT_TRUE(instance.mask.data.empty());
+}
+
+TEST_F(InstanceDecoderTest, ShouldRestoreKeypointsToOriginalCoordinates)
+{
+    InstanceLayout layout;
+    layout.task = config::YoloTask::POSE;
+    layout.num_keypoints = 2;
+    layout.keypoint_dims = 3;
+    decoder_.setLayout(layout);
+    ASSERT_EQ(decoder_.extraRows(), 6);
+
+    const int dims = 4 + kClasses + 6;
+    std::vector<float> output(static_cast<size_t>(dims) * kAnchors, 0.0f);
+    const float keypoints[] = {20.0f, 30.0f, 0.8f, 50.0f, 18.0f, 0.1f};
+    for (int i = 0; i < 6; ++i)
+    {
+        output[static_cast<size_t>(4 + kClasses + i) * kAnchors + 1] = keypoints[i];
+    }
+    const int sizes[] = {1, dims, kAnchors};
+
+    LetterboxInfo letterbox;
+    letterbox.scale = 0.5f;
+    letterbox.pad_x = 10;
+    vp::domain::model::InstanceResult instance;
+    decoder_.decode(cv::Mat(3, sizes, CV_32F, output.data()), {}, 0, candidate(32.0f, 32.0f, 16.0f, 16.0f), letterbox,
+                    cv::Size(kInput, kInput), instance);
+
+    ASSERT_EQ(instance.keypoints.size(), 2u);
+    EXPECT_FLOAT_EQ(instance.keypoints[0].x, 20.0f);
+    EXPECT_FLOAT_EQ(instance.keypoints[0].y, 60.0f);
+    EXPECT_FLOAT_EQ(instance.keypoints[0].score, 0.8f);
+    EXPECT_FLOAT_EQ(instance.keypoints[1].x, 80.0f);
+    EXPECT_FLOAT_EQ(instance.keypoints[1].y, 36.0f);
+    EXPECT_FLOAT_EQ(instance.keypoints[1].score, 0.1f);
+    EXPECT_TRUE(instance.mask.data.empty());
+}
+
+TEST_F(InstanceDecoderTest, ShouldNotDecodeExtraRowsAsClassScores)
+{
+    // 마스크 계수(1.0)가 클래스 점수보다 높아도 후보로 읽지 않음
+    output_[4 * kAnchors + 1] = 0.6f;
+    YOLOv8Decoder decoder;
+    decoder.setExtraRows(decoder_.extraRows());
+    std::vector<DetectionCandidate> candidates;
+    decoder.decode(outputMat(), 0.5f, candidates);
+
+    ASSERT_EQ(candidates.size(), 1u);
+    EXPECT_EQ(candidates[0].class_id, 0);
+    EXPECT_EQ(candidates[0].anchor, 1);
+    EXPECT_FLOAT_EQ(candidates[0].score, 0.6f);
+}
+} // namespace vp::adapter::out
@@ -0,0 +1,193 @@
+#include "letterbox_preprocessor.hpp"
+#include <gtest/gtest.h>
+#include <opencv2/dnn.hpp>
+#include <opencv2/imgproc.hpp>
+
+namespace vp::adapter::out
+{
+class LetterboxPreprocessorTest : public ::testing::Test
+{
+protected:
+    static constexpr int kTargetW = 640;
+    static constexpr int kTargetH = 640;
+
+    static cv::Mat makeImage(int width, int height, int type)
+    {
+        cv::Mat img(height, width, type);
+        cv::randu(img, cv::Scalar::all(0), cv::Scalar::all(255));
+        return img;
+    }
+
+    // 기존 전처리 경로 (cvtColor -> resize -> 114 캔버스 -> blobFromImage)
+    static cv::Mat referenceBlob(const cv::Mat &src, int color_code)
+    {
+        cv::Mat rgb;
+        if (color_code >= 0)
+        {
+            cv::cvtColor(src, rgb, color_code);
+        }
+        else
+        {
+            rgb = src;
+        }
+
+        const float scale = std::min(static_cast<float>(kTargetW) / rgb.cols, static_cast<float>(kTargetH) / rgb.rows);
+        const int new_w = static_cast<int>(std::round(rgb.cols * scale));
+        const int new_h = static_cast<int>(std::round(rgb.rows * scale));
+
+        cv::Mat resized;
+        cv::resize(rgb, resized, cv::Size(new_w, new_h));
+
+        cv::Mat canvas(kTargetH, kTargetW, CV_8UC3, cv::Scalar(114, 114, 114));
+        resized.copyTo(canvas(cv::Rect((kTargetW - new_w) / 2, (kTargetH - new_h) / 2, new_w, new_h)));
+
+        return cv::dnn::blobFromImage(canvas, 1.0 / 255.0, cv::Size(), cv::Scalar(), false, false);
+    }
+
+    static double maxAbsDiff(const cv::Mat &a, const cv::Mat &b)
+    {
+        EXPECT_EQ(a.total(), b.total());
+        const cv::Mat flat_a(1, static_cast<int>(a.total()), CV_32F, const_cast<uchar *>(a.data));
+        const cv::Mat flat_b(1, static_cast<int>(b.total()), CV_32F, const_cast<uchar *>(b.data));
+        return cv::norm(flat_a, flat_b, cv::NORM_INF);
+    }
+
+    // cv::resize 는 8bit 고정소수점으로 보간하므로 1 LSB 차이 허용
+    static constexpr double kTolerance = 1.5 / 255.0;
+
+    LetterboxPreprocessor preprocessor_;
+};
+
+TEST_F(LetterboxPreprocessorTest, ShouldMatchReferenceForBgrInput)
+{
+    auto img = makeImage(1280, 720, CV_8UC3);
+
+    LetterboxInfo info;
+    const auto &blob = preprocessor_.run(img, true, kTargetW, kTargetH, info);
+
+    EXPECT_FLOAT_EQ(info.scale, 0.5f);
+    EXPECT_EQ(info.pad_x, 0);
+    EXPECT_EQ(info.pad_y, 140);
+    EXPECT_LE(maxAbsDiff(blob, referenceBlob(img, cv::COLOR_BGR2RGB)), kTolerance);
+}
+
+TEST_F(LetterboxPreprocessorTest, ShouldMatchReferenceForMonoInput)
+{
+    auto img = makeImage(752, 480, CV_8UC1);
+
+    LetterboxInfo info;
+    const auto &blob = preprocessor_.run(img, false, kTargetW, kTargetH, info);
+
+    EXPECT_LE(maxAbsDiff(blob, referenceBlob(img, cv::COLOR_GRAY2RGB)), kTolerance);
+}
+
+TEST_F(LetterboxPreprocessorTest, ShouldReuseBufferAndRefreshOnGeometryChange)
+{
+    auto img = makeImage(1280, 720, CV_8UC3);
+
+    LetterboxInfo info;
+    const float *first = preprocessor_.run(img, false, kTargetW, kTargetH, info).ptr<float>();
+    const float *second = preprocessor_.run(img, false, kTargetW, kTargetH, info).ptr<float>();
+    EXPECT_EQ(first, second);
+
+    // 세로가 긴 입력으로 바뀌면 좌우 패딩으로 전환되어야 함
+    auto portrait = makeImage(480, 960, CV_8UC3);
+    const auto &blob = preprocessor_.run(portrait, false, kTargetW, kTargetH, info);
+    EXPECT_EQ(info.pad_y, 0);
+    EXPECT_EQ(info.pad_x, 160);
+    EXPECT_LE(maxAbsDiff(blob, referenceBlob(portrait, -1)), kTolerance);
+}
+
+TEST_F(LetterboxPreprocessorTest, ShouldPackImagesOfDifferentSizesIntoOneBatch)
+{
+    auto bgr = makeImage(1280, 720, CV_8UC3);
+    auto mono = makeImage(752, 480, CV_8UC1);
+
+    LetterboxPreprocessor single_bgr;
+    LetterboxPreprocessor single_mono;
+    LetterboxInfo info;
+    const auto expected_bgr = single_bgr.run(bgr, true, kTargetW, kTargetH, info).clone();
+    const auto expected_mono = single_mono.run(mono, false, kTargetW, kTargetH, info).clone();
+
+    std::vector<LetterboxInfo> infos;
+    const auto &blob = preprocessor_.runBatch({{bgr, true}, {mono, false}}, kTargetW, kTargetH, infos);
+
+    ASSERT_EQ(blob.size[0], 2);
+    ASSERT_EQ(infos.size(), 2u);
+    EXPECT_EQ(infos[1].pad_y, info.pad_y);
+
+    const size_t image_size = 3 * static_cast<size_t>(kTargetW) * kTargetH;
+    const auto *data = blob.ptr<float>();
+    EXPECT_TRUE(std::equal(data, data + image_size, expected_bgr.ptr<float>()));
+    EXPECT_TRUE(std::equal(data + image_size, data + 2 * image_size, expected_mono.ptr<float>()));
+}
+
+TEST_F(LetterboxPreprocessorTest, ShouldQuantizeOutputWithTensorSpec)
+{
+    auto img = makeImage(1280, 720, CV_8UC3);
+
+    LetterboxPreprocessor float_preprocessor;
+    LetterboxInfo info;
+    const auto expected = float_preprocessor.run(img, true, kTargetW, kTargetH, info).clone();
+    const auto *reference = expected.ptr<float>();
+
+    // INT8 (zero_point -128): 패딩 114 -> -14
+    const TensorSpec spec{CV_8S, 1.0f / 255.0f, -128};
+    preprocessor_.setTensorSpec(spec);
+    const auto &blob = preprocessor_.run(img, true, kTargetW, kTargetH, info);
+    ASSERT_EQ(blob.depth(), CV_8S);
+    ASSERT_EQ(blob.total(), expected.total());
+
+    const auto *quantized = blob.ptr<schar>();
+    EXPECT_EQ(quantized[0], -14);
+    int max_diff = 0;
+    for (size_t i = 0; i < blob.total(); ++i)
+    {
+        const int q = cvRound(reference[i] / spec.scale) + spec.zero_point;
+        max_diff = std::max(max_diff, std::abs(q - quantized[i]));
+    }
+    EXPECT_LE(max_diff, 1);
+}
+
+TEST_F(LetterboxPreprocessorTest, ShouldWriteHalfPrecisionTensor)
+{
+    auto img = makeImage(752, 480, CV_8UC1);
+
+    LetterboxPreprocessor float_preprocessor;
+    LetterboxInfo info;
+    const auto expected = float_preprocessor.run(img, false, kTargetW, kTargetH, info).clone();
+
+    preprocessor_.setTensorSpec({CV_16F});
+    const auto &blob = preprocessor_.run(img, false, kTargetW, kTargetH, info);
+    ASSERT_EQ(blob.depth(), CV_16F);
+
+    const auto *half = blob.ptr<cv::float16_t>();
+    const auto *reference = expected.ptr<float>();
+    float max_diff = 0.0f;
+    for (size_t i = 0; i < blob.total(); ++i)
+    {
+        max_diff = std::max(max_diff, std::abs(static_cast<float>(half[i]) - reference[i]));
+    }
+    EXPECT_LE(max_diff, 1e-3f); // FP16 유효 자릿수 (1.0 부근 2^-11)
+}
+
+TEST_F(LetterboxPreprocessorTest, ShouldFitRectangularInputToStride)
+{
+    const cv::Size max_size(kTargetW, kTargetH);
+    EXPECT_EQ(LetterboxPreprocessor::fitInputSize({1920, 1080}, max_size, 32), cv::Size(640, 384));
+    EXPECT_EQ(LetterboxPreprocessor::fitInputSize({1280, 720}, max_size, 32), cv::Size(640, 384));
+    EXPECT_EQ(LetterboxPreprocessor::fitInputSize({752, 480}, max_size, 32), cv::Size(640, 416));
+    EXPECT_EQ(LetterboxPreprocessor::fitInputSize({480, 960}, max_size, 32), cv::Size(320, 640));
+    EXPECT_EQ(LetterboxPreprocessor::fitInputSize({1280, 640}, max_size, 32), cv::Size(640, 320));
+    EXPECT_EQ(LetterboxPreprocessor::fitInputSize({640, 640}, max_size, 32), max_size);
+
+    // 직사각형 입력은 짧은 변의 패딩만 stride 맞춤분으로 남음
+    auto img = makeImage(1920, 1080, CV_8UC3);
+    LetterboxInfo info;
+    const auto &blob = preprocessor_.run(img, false, 640, 384, info);
+    EXPECT_EQ(blob.size[2], 384);
+    EXPECT_EQ(blob.size[3], 640);
+    EXPECT_EQ(info.resized_h, 360);
+    EXPECT_EQ(info.pad_y, 12);
+}
+} // namespace vp::adapter::out
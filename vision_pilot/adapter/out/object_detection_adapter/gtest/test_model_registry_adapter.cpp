@@ -0,0 +1,240 @@
+#include "model_registry_adapter_impl.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace vp::adapter::out
+{
+namespace
+{
+using vp::domain::model::ClassId;
+using vp::domain::model::Detection;
+using vp::domain::model::ImagePacket;
+
+// 모델마다 정해진 탐지 결과를 돌려주고 실행한 frame_id 와 동시 실행 수를 기록
+struct FakeModelState
+{
+    std::vector<Detection> detections;
+    int delay_ms = 0;
+    bool fail = false; // true: 추론 중 예외 (백엔드 오류)
+    bool reduced = false; // REDUCED 탐지 지원 (경량 모델)
+    std::mutex mutex;
+    std::vector<uint64_t> frames;
+};
+
+class FakeRegistryDetector : public RegistryDetector
+{
+public:
+    FakeRegistryDetector(FakeModelState &state, std::atomic<int> &running, std::atomic<int> &max_running)
+        : state_(state), running_(running), max_running_(max_running) {}
+
+    bool initialize() override { return true; }
+    cv::Size inputSize() const override { return cv::Size(640, 640); }
+    TensorSpec inputSpec() const override { return {}; }
+    void setSharedPreprocessor(SharedPreprocessor * /* preprocessor */) override {}
+    bool reloadModel(const std::string & /* model_path */) override { return true; }
+    bool supportsLevel(vp::port::out::DetectionLevel level) const override { return level == vp::port::out::DetectionLevel::FULL || state_.reduced; }
+
+    std::vector<std::vector<Detection>> detectObjects(const std::vector<const ImagePacket *> &images, vp::port::out::DetectionLevel /* level */) override
+    {
+        const int now = ++running_;
+        int previous = max_running_.load();
+        while (previous < now && !max_running_.compare_exchange_weak(previous, now))
+        {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(state_.delay_ms));
+        --running_;
+        if (state_.fail)
+        {
+            throw std::runtime_error("inference failed");
+        }
+
+        std::lock_guard<std::mutex> lock(state_.mutex);
+        for (const auto *image : images)
+        {
+            state_.frames.push_back(image->frame_id);
+        }
+        return std::vector<std::vector<Detection>>(images.size(), state_.detections);
+    }
+
+    std::vector<Detection> detectObjectInRegions(const ImagePacket &image, const std::vector<vp::domain::model::BoundingBox> & /* regions */,
+                                                 vp::port::out::DetectionLevel level) override
+    {
+        return this->detectObjects({&image}, level).front();
+    }
+
+private:
+    FakeModelState &state_;
+    std::atomic<int> &running_;
+    std::atomic<int> &max_running_;
+};
+} // namespace
+
+class ModelRegistryAdapterTest : public ::testing::Test
+{
+protected:
+    void addModel(const std::string &name, std::vector<Detection> detections, uint32_t min_interval_ms = 0)
+    {
+        config::DetectorModelConfig model;
+        model.name = name;
+        model.minIntervalMs = min_interval_ms;
+        config_.models.push_back(model);
+        states_.push_back(std::make_unique<FakeModelState>());
+        states_.back()->detections = std::move(detections);
+    }
+
+    std::unique_ptr<ModelRegistryAdapterImpl> makeRegistry()
+    {
+        auto registry = std::make_unique<ModelRegistryAdapterImpl>(config_, [this](const config::DetectorModelConfig &model)
+                                                                   {
+            const auto index = static_cast<size_t>(&model - config_.models.data());
+            return std::make_unique<FakeRegistryDetector>(*states_[index], running_, max_running_); });
+        EXPECT_TRUE(registry->initialize());
+        return registry;
+    }
+
+    // 읽은 시각은 흔들고 소스 시각은 33 ms 간격
+    static ImagePacket makeFrame(uint64_t frame_id, uint64_t wall_jitter_ms)
+    {
+        ImagePacket packet;
+        packet.frame_id = frame_id;
+        packet.timestamp = frame_id * 5 + wall_jitter_ms;
+        packet.source_time = frame_id * 33;
+        return packet;
+    }
+
+    static size_t countModel(const std::vector<Detection> &detections, uint8_t model)
+    {
+        return static_cast<size_t>(std::count_if(detections.begin(), detections.end(), [&](const Detection &d)
+                                                 { return d.model == model; }));
+    }
+
+    config::ModelRegistryConfig config_;
+    std::vector<std::unique_ptr<FakeModelState>> states_;
+    std::atomic<int> running_{0};
+    std::atomic<int> max_running_{0};
+};
+
+TEST_F(ModelRegistryAdapterTest, ShouldScheduleByIntervalOnSourceTime)
+{
+    addModel("general", {{ClassId::CAR, 0.9f, {0.0f, 0.0f, 10.0f, 10.0f}}});
+    addModel("sign", {{ClassId::STOP_SIGN, 0.8f, {50.0f, 50.0f, 10.0f, 10.0f}}}, 100);
+    config_.models[1].holdResults = false;
+
+    for (uint64_t jitter_seed = 0; jitter_seed < 2; ++jitter_seed)
+    {
+        auto registry = makeRegistry();
+        for (uint64_t id = 1; id <= 12; ++id)
+        {
+            const auto detections = registry->detectObject(makeFrame(id, (id * 37 + jitter_seed * 211) % 400), vp::port::out::DetectionLevel::FULL);
+            EXPECT_EQ(countModel(detections, 0), 1u) << "frame " << id;
+        }
+        registry.reset();
+
+        // 33 ms 간격 프레임에서 100 ms 간격 -> 4 프레임마다 (읽은 시각과 무관)
+        std::lock_guard<std::mutex> lock(states_[1]->mutex);
+        EXPECT_EQ(states_[1]->frames, (std::vector<uint64_t>{1, 5, 9}));
+        states_[1]->frames.clear();
+    }
+}
+
+TEST_F(ModelRegistryAdapterTest, ShouldHoldLastResultsOnSkippedFrames)
+{
+    addModel("general", {{ClassId::CAR, 0.9f, {0.0f, 0.0f, 10.0f, 10.0f}}});
+    addModel("sign", {{ClassId::STOP_SIGN, 0.8f, {50.0f, 50.0f, 10.0f, 10.0f}}}, 100);
+
+    // 한 호출에 여러 프레임이 들어와도 건너뛴 프레임은 직전 실행 결과를 사용
+    std::vector<ImagePacket> frames;
+    for (uint64_t id = 1; id <= 6; ++id)
+    {
+        frames.push_back(makeFrame(id, 0));
+    }
+    std::vector<const ImagePacket *> batch = {&frames[0], &frames[1], &frames[2]};
+
+    auto registry = makeRegistry();
+    auto results = registry->detectObjects(batch, vp::port::out::DetectionLevel::FULL);
+    for (const auto &detections : results)
+    {
+        EXPECT_EQ(countModel(detections, 1), 1u);
+    }
+    for (size_t i = 3; i < frames.size(); ++i)
+    {
+        EXPECT_EQ(countModel(registry->detectObject(frames[i], vp::port::out::DetectionLevel::FULL), 1), 1u) << "frame " << frames[i].frame_id;
+    }
+
+    std::lock_guard<std::mutex> lock(states_[1]->mutex);
+    EXPECT_EQ(states_[1]->frames, (std::vector<uint64_t>{1, 5}));
+}
+
+TEST_F(ModelRegistryAdapterTest, ShouldMapClassesAndMergeDuplicates)
+{
+    addModel("general", {{ClassId::CAR, 0.6f, {0.0f, 0.0f, 100.0f, 100.0f}},
+                         {ClassId::PERSON, 0.7f, {200.0f, 0.0f, 50.0f, 100.0f}}});
+    // 특화 모델 클래스 0 -> CAR, 1 -> 제외, 2 -> TRAFFIC_LIGHT
+    addModel("special", {{static_cast<ClassId>(0), 0.8f, {2.0f, 2.0f, 100.0f, 100.0f}},
+                         {static_cast<ClassId>(1), 0.9f, {300.0f, 0.0f, 20.0f, 20.0f}},
+                         {static_cast<ClassId>(2), 0.5f, {400.0f, 0.0f, 10.0f, 30.0f}}});
+    config_.models[1].classMap = {static_cast<int>(ClassId::CAR), -1, static_cast<int>(ClassId::TRAFFIC_LIGHT)};
+    config_.mergeIou = 0.7f;
+
+    auto registry = makeRegistry();
+    const auto detections = registry->detectObject(makeFrame(1, 0), vp::port::out::DetectionLevel::FULL);
+
+    ASSERT_EQ(detections.size(), 3u);
+    // 겹치는 CAR 는 점수가 높은 특화 모델 결과만 남음
+    EXPECT_EQ(detections[0].class_id, ClassId::CAR);
+    EXPECT_FLOAT_EQ(detections[0].confidence, 0.8f);
+    EXPECT_EQ(detections[0].model, 1);
+    EXPECT_EQ(detections[1].class_id, ClassId::PERSON);
+    EXPECT_EQ(detections[1].model, 0);
+    EXPECT_EQ(detections[2].class_id, ClassId::TRAFFIC_LIGHT);
+    EXPECT_EQ(detections[2].model, 1);
+}
+
+TEST_F(ModelRegistryAdapterTest, ShouldRunModelsOfSameInputGroupConcurrently)
+{
+    addModel("general", {{ClassId::CAR, 0.9f, {0.0f, 0.0f, 10.0f, 10.0f}}});
+    addModel("sign", {{ClassId::STOP_SIGN, 0.8f, {50.0f, 50.0f, 10.0f, 10.0f}}});
+    config_.numWorkers = 2;
+    states_[0]->delay_ms = 30;
+    states_[1]->delay_ms = 30;
+
+    auto registry = makeRegistry();
+    const auto detections = registry->detectObject(makeFrame(1, 0), vp::port::out::DetectionLevel::FULL);
+
+    EXPECT_EQ(detections.size(), 2u);
+    EXPECT_EQ(max_running_.load(), 2);
+}
+
+TEST_F(ModelRegistryAdapterTest, ShouldPropagateModelExceptionToCaller)
+{
+    addModel("general", {{ClassId::CAR, 0.9f, {0.0f, 0.0f, 10.0f, 10.0f}}});
+    addModel("sign", {{ClassId::STOP_SIGN, 0.8f, {50.0f, 50.0f, 10.0f, 10.0f}}});
+    config_.numWorkers = 2;
+    states_[1]->fail = true;
+
+    // 풀 작업 스레드에서 던진 예외도 순서대로 실행할 때처럼 호출 측으로 전달
+    auto registry = makeRegistry();
+    EXPECT_THROW(registry->detectObject(makeFrame(1, 0), vp::port::out::DetectionLevel::FULL), std::runtime_error);
+
+    states_[1]->fail = false;
+    EXPECT_EQ(registry->detectObject(makeFrame(2, 0), vp::port::out::DetectionLevel::FULL).size(), 2u);
+}
+
+TEST_F(ModelRegistryAdapterTest, ShouldReportReducedLevelIfAnyModelSupportsIt)
+{
+    addModel("general", {});
+    addModel("sign", {});
+
+    auto registry = makeRegistry();
+    EXPECT_TRUE(registry->supportsLevel(vp::port::out::DetectionLevel::FULL));
+    EXPECT_FALSE(registry->supportsLevel(vp::port::out::DetectionLevel::REDUCED));
+
+    states_[1]->reduced = true;
+    EXPECT_TRUE(registry->supportsLevel(vp::port::out::DetectionLevel::REDUCED));
+}
+} // namespace vp::adapter::out
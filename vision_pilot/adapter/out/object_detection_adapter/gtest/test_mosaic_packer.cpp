@@ -0,0 +1,118 @@
+#include "mosaic_packer.hpp"
+#include <gtest/gtest.h>
+
+namespace vp::adapter::out
+{
+class MosaicPackerTest : public ::testing::Test
+{
+protected:
+    // 같은 캔버스의 셀끼리 겹치지 않고 캔버스 안에 있는지 확인
+    static void expectNoOverlap(const std::vector<MosaicCell> &cells, const cv::Size &canvas_size)
+    {
+        for (size_t i = 0; i < cells.size(); ++i)
+        {
+            EXPECT_GE(cells[i].dst.x, 0);
+            EXPECT_GE(cells[i].dst.y, 0);
+            EXPECT_LE(cells[i].dst.x + cells[i].dst.width, canvas_size.width);
+            EXPECT_LE(cells[i].dst.y + cells[i].dst.height, canvas_size.height);
+            for (size_t j = i + 1; j < cells.size(); ++j)
+            {
+                if (cells[i].canvas == cells[j].canvas)
+                {
+                    EXPECT_TRUE((cells[i].dst & cells[j].dst).empty()) << i << ", " << j;
+                }
+            }
+        }
+    }
+
+    MosaicPacker packer_;
+    std::vector<MosaicCell> cells_;
+};
+
+TEST_F(MosaicPackerTest, ShouldPackSmallRegionsIntoSingleCanvasAtNativeScale)
+{
+    const std::vector<cv::Rect> regions = {{100, 100, 200, 150}, {900, 300, 120, 240}, {1500, 800, 300, 200}, {10, 900, 64, 64}};
+
+    const int canvases = packer_.pack(regions, cv::Size(1920, 1080), cv::Size(640, 640), cells_);
+
+    EXPECT_EQ(canvases, 1);
+    ASSERT_EQ(cells_.size(), regions.size());
+    expectNoOverlap(cells_, cv::Size(640, 640));
+    for (const auto &cell : cells_)
+    {
+        EXPECT_FLOAT_EQ(cell.scale, 1.0f);
+        EXPECT_EQ(cell.dst.size(), cell.src.size());
+    }
+}
+
+TEST_F(MosaicPackerTest, ShouldOpenNewCanvasWhenFull)
+{
+    const std::vector<cv::Rect> regions(6, cv::Rect(0, 0, 300, 300));
+
+    const int canvases = packer_.pack(regions, cv::Size(1920, 1080), cv::Size(640, 640), cells_);
+
+    // 300 + 8 + 300 <= 640 이므로 캔버스당 2x2
+    EXPECT_EQ(canvases, 2);
+    ASSERT_EQ(cells_.size(), 6u);
+    expectNoOverlap(cells_, cv::Size(640, 640));
+    EXPECT_EQ(cells_.back().canvas, 1);
+}
+
+TEST_F(MosaicPackerTest, ShouldShrinkRegionLargerThanCanvasAndClipToFrame)
+{
+    const std::vector<cv::Rect> regions = {{-100, 200, 1380, 400}};
+
+    const int canvases = packer_.pack(regions, cv::Size(1920, 1080), cv::Size(640, 640), cells_);
+
+    EXPECT_EQ(canvases, 1);
+    ASSERT_EQ(cells_.size(), 1u);
+    EXPECT_EQ(cells_[0].src, cv::Rect(0, 200, 1280, 400));
+    EXPECT_FLOAT_EQ(cells_[0].scale, 0.5f);
+    EXPECT_EQ(cells_[0].dst, cv::Rect(0, 0, 640, 200));
+
+    // 프레임 경계에 닿은 변은 잘린 변이 아님
+    EXPECT_FALSE(cells_[0].cut_left);
+    EXPECT_TRUE(cells_[0].cut_top);
+    EXPECT_TRUE(cells_[0].cut_right);
+    EXPECT_TRUE(cells_[0].cut_bottom);
+}
+
+TEST_F(MosaicPackerTest, ShouldComposeCellsOntoPaddedCanvas)
+{
+    cv::Mat frame(100, 200, CV_8UC1);
+    for (int r = 0; r < frame.rows; ++r)
+    {
+        for (int c = 0; c < frame.cols; ++c)
+        {
+            frame.ptr<uchar>(r)[c] = static_cast<uchar>((r + c) % 100);
+        }
+    }
+    const std::vector<cv::Rect> regions = {{50, 20, 30, 40}, {150, 60, 20, 20}};
+    ASSERT_EQ(packer_.pack(regions, frame.size(), cv::Size(64, 64), cells_), 1);
+
+    cv::Mat canvas;
+    MosaicPacker::compose(frame, cells_, 0, cv::Size(64, 64), 114.0, canvas);
+
+    ASSERT_EQ(canvas.rows, 64);
+    ASSERT_EQ(canvas.cols, 64);
+    for (const auto &cell : cells_)
+    {
+        for (int r = 0; r < cell.dst.height; ++r)
+        {
+            for (int c = 0; c < cell.dst.width; ++c)
+            {
+                ASSERT_EQ(canvas.ptr<uchar>(cell.dst.y + r)[cell.dst.x + c], frame.ptr<uchar>(cell.src.y + r)[cell.src.x + c]);
+            }
+        }
+    }
+    EXPECT_EQ(canvas.ptr<uchar>(63)[63], 114);
+}
+
+TEST_F(MosaicPackerTest, ShouldReturnZeroCanvasesWhenNoRegionInsideFrame)
+{
+    const std::vector<cv::Rect> regions = {{2000, 0, 100, 100}};
+
+    EXPECT_EQ(packer_.pack(regions, cv::Size(1920, 1080), cv::Size(640, 640), cells_), 0);
+    EXPECT_TRUE(cells_.empty());
+}
+} // namespace vp::adapter::out
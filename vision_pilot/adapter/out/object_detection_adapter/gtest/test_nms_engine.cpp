@@ -0,0 +1,120 @@
+#include "nms_engine.hpp"
+#include <gtest/gtest.h>
+
+namespace vp::adapter::out
+{
+class NmsEngineTest : public ::testing::Test
+{
+protected:
+    static DetectionCandidate makeCandidate(float x, float y, float w, float h, float score, int class_id)
+    {
+        return {x + 0.5f * w, y + 0.5f * h, w, h, score, class_id};
+    }
+
+    NmsEngine engine_;
+    NmsOptions options_;
+    std::vector<int> keep_;
+};
+
+TEST_F(NmsEngineTest, ShouldKeepOverlappingBoxesOfDifferentClasses)
+{
+    // 사람과 자전거가 크게 겹치는 경우
+    std::vector<DetectionCandidate> candidates = {
+        makeCandidate(100, 100, 50, 100, 0.9f, 0),
+        makeCandidate(105, 110, 50, 90, 0.8f, 1),
+        makeCandidate(102, 102, 50, 100, 0.7f, 0),
+    };
+
+    engine_.run(candidates, options_, keep_);
+    EXPECT_EQ(keep_, (std::vector<int>{0, 1}));
+
+    options_.per_class = false;
+    engine_.run(candidates, options_, keep_);
+    EXPECT_EQ(keep_, (std::vector<int>{0}));
+}
+
+TEST_F(NmsEngineTest, ShouldKeepDisjointBoxesSortedByScore)
+{
+    std::vector<DetectionCandidate> candidates = {
+        makeCandidate(0, 0, 10, 10, 0.5f, 2),
+        makeCandidate(100, 0, 10, 10, 0.9f, 2),
+        makeCandidate(200, 0, 10, 10, 0.7f, 5),
+    };
+
+    engine_.run(candidates, options_, keep_);
+    EXPECT_EQ(keep_, (std::vector<int>{1, 2, 0}));
+}
+
+TEST_F(NmsEngineTest, ShouldApplyTopKAndMaxDetections)
+{
+    std::vector<DetectionCandidate> candidates;
+    for (int i = 0; i < 10; ++i)
+    {
+        candidates.push_back(makeCandidate(i * 20.0f, 0, 10, 10, 0.3f + 0.05f * i, 0));
+    }
+
+    options_.top_k = 5;
+    engine_.run(candidates, options_, keep_);
+    EXPECT_EQ(keep_, (std::vector<int>{9, 8, 7, 6, 5}));
+
+    options_.top_k = 0;
+    options_.max_detections = 3;
+    engine_.run(candidates, options_, keep_);
+    EXPECT_EQ(keep_, (std::vector<int>{9, 8, 7}));
+}
+
+TEST_F(NmsEngineTest, ShouldDecayScoresWithSoftNms)
+{
+    std::vector<DetectionCandidate> candidates = {
+        makeCandidate(0, 0, 100, 100, 0.9f, 0),
+        makeCandidate(10, 0, 100, 100, 0.8f, 0), // IoU ~0.82
+        makeCandidate(500, 0, 100, 100, 0.6f, 0),
+    };
+
+    options_.method = config::NmsMethod::SOFT_GAUSSIAN;
+    options_.sigma = 0.5f;
+    options_.score_threshold = 0.1f;
+    engine_.run(candidates, options_, keep_);
+
+    // 겹친 박스는 제거되지 않고 점수만 감쇠되어 뒤로 밀림
+    ASSERT_EQ(keep_, (std::vector<int>{0, 2, 1}));
+    EXPECT_FLOAT_EQ(candidates[0].score, 0.9f);
+    EXPECT_FLOAT_EQ(candidates[2].score, 0.6f);
+    EXPECT_LT(candidates[1].score, 0.3f);
+    EXPECT_GT(candidates[1].score, 0.1f);
+
+    // 감쇠 후 기준 미만이면 제거
+    candidates[1].score = 0.8f;
+    options_.score_threshold = 0.3f;
+    engine_.run(candidates, options_, keep_);
+    EXPECT_EQ(keep_, (std::vector<int>{0, 2}));
+}
+
+TEST_F(NmsEngineTest, ShouldApplyClassThresholdsAfterSoftDecay)
+{
+    // 두 클래스 모두 IoU ~0.82 로 겹친 쌍. 감쇠 후 점수는 0.1 ~ 0.3 사이
+    std::vector<DetectionCandidate> candidates = {
+        makeCandidate(0, 0, 100, 100, 0.9f, 0),
+        makeCandidate(10, 0, 100, 100, 0.8f, 0),
+        makeCandidate(0, 300, 100, 100, 0.9f, 1),
+        makeCandidate(10, 300, 100, 100, 0.8f, 1),
+    };
+
+    options_.method = config::NmsMethod::SOFT_GAUSSIAN;
+    options_.sigma = 0.5f;
+    options_.score_threshold = 0.1f;
+    options_.class_thresholds = {-1.0f, 0.5f}; // 클래스 1 만 기준 0.5
+    engine_.run(candidates, options_, keep_);
+
+    // 클래스 0 은 기본 기준으로 남고, 클래스 1 은 자기 기준 미만으로 감쇠되어 제거
+    EXPECT_EQ(keep_, (std::vector<int>{0, 2, 1}));
+}
+
+TEST_F(NmsEngineTest, ShouldHandleEmptyInput)
+{
+    std::vector<DetectionCandidate> candidates;
+    keep_ = {1, 2, 3};
+    engine_.run(candidates, options_, keep_);
+    EXPECT_TRUE(keep_.empty());
+}
+} // namespace vp::adapter::out
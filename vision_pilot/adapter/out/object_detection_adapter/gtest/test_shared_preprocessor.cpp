@@ -0,0 +1,81 @@
+#include "shared_preprocessor.hpp"
+#include <gtest/gtest.h>
+
+namespace vp::adapter::out
+{
+class SharedPreprocessorTest : public ::testing::Test
+{
+protected:
+    static cv::Mat makeImage(int width, int height)
+    {
+        cv::Mat img(height, width, CV_8UC3);
+        cv::randu(img, cv::Scalar::all(0), cv::Scalar::all(255));
+        return img;
+    }
+
+    static bool equal(const cv::Mat &a, const cv::Mat &b)
+    {
+        return a.total() == b.total() && std::equal(a.ptr<float>(), a.ptr<float>() + a.total(), b.ptr<float>());
+    }
+};
+
+TEST_F(SharedPreprocessorTest, ShouldReuseConversionForSameInput)
+{
+    SharedPreprocessor shared;
+    LetterboxPreprocessor reference;
+    const cv::Mat image = makeImage(320, 240);
+    const std::vector<LetterboxInput> inputs = {{image, true}};
+
+    std::vector<LetterboxInfo> first_infos;
+    std::vector<LetterboxInfo> second_infos;
+    const cv::Mat &first = shared.runBatch(inputs, 160, 160, first_infos);
+    const cv::Mat &second = shared.runBatch(inputs, 160, 160, second_infos);
+
+    EXPECT_EQ(&first, &second);
+    EXPECT_EQ(shared.reuseCount(), 1u);
+    ASSERT_EQ(second_infos.size(), 1u);
+    EXPECT_FLOAT_EQ(second_infos[0].scale, first_infos[0].scale);
+    EXPECT_EQ(second_infos[0].pad_y, first_infos[0].pad_y);
+
+    std::vector<LetterboxInfo> reference_infos;
+    EXPECT_TRUE(equal(second, reference.runBatch(inputs, 160, 160, reference_infos)));
+}
+
+TEST_F(SharedPreprocessorTest, ShouldConvertAgainWhenInputChangesOrAfterReset)
+{
+    SharedPreprocessor shared;
+    const cv::Mat image = makeImage(320, 240);
+    std::vector<LetterboxInfo> infos;
+
+    // 색 순서, 출력 크기, 입력 영역이 바뀌면 다시 변환
+    shared.runBatch({{image, true}}, 160, 160, infos);
+    shared.runBatch({{image, false}}, 160, 160, infos);
+    shared.runBatch({{image, false}}, 128, 128, infos);
+    shared.runBatch({{image(cv::Rect(0, 0, 160, 120)), false}}, 128, 128, infos);
+    EXPECT_EQ(shared.reuseCount(), 0u);
+
+    // 같은 버퍼에 다음 프레임이 들어올 수 있으므로 reset 후에는 다시 변환
+    shared.reset();
+    shared.runBatch({{image(cv::Rect(0, 0, 160, 120)), false}}, 128, 128, infos);
+    EXPECT_EQ(shared.reuseCount(), 0u);
+    shared.runBatch({{image(cv::Rect(0, 0, 160, 120)), false}}, 128, 128, infos);
+    EXPECT_EQ(shared.reuseCount(), 1u);
+}
+
+TEST_F(SharedPreprocessorTest, ShouldKeepEarlierConversionsUntilReset)
+{
+    SharedPreprocessor shared;
+    LetterboxPreprocessor reference;
+    const cv::Mat first_image = makeImage(320, 240);
+    const cv::Mat second_image = makeImage(320, 240);
+    std::vector<LetterboxInfo> infos;
+
+    // 다른 모델이 첫 텐서로 추론 중일 수 있으므로 다른 입력 변환이 덮어쓰지 않음
+    const cv::Mat &first = shared.runBatch({{first_image, true}}, 160, 160, infos);
+    const cv::Mat &second = shared.runBatch({{second_image, true}}, 160, 160, infos);
+    EXPECT_NE(&first, &second);
+    EXPECT_TRUE(equal(first, reference.runBatch({{first_image, true}}, 160, 160, infos)));
+    EXPECT_EQ(&shared.runBatch({{first_image, true}}, 160, 160, infos), &first);
+    EXPECT_EQ(shared.reuseCount(), 1u);
+}
+} // namespace vp::adapter::out
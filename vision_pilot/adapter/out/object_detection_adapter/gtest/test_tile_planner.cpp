@@ -0,0 +1,82 @@
+#include "tile_planner.hpp"
+#include <gtest/gtest.h>
+
+namespace vp::adapter::out
+{
+class TilePlannerTest : public ::testing::Test
+{
+protected:
+    // 모든 타일이 프레임 안에 있고 크기가 같은지 확인
+    static void expectInsideFrame(const std::vector<cv::Rect> &tiles, int frame_w, int frame_h, int tile_size)
+    {
+        for (const auto &tile : tiles)
+        {
+            EXPECT_GE(tile.x, 0);
+            EXPECT_GE(tile.y, 0);
+            EXPECT_LE(tile.x + tile.width, frame_w);
+            EXPECT_LE(tile.y + tile.height, frame_h);
+            EXPECT_EQ(tile.width, tile_size);
+            EXPECT_EQ(tile.height, tile_size);
+        }
+    }
+
+    config::TilingConfig config_;
+};
+
+TEST_F(TilePlannerTest, ShouldCoverWholeFrameWithOverlappingTiles)
+{
+    config_.overlap = 0.2f;
+    TilePlanner planner(config_);
+
+    const auto &tiles = planner.plan(3840, 2160);
+
+    // 가로 (3840 - 640) / 512 -> 8 개, 세로 (2160 - 640) / 512 -> 4 개
+    ASSERT_EQ(tiles.size(), 32u);
+    expectInsideFrame(tiles, 3840, 2160, 640);
+    EXPECT_EQ(tiles.front(), cv::Rect(0, 0, 640, 640));
+    EXPECT_EQ(tiles.back(), cv::Rect(3840 - 640, 2160 - 640, 640, 640));
+
+    // 이웃 타일은 최소 overlap 이상 겹침
+    EXPECT_GE(tiles[0].x + tiles[0].width - tiles[1].x, 128);
+}
+
+TEST_F(TilePlannerTest, ShouldTileOnlyConfiguredRegionWithItsDensity)
+{
+    // 지평선 부근 띠만 320 타일로 촘촘하게
+    config::TileRegion horizon;
+    horizon.top = 0.4f;
+    horizon.bottom = 0.55f;
+    horizon.tileSize = 320;
+    config_.regions = {horizon};
+    TilePlanner planner(config_);
+
+    const auto &tiles = planner.plan(1920, 1080);
+
+    // 띠 높이 162 px < 320 이므로 한 줄, 띠 중심에 배치
+    expectInsideFrame(tiles, 1920, 1080, 320);
+    ASSERT_EQ(tiles.size(), 8u);
+    for (const auto &tile : tiles)
+    {
+        EXPECT_EQ(tile.y, 432 + (162 - 320) / 2);
+    }
+}
+
+TEST_F(TilePlannerTest, ShouldSkipTileEqualToFullFrame)
+{
+    TilePlanner planner(config_);
+    EXPECT_TRUE(planner.plan(640, 480).empty());
+
+    config::TilingConfig without_full_frame;
+    without_full_frame.fullFrame = false;
+    TilePlanner tiles_only(without_full_frame);
+    ASSERT_EQ(tiles_only.plan(640, 480).size(), 1u);
+}
+
+TEST_F(TilePlannerTest, ShouldReplanWhenFrameSizeChanges)
+{
+    TilePlanner planner(config_);
+    const auto first = planner.plan(1920, 1080).size();
+    EXPECT_EQ(planner.plan(1920, 1080).size(), first);
+    EXPECT_NE(planner.plan(3840, 2160).size(), first);
+}
+} // namespace vp::adapter::out
@@ -1,11 +1,47 @@
 #include "gaia_dir.hpp"
 #include "yolov8_adapter.hpp"
+#include "yolov8_adapter_impl.hpp"
+#include <chrono>
+#include <cstdio>
 #include <fmt/core.h>
+#include <fstream>
 #include <gtest/gtest.h>
 #include <opencv2/imgcodecs.hpp>
+#include <stdexcept>
+#include <thread>
 
 namespace vp::adapter::out
 {
+namespace
+{
+// 빈 출력을 돌려주다가 throw_at 번째 추론에서 예외 (런타임 오류 흉내)
+class ThrowingBackend : public InferenceBackend
+{
+public:
+    explicit ThrowingBackend(int &throw_at) : throw_at_(throw_at) {}
+
+    bool load(const std::string & /* model_path */) override { return true; }
+    bool empty() const override { return false; }
+    bool infer(const cv::Mat &input, cv::Mat &output) override
+    {
+        if (--throw_at_ == 0)
+        {
+            throw std::runtime_error("inference failed");
+        }
+        const int sizes[] = {input.size[0], 84, 64};
+        output_.create(3, sizes, CV_32F);
+        output_.setTo(cv::Scalar::all(0));
+        output = output_;
+        return true;
+    }
+    const char *name() const override { return "throwing"; }
+
+private:
+    int &throw_at_;
+    cv::Mat output_;
+};
+} // namespace
+
 class YOLOv8AdapterTest : public ::testing::Test
 {
 protected:
@@ -67,4 +103,209 @@ TEST_F(YOLOv8AdapterTest, ShouldDetectObjectsInSampleImage)
         fmt::print("Detected class_id: {} ({}), confidence: {:.2f}, bbox: x={}, y={}, w={}, h={}", static_cast<uint64_t>(det.class_id), domain::model::ClassIdHelper::toString(det.class_id), det.confidence, det.bbox.x, det.bbox.y, det.bbox.width, det.bbox.height);
     }
 }
-} // namespace vp::adapter::out
\ No newline at end of file
+
+TEST_F(YOLOv8AdapterTest, ShouldKeepDetectingWhileReloadingModel)
+{
+    EXPECT_TRUE(adapter_->initialize());
+
+    domain::model::ImagePacket image_packet;
+    image_packet.encoding = domain::model::ImageEncoding::MONO8;
+    domain::model::MonoImagePacket payload;
+    payload.frame.channels = 1;
+    payload.frame.width = 640;
+    payload.frame.height = 480;
+    payload.frame.step = 640;
+    payload.frame.data.assign(640 * 480, 0);
+    image_packet.payload = payload;
+
+    EXPECT_FALSE(adapter_->reloadModel("not_exist.onnx"));
+    ASSERT_TRUE(adapter_->reloadModel(config_.modelPath));
+    EXPECT_FALSE(adapter_->reloadModel(config_.modelPath)); // 교체 중 중복 요청
+
+    // 새 모델이 준비될 때까지 기존 모델로 탐지 계속
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (adapter_->isReloading() && std::chrono::steady_clock::now() < deadline)
+    {
+        adapter_->detectObject(image_packet);
+    }
+    ASSERT_FALSE(adapter_->isReloading());
+
+    // 다음 호출에서 새 모델로 전환
+    EXPECT_TRUE(adapter_->detectObject(image_packet).empty());
+    EXPECT_TRUE(adapter_->reloadModel(config_.modelPath));
+}
+
+TEST_F(YOLOv8AdapterTest, ShouldKeepCurrentModelWhenReplacementIsBroken)
+{
+    std::string project_root = "/home/gbkim/project/VisionPilot";
+    std::string image_path = joinDir(project_root, "vision_pilot/res/etc/sample.png");
+    ASSERT_TRUE(isFileExist(image_path)) << "Test image not found: " << image_path;
+    cv::Mat img = cv::imread(image_path, cv::IMREAD_GRAYSCALE);
+
+    domain::model::ImagePacket image_packet;
+    image_packet.encoding = domain::model::ImageEncoding::MONO8;
+    domain::model::MonoImagePacket payload;
+    payload.frame.channels = 1;
+    payload.frame.width = img.cols;
+    payload.frame.height = img.rows;
+    payload.frame.step = static_cast<int>(img.step);
+    payload.frame.data.assign(img.data, img.data + (img.total() * img.elemSize()));
+    image_packet.payload = payload;
+
+    ASSERT_TRUE(adapter_->initialize());
+    const auto expected = adapter_->detectObject(image_packet);
+    ASSERT_FALSE(expected.empty());
+
+    // 파일은 있지만 모델이 아님 -> 요청은 받지만 워밍업에서 거부되고 기존 모델 유지
+    const std::string broken_path = "broken_model.onnx";
+    {
+        std::ofstream ofs(broken_path);
+        ofs << "not a model";
+    }
+    ASSERT_TRUE(adapter_->reloadModel(broken_path));
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (adapter_->isReloading() && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_FALSE(adapter_->isReloading());
+    std::remove(broken_path.c_str());
+
+    EXPECT_EQ(adapter_->detectObject(image_packet).size(), expected.size());
+
+    // 초기화되지 않은 어댑터는 교체 요청을 받지 않음
+    config::YoloConfig missing_config = config_;
+    missing_config.modelPath = "not_exist.onnx";
+    YOLOv8Adapter missing(missing_config);
+    EXPECT_FALSE(missing.initialize());
+    EXPECT_FALSE(missing.reloadModel(config_.modelPath));
+}
+
+TEST_F(YOLOv8AdapterTest, ShouldMatchSequentialResultsWhenOverlappingStages)
+{
+    std::string project_root = "/home/gbkim/project/VisionPilot";
+    std::string image_path = joinDir(project_root, "vision_pilot/res/etc/sample.png");
+    ASSERT_TRUE(isFileExist(image_path)) << "Test image not found: " << image_path;
+    cv::Mat img = cv::imread(image_path, cv::IMREAD_GRAYSCALE);
+
+    domain::model::ImagePacket image_packet;
+    image_packet.encoding = domain::model::ImageEncoding::MONO8;
+    domain::model::MonoImagePacket payload;
+    payload.frame.channels = 1;
+    payload.frame.width = img.cols;
+    payload.frame.height = img.rows;
+    payload.frame.step = static_cast<int>(img.step);
+    payload.frame.data.assign(img.data, img.data + (img.total() * img.elemSize()));
+    image_packet.payload = payload;
+
+    // 타일 + 한 장씩 배치 -> 한 호출 안에 배치가 여러 개 생겨 단계가 겹침
+    config::YoloConfig sequential_config = config_;
+    sequential_config.tiling.enable = true;
+    sequential_config.tiling.regions.push_back({0.0f, 0.0f, 1.0f, 1.0f, 320});
+    sequential_config.maxBatchSize = 1;
+    config::YoloConfig pipelined_config = sequential_config;
+    pipelined_config.pipelineOverlap = true;
+
+    YOLOv8Adapter sequential(sequential_config);
+    YOLOv8Adapter pipelined(pipelined_config);
+    ASSERT_TRUE(sequential.initialize());
+    ASSERT_TRUE(pipelined.initialize());
+
+    const auto expected = sequential.detectObject(image_packet);
+    for (int run = 0; run < 3; ++run)
+    {
+        const auto detections = pipelined.detectObject(image_packet);
+        ASSERT_EQ(detections.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            EXPECT_EQ(detections[i].class_id, expected[i].class_id);
+            EXPECT_FLOAT_EQ(detections[i].confidence, expected[i].confidence);
+            EXPECT_FLOAT_EQ(detections[i].bbox.x, expected[i].bbox.x);
+            EXPECT_FLOAT_EQ(detections[i].bbox.y, expected[i].bbox.y);
+        }
+    }
+}
+
+TEST_F(YOLOv8AdapterTest, ShouldPropagateInferenceExceptionWhenOverlappingStages)
+{
+    const std::string model_path = "throwing_model.onnx";
+    {
+        std::ofstream ofs(model_path);
+        ofs << "fake";
+    }
+    std::vector<domain::model::ImagePacket> packets(4);
+    std::vector<const domain::model::ImagePacket *> images;
+    for (auto &packet : packets)
+    {
+        domain::model::MonoImagePacket payload;
+        payload.frame.channels = 1;
+        payload.frame.width = 64;
+        payload.frame.height = 48;
+        payload.frame.step = 64;
+        payload.frame.data.assign(64 * 48, 0);
+        packet.encoding = domain::model::ImageEncoding::MONO8;
+        packet.payload = payload;
+        images.push_back(&packet);
+    }
+
+    // 한 장씩 배치 4 개 -> 단계 겹침 사용. 순차 처리와 같이 예외가 호출 측으로 전달되고 이후 호출은 정상 동작
+    config::YoloConfig base_config = config_;
+    base_config.modelPath = model_path;
+    base_config.inputWidth = 64;
+    base_config.inputHeight = 64;
+    base_config.warmupRuns = 0;
+    base_config.maxBatchSize = 1;
+    for (const bool overlap : {false, true})
+    {
+        config::YoloConfig config = base_config;
+        config.pipelineOverlap = overlap;
+        int throw_at = 0;
+        YOLOv8AdapterImpl adapter(config, [&](const config::YoloConfig &)
+                                  { return std::make_unique<ThrowingBackend>(throw_at); });
+        ASSERT_TRUE(adapter.initialize());
+
+        throw_at = 3;
+        EXPECT_THROW(adapter.detectObjects(images, vp::port::out::DetectionLevel::FULL), std::runtime_error) << "overlap " << overlap;
+        throw_at = 0;
+        EXPECT_EQ(adapter.detectObjects(images, vp::port::out::DetectionLevel::FULL).size(), images.size());
+    }
+    std::remove(model_path.c_str());
+}
+
+TEST_F(YOLOv8AdapterTest, ShouldReportReducedLevelOnlyWhenItIsLighter)
+{
+    const std::string model_path = "reduced_level_model.onnx";
+    {
+        std::ofstream ofs(model_path);
+        ofs << "fake";
+    }
+    config::YoloConfig base_config = config_;
+    base_config.modelPath = model_path;
+    base_config.warmupRuns = 0;
+
+    // 경량 모델/동적 입력/타일 분할이 모두 없으면 REDUCED 도 같은 탐지
+    const auto supportsReduced = [&](const config::YoloConfig &config)
+    {
+        int throw_at = 0;
+        YOLOv8AdapterImpl adapter(config, [&](const config::YoloConfig &)
+                                  { return std::make_unique<ThrowingBackend>(throw_at); });
+        EXPECT_TRUE(adapter.initialize());
+        EXPECT_TRUE(adapter.supportsLevel(vp::port::out::DetectionLevel::FULL));
+        return adapter.supportsLevel(vp::port::out::DetectionLevel::REDUCED);
+    };
+    EXPECT_FALSE(supportsReduced(base_config));
+
+    config::YoloConfig reduced_config = base_config;
+    reduced_config.reducedModelPath = model_path;
+    EXPECT_TRUE(supportsReduced(reduced_config));
+
+    config::YoloConfig dynamic_config = base_config;
+    dynamic_config.dynamicInput = true;
+    EXPECT_TRUE(supportsReduced(dynamic_config));
+
+    config::YoloConfig tiling_config = base_config;
+    tiling_config.tiling.enable = true;
+    EXPECT_TRUE(supportsReduced(tiling_config));
+    std::remove(model_path.c_str());
+}
+} // namespace vp::adapter::out
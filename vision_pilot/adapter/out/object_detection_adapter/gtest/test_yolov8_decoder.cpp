@@ -0,0 +1,338 @@
+#include "yolov8_decoder.hpp"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <random>
+
+namespace vp::adapter::out
+{
+class YOLOv8DecoderTest : public ::testing::Test
+{
+protected:
+    static constexpr int kClasses = 80;
+    static constexpr int kDims = 4 + kClasses;
+
+    // 점수는 대부분 낮고 일부 앵커만 기준을 넘도록 생성
+    cv::Mat makeOutput(int anchors, float hit_ratio)
+    {
+        const int sizes[] = {1, kDims, anchors};
+        data_.assign(static_cast<size_t>(kDims) * anchors, 0.0f);
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> coord(0.0f, 640.0f);
+        std::uniform_real_distribution<float> low(0.0f, 0.2f);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        std::uniform_int_distribution<int> cls(0, kClasses - 1);
+
+        for (int a = 0; a < anchors; ++a)
+        {
+            for (int d = 0; d < 4; ++d)
+            {
+                data_[static_cast<size_t>(d) * anchors + a] = coord(rng);
+            }
+            for (int c = 0; c < kClasses; ++c)
+            {
+                data_[static_cast<size_t>(4 + c) * anchors + a] = low(rng);
+            }
+            if (unit(rng) < hit_ratio)
+            {
+                data_[static_cast<size_t>(4 + cls(rng)) * anchors + a] = 0.3f + 0.7f * unit(rng);
+            }
+        }
+        return cv::Mat(3, sizes, CV_32F, data_.data());
+    }
+
+    // 기존 스칼라 후처리와 같은 방식의 기준 구현
+    static std::vector<DetectionCandidate> referenceDecode(const cv::Mat &output, float conf_threshold)
+    {
+        const int dimensions = output.size[1];
+        const int rows = output.size[2];
+        const auto *pdata = output.ptr<float>();
+
+        std::vector<DetectionCandidate> result;
+        for (int r = 0; r < rows; ++r)
+        {
+            float max_conf = pdata[4 * rows + r];
+            int max_class_id = 0;
+            for (int c = 5; c < dimensions; ++c)
+            {
+                const float score = pdata[c * rows + r];
+                if (score > max_conf)
+                {
+                    max_conf = score;
+                    max_class_id = c - 4;
+                }
+            }
+            if (max_conf >= conf_threshold)
+            {
+                result.push_back({pdata[r], pdata[rows + r], pdata[2 * rows + r], pdata[3 * rows + r], max_conf, max_class_id});
+            }
+        }
+        return result;
+    }
+
+    // 허용 클래스 중 자기 기준을 넘은 클래스의 최대 점수 클래스를 고르는 기준 구현
+    static std::vector<DetectionCandidate> referenceDecodeFiltered(const cv::Mat &output, const std::vector<int> &classes,
+                                                                   const std::vector<float> &thresholds)
+    {
+        const int rows = output.size[2];
+        const auto *pdata = output.ptr<float>();
+
+        std::vector<DetectionCandidate> result;
+        for (int r = 0; r < rows; ++r)
+        {
+            float max_conf = -1.0f;
+            int max_class_id = -1;
+            for (int c : classes)
+            {
+                const float score = pdata[(4 + c) * rows + r];
+                if (score >= thresholds[c] && score > max_conf)
+                {
+                    max_conf = score;
+                    max_class_id = c;
+                }
+            }
+            if (max_class_id >= 0)
+            {
+                result.push_back({pdata[r], pdata[rows + r], pdata[2 * rows + r], pdata[3 * rows + r], max_conf, max_class_id});
+            }
+        }
+        return result;
+    }
+
+    static void expectSame(const std::vector<DetectionCandidate> &actual, const std::vector<DetectionCandidate> &expected)
+    {
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t i = 0; i < actual.size(); ++i)
+        {
+            EXPECT_EQ(actual[i].class_id, expected[i].class_id) << "index " << i;
+            EXPECT_FLOAT_EQ(actual[i].score, expected[i].score) << "index " << i;
+            EXPECT_FLOAT_EQ(actual[i].cx, expected[i].cx) << "index " << i;
+            EXPECT_FLOAT_EQ(actual[i].cy, expected[i].cy) << "index " << i;
+            EXPECT_FLOAT_EQ(actual[i].w, expected[i].w) << "index " << i;
+            EXPECT_FLOAT_EQ(actual[i].h, expected[i].h) << "index " << i;
+        }
+    }
+
+    std::vector<float> data_;
+    YOLOv8Decoder decoder_;
+};
+
+TEST_F(YOLOv8DecoderTest, ShouldMatchScalarDecodeOnStandardOutput)
+{
+    auto output = this->makeOutput(8400, 0.01f);
+
+    std::vector<DetectionCandidate> candidates;
+    decoder_.decode(output, 0.25f, candidates);
+
+    EXPECT_FALSE(candidates.empty());
+    expectSame(candidates, referenceDecode(output, 0.25f));
+}
+
+TEST_F(YOLOv8DecoderTest, ShouldHandleAnchorCountNotMultipleOfBlock)
+{
+    // 320x320 입력: 2100 앵커. 마지막 블록과 SIMD 나머지 처리 경로 확인
+    auto output = this->makeOutput(2100 + 3, 0.05f);
+
+    std::vector<DetectionCandidate> candidates;
+    decoder_.decode(output, 0.25f, candidates);
+
+    expectSame(candidates, referenceDecode(output, 0.25f));
+}
+
+TEST_F(YOLOv8DecoderTest, ShouldKeepFirstClassOnTie)
+{
+    auto output = this->makeOutput(16, 0.0f);
+    const int anchors = 16;
+    data_[static_cast<size_t>(4 + 3) * anchors + 5] = 0.9f;
+    data_[static_cast<size_t>(4 + 10) * anchors + 5] = 0.9f;
+
+    std::vector<DetectionCandidate> candidates;
+    decoder_.decode(output, 0.25f, candidates);
+
+    ASSERT_EQ(candidates.size(), 1u);
+    EXPECT_EQ(candidates[0].class_id, 3);
+}
+
+TEST_F(YOLOv8DecoderTest, ShouldReturnEmptyWhenNothingPassesThreshold)
+{
+    auto output = this->makeOutput(8400, 0.0f);
+
+    std::vector<DetectionCandidate> candidates(10);
+    decoder_.decode(output, 0.25f, candidates);
+
+    EXPECT_TRUE(candidates.empty());
+}
+
+TEST_F(YOLOv8DecoderTest, ShouldDecodeSelectedImageOfBatchOutput)
+{
+    constexpr int kAnchors = 2100;
+    auto single = this->makeOutput(kAnchors, 0.05f);
+    auto expected = referenceDecode(single, 0.25f);
+
+    // 두 번째 이미지 자리에 같은 출력을 두고 첫 번째는 모두 기준 미만
+    std::vector<float> batch(2 * data_.size(), 0.0f);
+    std::copy(data_.begin(), data_.end(), batch.begin() + static_cast<std::ptrdiff_t>(data_.size()));
+    const int sizes[] = {2, kDims, kAnchors};
+    cv::Mat output(3, sizes, CV_32F, batch.data());
+
+    std::vector<DetectionCandidate> candidates;
+    decoder_.decode(output, 0.25f, candidates, 0);
+    EXPECT_TRUE(candidates.empty());
+
+    decoder_.decode(output, 0.25f, candidates, 1);
+    expectSame(candidates, expected);
+}
+
+TEST_F(YOLOv8DecoderTest, ShouldDecodeQuantizedOutputAsDequantizedFloat)
+{
+    constexpr int kAnchors = 2100;
+    this->makeOutput(kAnchors, 0.05f);
+
+    // 좌표는 포화되지만 기준 구현도 같은 역양자화 값을 사용하므로 비교에는 영향 없음
+    const TensorSpec spec{CV_8U, 1.0f / 200.0f, 20};
+    std::vector<uchar> quantized(data_.size());
+    std::vector<float> dequantized(data_.size());
+    for (size_t i = 0; i < data_.size(); ++i)
+    {
+        quantized[i] = cv::saturate_cast<uchar>(data_[i] / spec.scale + spec.zero_point);
+        dequantized[i] = static_cast<float>(quantized[i] - spec.zero_point) * spec.scale;
+    }
+    const int sizes[] = {1, kDims, kAnchors};
+    cv::Mat output(3, sizes, CV_8U, quantized.data());
+    cv::Mat reference(3, sizes, CV_32F, dequantized.data());
+
+    std::vector<DetectionCandidate> candidates;
+    decoder_.decode(output, 0.27f, candidates, 0, spec);
+
+    EXPECT_FALSE(candidates.empty());
+    expectSame(candidates, referenceDecode(reference, 0.27f));
+}
+
+TEST_F(YOLOv8DecoderTest, ShouldDecodeHalfPrecisionOutput)
+{
+    constexpr int kAnchors = 2100 + 3;
+    this->makeOutput(kAnchors, 0.05f);
+
+    std::vector<cv::float16_t> half(data_.size());
+    std::vector<float> widened(data_.size());
+    for (size_t i = 0; i < data_.size(); ++i)
+    {
+        half[i] = cv::float16_t(data_[i]);
+        widened[i] = static_cast<float>(half[i]);
+    }
+    const int sizes[] = {1, kDims, kAnchors};
+    cv::Mat output(3, sizes, CV_16F, half.data());
+    cv::Mat reference(3, sizes, CV_32F, widened.data());
+
+    std::vector<DetectionCandidate> candidates;
+    decoder_.decode(output, 0.25f, candidates);
+
+    expectSame(candidates, referenceDecode(reference, 0.25f));
+}
+
+TEST_F(YOLOv8DecoderTest, ShouldScoreOnlyEnabledClasses)
+{
+    auto output = this->makeOutput(2100 + 5, 0.2f);
+    const std::vector<int> classes = {0, 2, 3, 5, 7};
+
+    ClassFilter filter;
+    filter.class_ids = {7, 0, 5, 3, 2, 2}; // 순서/중복 무관
+    decoder_.setClassFilter(filter);
+    std::vector<DetectionCandidate> candidates;
+    decoder_.decode(output, 0.25f, candidates);
+
+    EXPECT_FALSE(candidates.empty());
+    expectSame(candidates, referenceDecodeFiltered(output, classes, std::vector<float>(kClasses, 0.25f)));
+    for (const auto &candidate : candidates)
+    {
+        EXPECT_NE(std::find(classes.begin(), classes.end(), candidate.class_id), classes.end());
+    }
+}
+
+TEST_F(YOLOv8DecoderTest, ShouldApplyPerClassThresholds)
+{
+    auto output = this->makeOutput(8400, 0.05f);
+
+    // 클래스 2 는 높은 기준, 클래스 0 은 낮은 기준, 나머지는 decode 의 기준
+    ClassFilter filter;
+    filter.thresholds.assign(3, -1.0f);
+    filter.thresholds[0] = 0.15f;
+    filter.thresholds[2] = 0.8f;
+    decoder_.setClassFilter(filter);
+    std::vector<DetectionCandidate> candidates;
+    decoder_.decode(output, 0.3f, candidates);
+
+    std::vector<int> all(kClasses);
+    std::iota(all.begin(), all.end(), 0);
+    std::vector<float> thresholds(kClasses, 0.3f);
+    thresholds[0] = 0.15f;
+    thresholds[2] = 0.8f;
+    expectSame(candidates, referenceDecodeFiltered(output, all, thresholds));
+}
+
+TEST_F(YOLOv8DecoderTest, ShouldKeepAnchorWhenLowerScoredClassPassesItsThreshold)
+{
+    auto output = this->makeOutput(16, 0.0f);
+    // 앵커 3: 클래스 0 이 최고 점수지만 기준 (0.9) 미만, 클래스 1 은 자기 기준 (0.3) 이상
+    data_[static_cast<size_t>(4 + 0) * 16 + 3] = 0.6f;
+    data_[static_cast<size_t>(4 + 1) * 16 + 3] = 0.5f;
+    // 앵커 5: 기준을 넘는 클래스 없음
+    data_[static_cast<size_t>(4 + 0) * 16 + 5] = 0.8f;
+
+    ClassFilter filter;
+    filter.thresholds = {0.9f};
+    decoder_.setClassFilter(filter);
+    std::vector<DetectionCandidate> candidates;
+    decoder_.decode(output, 0.3f, candidates);
+
+    ASSERT_EQ(candidates.size(), 1u);
+    EXPECT_EQ(candidates[0].anchor, 3);
+    EXPECT_EQ(candidates[0].class_id, 1);
+    EXPECT_FLOAT_EQ(candidates[0].score, 0.5f);
+}
+
+TEST_F(YOLOv8DecoderTest, ShouldApplyClassFilterToQuantizedOutput)
+{
+    constexpr int kAnchors = 2100;
+    this->makeOutput(kAnchors, 0.1f);
+
+    const TensorSpec spec{CV_8S, 1.0f / 255.0f, -128};
+    std::vector<schar> quantized(data_.size());
+    std::vector<float> dequantized(data_.size());
+    for (size_t i = 0; i < data_.size(); ++i)
+    {
+        quantized[i] = cv::saturate_cast<schar>(std::min(data_[i], 1.0f) / spec.scale + spec.zero_point);
+        dequantized[i] = static_cast<float>(quantized[i] - spec.zero_point) * spec.scale;
+    }
+    const int sizes[] = {1, kDims, kAnchors};
+    cv::Mat output(3, sizes, CV_8S, quantized.data());
+    cv::Mat reference(3, sizes, CV_32F, dequantized.data());
+
+    ClassFilter filter;
+    filter.class_ids = {1, 4, 9};
+    filter.thresholds.assign(5, -1.0f);
+    filter.thresholds[4] = 0.5f;
+    decoder_.setClassFilter(filter);
+    std::vector<DetectionCandidate> candidates;
+    decoder_.decode(output, 0.3f, candidates, 0, spec);
+
+    std::vector<float> thresholds(kClasses, 0.3f);
+    thresholds[4] = 0.5f;
+    EXPECT_FALSE(candidates.empty());
+    expectSame(candidates, referenceDecodeFiltered(reference, {1, 4, 9}, thresholds));
+}
+
+TEST_F(YOLOv8DecoderTest, ShouldRejectOutputWithoutClassRows)
+{
+    EXPECT_TRUE(decoder_.acceptsOutput(this->makeOutput(64, 0.1f)));
+
+    // 박스 행만 있거나 추가 행(마스크 계수)을 빼면 클래스가 없는 출력, 2 차원 출력
+    const int box_only[] = {1, 4, 64};
+    EXPECT_FALSE(decoder_.acceptsOutput(cv::Mat(3, box_only, CV_32F, cv::Scalar(0))));
+    decoder_.setExtraRows(kClasses);
+    EXPECT_FALSE(decoder_.acceptsOutput(this->makeOutput(64, 0.1f)));
+    decoder_.setExtraRows(0);
+    const int flat[] = {kDims, 64};
+    EXPECT_FALSE(decoder_.acceptsOutput(cv::Mat(2, flat, CV_32F, cv::Scalar(0))));
+}
+} // namespace vp::adapter::out
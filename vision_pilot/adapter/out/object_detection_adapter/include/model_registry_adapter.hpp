@@ -0,0 +1,45 @@
+#pragma once
+
+#include "detection.hpp"
+#include "model_registry_config.hpp"
+#include "object_detection_port.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace vp::adapter::out
+{
+class ModelRegistryAdapterImpl;
+
+/**
+ * @brief 여러 YOLOv8 탐지 모델을 같은 프레임에 실행하고 결과를 합치는 탐지 어댑터
+ *
+ * 모델은 초기화 시 한 번씩 로드하고, 입력 크기/형식이 같은 모델끼리 전처리 결과를 공유한다.
+ * 모델마다 공유 추론 풀의 작업 하나로 실행하므로 같은 입력 크기의 모델도 동시에 추론한다.
+ * 모델별 최소 실행 간격(minIntervalMs, 소스 시각 기준)에 따라 프레임마다 실행할 모델을 고르고,
+ * 건너뛴 프레임에는 holdResults 설정에 따라 그 모델의 마지막 결과를 사용한다.
+ */
+class ModelRegistryAdapter : public vp::port::out::ObjectDetectionPort
+{
+public:
+    ModelRegistryAdapter(const config::ModelRegistryConfig &config);
+    ~ModelRegistryAdapter() override;
+
+    bool initialize();
+    std::vector<vp::domain::model::Detection> detectObject(const vp::domain::model::ImagePacket &image) override;
+    std::vector<vp::domain::model::Detection> detectObject(const vp::domain::model::ImagePacket &image, vp::port::out::DetectionLevel level) override;
+    // REDUCED: 등록 모델 중 하나라도 지원하면 true
+    bool supportsLevel(vp::port::out::DetectionLevel level) const override;
+    std::vector<vp::domain::model::Detection> detectObjectInRegions(const vp::domain::model::ImagePacket &image,
+                                                                    const std::vector<vp::domain::model::BoundingBox> &regions,
+                                                                    vp::port::out::DetectionLevel level) override;
+    std::vector<std::vector<vp::domain::model::Detection>> detectObjects(const std::vector<const vp::domain::model::ImagePacket *> &images, vp::port::out::DetectionLevel level) override;
+    bool deinitialize();
+
+    // name 모델을 탐지를 멈추지 않고 교체 (YOLOv8Adapter::reloadModel 과 같음). 이름이 없거나 이미 교체 중이면 false
+    bool reloadModel(const std::string &name, const std::string &model_path);
+
+private:
+    std::unique_ptr<ModelRegistryAdapterImpl> impl_;
+};
+} // namespace vp::adapter::out
@@ -4,6 +4,7 @@
 #include "object_detection_port.hpp"
 #include "yolov8_config.hpp"
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace vp::adapter::out
@@ -18,8 +19,25 @@ public:
 
     bool initialize();
     std::vector<vp::domain::model::Detection> detectObject(const vp::domain::model::ImagePacket &image) override;
+    std::vector<vp::domain::model::Detection> detectObject(const vp::domain::model::ImagePacket &image, vp::port::out::DetectionLevel level) override;
+    // REDUCED: 경량 모델, 동적 입력 또는 타일 분할 (REDUCED 에서는 생략) 중 하나가 있을 때만 지원
+    bool supportsLevel(vp::port::out::DetectionLevel level) const override;
+    std::vector<vp::domain::model::Detection> detectObjectInRegions(const vp::domain::model::ImagePacket &image,
+                                                                    const std::vector<vp::domain::model::BoundingBox> &regions,
+                                                                    vp::port::out::DetectionLevel level) override;
+    std::vector<std::vector<vp::domain::model::Detection>> detectObjects(const std::vector<const vp::domain::model::ImagePacket *> &images, vp::port::out::DetectionLevel level) override;
+    std::vector<vp::domain::model::Detection> detectInstances(const vp::domain::model::ImagePacket &image, vp::port::out::DetectionLevel level,
+                                                              std::vector<vp::domain::model::InstanceResult> &instances) override;
+    // 내부 대기열/작업 스레드에서 탐지 (대기 요청은 maxBatchSize 장씩 묶어 배치 추론). 결과 callback 은 작업 스레드에서 호출
+    void submitDetection(const vp::domain::model::ImagePacket &image, vp::port::out::DetectionLevel level,
+                         vp::port::out::DetectionCallback callback) override;
     bool deinitialize();
 
+    // 탐지를 멈추지 않고 기본 모델 교체 (백그라운드 로드/워밍업 후 프레임 사이에 전환, 경량 모델도 함께). 요청이 접수되면 true
+    // 새 모델이 추론/출력 형식 확인에 실패하면 기존 모델을 유지
+    bool reloadModel(const std::string &model_path);
+    bool isReloading() const;
+
 private:
     std::unique_ptr<YOLOv8AdapterImpl> impl_;
 };
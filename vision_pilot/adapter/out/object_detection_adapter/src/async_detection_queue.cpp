@@ -0,0 +1,124 @@
+#include "async_detection_queue.hpp"
+#include "gaia_log.hpp"
+#include "gaia_trace.hpp"
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+namespace vp::adapter::out
+{
+
+AsyncDetectionQueue::AsyncDetectionQueue(size_t capacity, size_t max_batch, BatchDetector detect, Affinity affinity)
+    : capacity_(std::max<size_t>(1, capacity)), max_batch_(std::max<size_t>(1, max_batch)), detect_(std::move(detect))
+{
+    LOG_TRA("");
+    worker_ = std::thread(&AsyncDetectionQueue::workerLoop, this);
+    setCpuAffinity(worker_, affinity);
+}
+
+AsyncDetectionQueue::~AsyncDetectionQueue()
+{
+    LOG_TRA("");
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    work_cv_.notify_all();
+    space_cv_.notify_all();
+    worker_.join();
+}
+
+void AsyncDetectionQueue::submit(const vp::domain::model::ImagePacket &image, vp::port::out::DetectionLevel level, vp::port::out::DetectionCallback callback)
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        space_cv_.wait(lock, [this]
+                       { return stop_ || queue_.size() < capacity_; });
+        if (stop_)
+        {
+            LOG_WRN("Detection queue stopped. Frame {} is not detected.", image.frame_id);
+            lock.unlock();
+            callback(image.frame_id, {});
+            return;
+        }
+        queue_.push_back({image, level, std::move(callback)});
+    }
+    work_cv_.notify_one();
+}
+
+void AsyncDetectionQueue::waitIdle()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_cv_.wait(lock, [this]
+                  { return queue_.empty() && !busy_; });
+}
+
+void AsyncDetectionQueue::workerLoop()
+{
+    TRACE_THREAD_NAME("detection.async");
+
+    std::vector<Request> batch;
+    std::vector<const vp::domain::model::ImagePacket *> images;
+    batch.reserve(max_batch_);
+    images.reserve(max_batch_);
+    while (true)
+    {
+        batch.clear();
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            work_cv_.wait(lock, [this]
+                          { return stop_ || !queue_.empty(); });
+
+            // 종료 요청 후에도 이미 들어온 요청은 모두 처리
+            if (queue_.empty())
+            {
+                break;
+            }
+
+            // 탐지 단계가 같은 연속 요청만 묶음 (결과 순서 유지)
+            const auto level = queue_.front().level;
+            while (!queue_.empty() && batch.size() < max_batch_ && queue_.front().level == level)
+            {
+                batch.push_back(std::move(queue_.front()));
+                queue_.pop_front();
+            }
+            busy_ = true;
+        }
+        space_cv_.notify_all();
+
+        images.clear();
+        for (const auto &request : batch)
+        {
+            images.push_back(&request.image);
+        }
+        std::vector<std::vector<vp::domain::model::Detection>> results;
+        try
+        {
+            results = detect_(images, batch.front().level);
+        }
+        catch (const std::exception &e)
+        {
+            // 작업 스레드에서 예외가 빠져나가면 프로세스가 종료되고 callback 을 기다리는 쪽이 멈추므로 빈 결과로 완료
+            LOG_ERR("Asynchronous detection failed (frames {} ~ {}): {}", batch.front().image.frame_id, batch.back().image.frame_id, e.what());
+            results.clear();
+        }
+        catch (...)
+        {
+            LOG_ERR("Asynchronous detection failed (frames {} ~ {}): unknown error", batch.front().image.frame_id, batch.back().image.frame_id);
+            results.clear();
+        }
+        results.resize(batch.size());
+        for (size_t i = 0; i < batch.size(); ++i)
+        {
+            batch[i].callback(batch[i].image.frame_id, std::move(results[i]));
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            busy_ = false;
+        }
+        idle_cv_.notify_all();
+    }
+}
+
+} // namespace vp::adapter::out
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "detection.hpp"
+#include "gaia_cpu_affinity.hpp"
+#include "image.hpp"
+#include "object_detection_port.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vp::adapter::out
+{
+
+/**
+ * @brief 비동기 탐지 요청 대기열 (ObjectDetectionPort::submitDetection 구현용)
+ *
+ * 요청 이미지를 복사해 두고 작업 스레드 하나가 순서대로 꺼내 탐지한 뒤 callback 을 호출한다.
+ * 대기 중인 요청 중 탐지 단계가 같은 연속 요청은 max_batch 개까지 묶어 한 번에 탐지하므로,
+ * 호출 측이 여러 프레임을 미리 요청해 두면 배치 추론으로 처리량이 늘어난다.
+ * 대기열이 가득 차면 submit 이 자리가 날 때까지 대기한다 (역압).
+ * callback 은 작업 스레드에서 요청 순서대로 호출되며, callback 안에서 submit 으로 대기하면 교착된다.
+ * 탐지가 예외를 던지면 오류를 기록하고 그 묶음의 요청은 빈 결과로 callback 을 호출한다.
+ * affinity 를 주면 작업 스레드를 생성 시 해당 코어로 고정한다.
+ */
+class AsyncDetectionQueue
+{
+public:
+    // 같은 단계의 이미지 여러 장을 탐지. 결과는 images 와 같은 순서
+    using BatchDetector = std::function<std::vector<std::vector<vp::domain::model::Detection>>(const std::vector<const vp::domain::model::ImagePacket *> &,
+                                                                                               vp::port::out::DetectionLevel)>;
+
+    // capacity: 대기 요청 최대 수. max_batch: 한 번에 탐지할 최대 요청 수
+    AsyncDetectionQueue(size_t capacity, size_t max_batch, BatchDetector detect, Affinity affinity = {});
+    // 대기 중인 요청을 모두 처리한 뒤 작업 스레드 종료
+    ~AsyncDetectionQueue();
+
+    AsyncDetectionQueue(const AsyncDetectionQueue &) = delete;
+    AsyncDetectionQueue &operator=(const AsyncDetectionQueue &) = delete;
+
+    void submit(const vp::domain::model::ImagePacket &image, vp::port::out::DetectionLevel level, vp::port::out::DetectionCallback callback);
+    // 대기/처리 중인 요청이 모두 끝날 때까지 대기
+    void waitIdle();
+
+private:
+    struct Request
+    {
+        vp::domain::model::ImagePacket image;
+        vp::port::out::DetectionLevel level = vp::port::out::DetectionLevel::FULL;
+        vp::port::out::DetectionCallback callback;
+    };
+
+    void workerLoop();
+
+    const size_t capacity_;
+    const size_t max_batch_;
+    BatchDetector detect_;
+
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable space_cv_;
+    std::condition_variable idle_cv_;
+    std::deque<Request> queue_; // mutex_ 로 보호
+    bool busy_ = false;         // 작업 스레드가 탐지 중 (mutex_ 로 보호)
+    bool stop_ = false;
+    std::thread worker_;
+};
+
+} // namespace vp::adapter::out
@@ -0,0 +1,212 @@
+#include "detection_cache.hpp"
+#include "gaia_log.hpp"
+#include <cstring>
+
+namespace
+{
+constexpr char kMagic[4] = {'V', 'P', 'D', 'C'};
+constexpr uint32_t kVersion = 2; // 2: 키 해시 변경 (이전 캐시는 키가 달라 버림)
+
+// xxHash64 상수
+constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ull;
+constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4Full;
+constexpr uint64_t kPrime3 = 0x165667B19E3779F9ull;
+constexpr uint64_t kPrime4 = 0x85EBCA77C2B2AE63ull;
+
+uint64_t rotl(uint64_t value, int bits)
+{
+    return (value << bits) | (value >> (64 - bits));
+}
+
+// 단어 하나를 상태에 섞음 (xxHash64 라운드). 곱셈만으로는 하위 비트로 전파되지 않으므로 회전을 함께 사용
+uint64_t mixWord(uint64_t hash, uint64_t word)
+{
+    word *= kPrime2;
+    word = rotl(word, 31);
+    word *= kPrime1;
+    hash ^= word;
+    return rotl(hash, 27) * kPrime1 + kPrime4;
+}
+
+struct FileHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t record_size; // sizeof(Detection). 구조체가 바뀌면 기존 캐시는 무효
+    uint32_t reserved;
+};
+
+struct RecordHeader
+{
+    uint64_t key;
+    uint32_t count;
+    uint32_t reserved;
+};
+
+bool validHeader(const FileHeader &header)
+{
+    return std::memcmp(header.magic, kMagic, sizeof(kMagic)) == 0 && header.version == kVersion &&
+           header.record_size == sizeof(vp::domain::model::Detection);
+}
+} // namespace
+
+namespace vp::adapter::out
+{
+
+DetectionCache::~DetectionCache()
+{
+    this->close();
+}
+
+bool DetectionCache::open(const std::string &path)
+{
+    this->close();
+    entries_.clear();
+    hits_ = 0;
+    misses_ = 0;
+
+    bool valid = false;
+    {
+        std::ifstream in(path, std::ios::binary);
+        if (in.good())
+        {
+            valid = this->load(in);
+            if (!valid)
+            {
+                LOG_WRN("Detection cache {} has an incompatible format. Starting a new cache.", path);
+                entries_.clear();
+            }
+        }
+    }
+
+    // 호환되는 파일이면 이어서 기록, 아니면 새로 만듦
+    file_.open(path, std::ios::binary | (valid ? std::ios::app : std::ios::trunc));
+    if (!file_.is_open())
+    {
+        LOG_ERR("Failed to open detection cache: {}", path);
+        entries_.clear();
+        return false;
+    }
+    if (!valid)
+    {
+        FileHeader header{};
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.version = kVersion;
+        header.record_size = sizeof(vp::domain::model::Detection);
+        file_.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    }
+    path_ = path;
+    LOG_INF("Detection cache opened: {} ({} frames)", path, entries_.size());
+    return true;
+}
+
+bool DetectionCache::load(std::ifstream &in)
+{
+    FileHeader header{};
+    if (!in.read(reinterpret_cast<char *>(&header), sizeof(header)) || !validHeader(header))
+    {
+        return false;
+    }
+
+    // 같은 키가 여러 번 기록되어 있으면 마지막 기록을 사용. 끝이 잘린 레코드(비정상 종료)는 버림
+    RecordHeader record{};
+    while (in.read(reinterpret_cast<char *>(&record), sizeof(record)))
+    {
+        std::vector<vp::domain::model::Detection> detections(record.count);
+        if (!in.read(reinterpret_cast<char *>(detections.data()), static_cast<std::streamsize>(record.count * sizeof(vp::domain::model::Detection))))
+        {
+            LOG_WRN("Detection cache ends with a truncated record. Ignoring it.");
+            break;
+        }
+        entries_[record.key] = std::move(detections);
+    }
+    return true;
+}
+
+void DetectionCache::close()
+{
+    if (!file_.is_open())
+    {
+        return;
+    }
+    file_.close();
+    LOG_INF("Detection cache closed: {} ({} frames, {} hits, {} misses)", path_, entries_.size(), hits_, misses_);
+}
+
+bool DetectionCache::find(uint64_t key, std::vector<vp::domain::model::Detection> &detections)
+{
+    const auto it = entries_.find(key);
+    if (it == entries_.end())
+    {
+        ++misses_;
+        return false;
+    }
+    ++hits_;
+    detections = it->second;
+    return true;
+}
+
+void DetectionCache::store(uint64_t key, const std::vector<vp::domain::model::Detection> &detections)
+{
+    if (!file_.is_open())
+    {
+        return;
+    }
+    entries_[key] = detections;
+
+    RecordHeader record{};
+    record.key = key;
+    record.count = static_cast<uint32_t>(detections.size());
+    file_.write(reinterpret_cast<const char *>(&record), sizeof(record));
+    file_.write(reinterpret_cast<const char *>(detections.data()), static_cast<std::streamsize>(detections.size() * sizeof(vp::domain::model::Detection)));
+}
+
+uint64_t DetectionCache::hashBytes(const void *data, size_t size, uint64_t seed)
+{
+    const auto *bytes = static_cast<const unsigned char *>(data);
+    uint64_t hash = seed;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        uint64_t word = 0;
+        std::memcpy(&word, bytes + i, sizeof(word));
+        hash = mixWord(hash, word);
+    }
+    if (i < size)
+    {
+        // 남은 1 ~ 7 바이트는 길이와 함께 한 단어로 섞음 (뒤에 0 이 붙은 입력과 구분)
+        uint64_t word = 0;
+        std::memcpy(&word, bytes + i, size - i);
+        hash = mixWord(hash, word ^ (static_cast<uint64_t>(size - i) << 56));
+    }
+    return hash;
+}
+
+uint64_t DetectionCache::finishHash(uint64_t hash)
+{
+    hash ^= hash >> 33;
+    hash *= kPrime2;
+    hash ^= hash >> 29;
+    hash *= kPrime3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+uint64_t DetectionCache::hashFile(const std::string &path)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in.good())
+    {
+        return 0;
+    }
+
+    uint64_t hash = kHashSeed;
+    std::vector<char> buffer(1 << 20);
+    while (in.read(buffer.data(), static_cast<std::streamsize>(buffer.size())) || in.gcount() > 0)
+    {
+        hash = hashBytes(buffer.data(), static_cast<size_t>(in.gcount()), hash);
+    }
+    return finishHash(hash);
+}
+
+} // namespace vp::adapter::out
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "detection.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace vp::adapter::out
+{
+
+/**
+ * @brief 프레임 키 -> 탐지 결과 영구 캐시 (같은 데이터셋을 반복 재생할 때 추론 생략)
+ *
+ * 파일은 헤더 뒤에 [키, 결과 수, Detection...] 레코드를 덧붙이는 단순 형식이며, 열 때 전체를 메모리로 읽는다.
+ * Detection 은 trivially copyable 이므로 그대로 기록하고, 헤더의 레코드 크기가 다르면 기존 내용을 버린다.
+ * 키는 모델/설정/프레임 내용 해시를 조합한 값으로 호출 측(YOLOv8AdapterImpl)이 만든다.
+ * 파일 하나는 인스턴스 하나만 사용해야 한다 (여러 어댑터가 같은 파일에 덧붙이지 않도록).
+ */
+class DetectionCache
+{
+public:
+    static constexpr uint64_t kHashSeed = 14695981039346656037ull; // hashBytes 기본 시드
+
+    ~DetectionCache();
+
+    // 기존 파일을 읽고 이어서 기록. 실패하면 false (캐시 없이 동작)
+    bool open(const std::string &path);
+    void close();
+    bool isOpen() const { return file_.is_open(); }
+
+    bool find(uint64_t key, std::vector<vp::domain::model::Detection> &detections);
+    void store(uint64_t key, const std::vector<vp::domain::model::Detection> &detections);
+
+    size_t size() const { return entries_.size(); }
+    uint64_t hits() const { return hits_; }
+    uint64_t misses() const { return misses_; }
+
+    // 8바이트 단위 xxHash64 라운드로 섞어 프레임 한 장도 빠르게 처리. seed 로 이어서 해시 (8의 배수 단위로 나누면 한 번에 해시한 것과 같음)
+    static uint64_t hashBytes(const void *data, size_t size, uint64_t seed = kHashSeed);
+    // 이어서 만든 해시를 키로 쓰기 전 마지막 섞기 (모든 입력 비트가 모든 출력 비트에 영향)
+    static uint64_t finishHash(uint64_t hash);
+    // 파일 내용 해시 (모델 파일 식별). 읽지 못하면 0
+    static uint64_t hashFile(const std::string &path);
+
+private:
+    bool load(std::ifstream &in);
+
+    std::unordered_map<uint64_t, std::vector<vp::domain::model::Detection>> entries_;
+    std::ofstream file_;
+    std::string path_;
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+};
+
+} // namespace vp::adapter::out
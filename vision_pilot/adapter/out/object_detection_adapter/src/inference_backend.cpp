@@ -0,0 +1,28 @@
+#include "inference_backend.hpp"
+#include "gaia_log.hpp"
+#include "opencv_dnn_backend.hpp"
+#ifdef VP_WITH_ONNXRUNTIME
+#include "onnxruntime_backend.hpp"
+#endif
+
+namespace vp::adapter::out
+{
+
+std::unique_ptr<InferenceBackend> createInferenceBackend(const config::YoloConfig &config)
+{
+    switch (config.backend)
+    {
+    case config::InferenceBackendType::OPENCV_DNN:
+        return std::make_unique<OpenCvDnnBackend>(config.useCuda, config.precision);
+    case config::InferenceBackendType::ONNXRUNTIME:
+#ifdef VP_WITH_ONNXRUNTIME
+        return std::make_unique<OnnxRuntimeBackend>(config.numThreads);
+#else
+        LOG_ERR("ONNX Runtime backend is not available. Rebuild with -DVP_WITH_ONNXRUNTIME=ON.");
+        return nullptr;
+#endif
+    }
+    return nullptr;
+}
+
+} // namespace vp::adapter::out
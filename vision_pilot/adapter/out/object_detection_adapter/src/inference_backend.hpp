@@ -0,0 +1,42 @@
+#pragma once
+
+#include "tensor_spec.hpp"
+#include "yolov8_config.hpp"
+#include <memory>
+#include <opencv2/core/mat.hpp>
+#include <string>
+
+namespace vp::adapter::out
+{
+
+/**
+ * @brief YOLOv8 모델 추론 런타임 추상화
+ *
+ * 전처리/후처리는 YOLOv8AdapterImpl 이 담당하고, 백엔드는 입력 텐서 -> 출력 텐서 변환만 수행한다.
+ */
+class InferenceBackend
+{
+public:
+    virtual ~InferenceBackend() = default;
+
+    virtual bool load(const std::string &model_path) = 0;
+    virtual bool empty() const = 0;
+
+    // 모델 입출력 텐서 형식 (load 이후 유효). 전처리/디코딩이 이 형식에 맞춰 텐서를 만들고 해석한다
+    virtual TensorSpec inputSpec() const { return {}; }
+    virtual TensorSpec outputSpec() const { return {}; }
+
+    // input: Nx3xHxW (inputSpec). output: [N, 4 + classes (+ 마스크 계수/키포인트), anchors] (outputSpec, 다음 infer 호출 전까지 유효)
+    // 실패 시 false (모델이 배치 크기를 지원하지 않는 경우 포함)
+    virtual bool infer(const cv::Mat &input, cv::Mat &output) = 0;
+
+    // 세그멘테이션 모델의 마스크 프로토타입 [N, masks, H, W] (outputSpec 형식, 마지막 infer 결과). 없으면 빈 Mat
+    virtual cv::Mat protoOutput() const { return {}; }
+
+    virtual const char *name() const = 0;
+};
+
+// config.backend 에 맞는 백엔드 생성. 빌드에 포함되지 않은 백엔드이면 nullptr
+std::unique_ptr<InferenceBackend> createInferenceBackend(const config::YoloConfig &config);
+
+} // namespace vp::adapter::out
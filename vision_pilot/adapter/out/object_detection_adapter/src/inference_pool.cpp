@@ -0,0 +1,118 @@
+#include "inference_pool.hpp"
+#include "gaia_log.hpp"
+
+namespace vp::adapter::out
+{
+
+InferencePool::InferencePool(int num_threads, Affinity affinity)
+{
+    LOG_TRA("");
+    for (int i = 1; i < num_threads; ++i)
+    {
+        workers_.emplace_back(&InferencePool::workerLoop, this);
+        setCpuAffinity(workers_.back(), affinity);
+    }
+}
+
+InferencePool::~InferencePool()
+{
+    LOG_TRA("");
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    work_cv_.notify_all();
+    for (auto &worker : workers_)
+    {
+        worker.join();
+    }
+}
+
+void InferencePool::run(size_t count, const std::function<void(size_t)> &task)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    if (workers_.empty() || count == 1)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    task_ = &task;
+    count_ = count;
+    next_ = 0;
+    pending_ = count;
+    work_cv_.notify_all();
+
+    // 호출 스레드도 작업에 참여한 뒤 나머지가 끝날 때까지 대기
+    this->drain(lock);
+    done_cv_.wait(lock, [this]
+                  { return pending_ == 0; });
+    task_ = nullptr;
+
+    auto error = std::move(error_);
+    error_ = nullptr;
+    lock.unlock();
+    if (error != nullptr)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+void InferencePool::workerLoop()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        work_cv_.wait(lock, [this]
+                      { return stop_ || (task_ != nullptr && next_ < count_); });
+        if (stop_)
+        {
+            return;
+        }
+        this->drain(lock);
+    }
+}
+
+void InferencePool::drain(std::unique_lock<std::mutex> &lock)
+{
+    while (task_ != nullptr && next_ < count_)
+    {
+        const size_t index = next_++;
+        const auto *task = task_;
+        std::exception_ptr error;
+        lock.unlock();
+        try
+        {
+            (*task)(index);
+        }
+        catch (...)
+        {
+            // 작업 스레드에서 예외가 빠져나가면 프로세스가 종료되므로 run() 으로 넘김
+            error = std::current_exception();
+        }
+        lock.lock();
+        if (error != nullptr)
+        {
+            if (error_ == nullptr)
+            {
+                error_ = std::move(error);
+            }
+            // 아직 시작하지 않은 작업은 실행하지 않음
+            pending_ -= count_ - next_;
+            next_ = count_;
+        }
+        if (--pending_ == 0)
+        {
+            done_cv_.notify_all();
+        }
+    }
+}
+
+} // namespace vp::adapter::out
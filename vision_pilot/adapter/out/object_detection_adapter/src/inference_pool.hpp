@@ -0,0 +1,57 @@
+#pragma once
+
+#include "gaia_cpu_affinity.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vp::adapter::out
+{
+
+/**
+ * @brief 여러 모델의 추론을 나누어 실행하는 고정 크기 작업 풀
+ *
+ * run() 은 작업 인덱스 [0, count) 를 풀 스레드와 호출 스레드가 나누어 실행하고, 모두 끝나면 반환한다.
+ * 스레드는 생성 시 한 번만 만들고 호출마다 재사용한다.
+ * run() 은 한 번에 하나의 스레드에서만 호출해야 한다.
+ * 작업이 예외를 던지면 아직 시작하지 않은 작업은 건너뛰고, 실행 중인 작업이 끝난 뒤
+ * 첫 예외를 호출 스레드에서 다시 던진다 (순서대로 실행할 때와 같이 호출 측에서 처리).
+ * affinity 를 주면 풀 스레드를 생성 시 해당 코어로 고정한다 (호출 스레드는 그대로).
+ */
+class InferencePool
+{
+public:
+    // num_threads: 호출 스레드를 포함한 총 스레드 수 (1 이하: 호출 스레드에서 순서대로 실행)
+    explicit InferencePool(int num_threads, Affinity affinity = {});
+    ~InferencePool();
+
+    InferencePool(const InferencePool &) = delete;
+    InferencePool &operator=(const InferencePool &) = delete;
+
+    void run(size_t count, const std::function<void(size_t)> &task);
+    int threadCount() const { return static_cast<int>(workers_.size()) + 1; }
+
+private:
+    void workerLoop();
+    // 남은 작업을 하나씩 가져와 실행 (lock 은 mutex_ 를 잡은 상태로 들어오고 나감)
+    void drain(std::unique_lock<std::mutex> &lock);
+
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+
+    // 현재 run() 호출 상태 (mutex_ 로 보호)
+    const std::function<void(size_t)> *task_ = nullptr;
+    size_t count_ = 0;
+    size_t next_ = 0;    // 다음에 가져갈 작업 인덱스
+    size_t pending_ = 0; // 끝나지 않은 작업 수
+    std::exception_ptr error_; // 작업에서 처음 발생한 예외 (run() 이 다시 던짐)
+    bool stop_ = false;
+};
+
+} // namespace vp::adapter::out
@@ -0,0 +1,231 @@
+#include "instance_decoder.hpp"
+#include <algorithm>
+#include <cmath>
+#include <opencv2/core.hpp>
+#include <opencv2/core/hal/intrin.hpp>
+
+namespace
+{
+constexpr int kBoxDims = 4; // cx, cy, w, h
+
+inline float toFloat(float v) { return v; }
+inline float toFloat(cv::float16_t v) { return static_cast<float>(v); }
+inline float toFloat(uchar v) { return static_cast<float>(v); }
+inline float toFloat(schar v) { return static_cast<float>(v); }
+
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+inline cv::v_float32 loadFloat(const float *p) { return cv::vx_load(p); }
+inline cv::v_float32 loadFloat(const cv::float16_t *p) { return cv::vx_load_expand(p); }
+#endif
+
+// 앵커 열의 rows [first, first + count) 를 float 로 읽음 (양자화 텐서는 역양자화)
+template <typename T>
+void readColumn(const cv::Mat &output, const vp::adapter::out::TensorSpec &spec, int batch_index, int anchor, int first, int count,
+                std::vector<float> &values)
+{
+    const int dimensions = output.size[1];
+    const int num_anchors = output.size[2];
+    const T *data = output.ptr<T>() + static_cast<size_t>(batch_index) * dimensions * num_anchors;
+    const float scale = spec.isQuantized() ? spec.scale : 1.0f;
+    const float zero_point = spec.isQuantized() ? static_cast<float>(spec.zero_point) : 0.0f;
+    values.resize(count);
+    for (int i = 0; i < count; ++i)
+    {
+        values[i] = (toFloat(data[static_cast<size_t>(first + i) * num_anchors + anchor]) - zero_point) * scale;
+    }
+}
+
+// dst[i] += k * src[i]
+template <typename T>
+void accumulateRow(float k, const T *src, float *dst, int len)
+{
+    int i = 0;
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+    const int lanes = cv::VTraits<cv::v_float32>::vlanes();
+    const cv::v_float32 v_k = cv::vx_setall_f32(k);
+    for (; i <= len - lanes; i += lanes)
+    {
+        cv::v_store(dst + i, cv::v_fma(loadFloat(src + i), v_k, cv::vx_load(dst + i)));
+    }
+#endif
+    for (; i < len; ++i)
+    {
+        dst[i] += k * toFloat(src[i]);
+    }
+}
+
+// 프로토타입 채널 순으로 영역 [x0, x0 + w) x [y0, y0 + h) 누적 (채널 평면 안에서 행 단위 연속 접근)
+template <typename T>
+void accumulateMask(const uchar *protos, const std::vector<float> &coefficients, int proto_w, int proto_h, int x0, int y0, int w, int h,
+                    float *acc)
+{
+    const size_t plane = static_cast<size_t>(proto_w) * proto_h;
+    const T *base = reinterpret_cast<const T *>(protos);
+    for (size_t c = 0; c < coefficients.size(); ++c)
+    {
+        const float k = coefficients[c];
+        const T *src = base + c * plane + static_cast<size_t>(y0) * proto_w + x0;
+        for (int r = 0; r < h; ++r)
+        {
+            accumulateRow(k, src + static_cast<size_t>(r) * proto_w, acc + static_cast<size_t>(r) * w, w);
+        }
+    }
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+    cv::vx_cleanup();
+#endif
+}
+} // namespace
+
+namespace vp::adapter::out
+{
+
+void InstanceDecoder::setLayout(const InstanceLayout &layout)
+{
+    layout_ = layout;
+    // sigmoid(v) > t  <=>  v > log(t / (1 - t))
+    const float t = std::min(std::max(layout_.mask_threshold, 1e-6f), 1.0f - 1e-6f);
+    mask_logit_ = std::log(t / (1.0f - t));
+    protos_ = nullptr;
+}
+
+int InstanceDecoder::extraRows() const
+{
+    switch (layout_.task)
+    {
+    case config::YoloTask::SEGMENT:
+        return std::max(0, layout_.num_masks);
+    case config::YoloTask::POSE:
+        return std::max(0, layout_.num_keypoints * layout_.keypoint_dims);
+    default:
+        return 0;
+    }
+}
+
+bool InstanceDecoder::setPrototypes(const cv::Mat &protos, int batch_index)
+{
+    protos_ = nullptr;
+    if (layout_.task != config::YoloTask::SEGMENT || protos.empty())
+    {
+        return false;
+    }
+    // Prototypes: [Batch, Masks, H, W] -> [1, 32, 160, 160]. 양자화 프로토타입은 지원하지 않음
+    if (protos.dims != 4 || !protos.isContinuous() || protos.size[1] != layout_.num_masks || batch_index < 0 || batch_index >= protos.size[0] ||
+        (protos.depth() != CV_32F && protos.depth() != CV_16F))
+    {
+        return false;
+    }
+
+    proto_depth_ = protos.depth();
+    proto_h_ = protos.size[2];
+    proto_w_ = protos.size[3];
+    protos_ = protos.ptr<uchar>() + static_cast<size_t>(batch_index) * layout_.num_masks * proto_h_ * proto_w_ * protos.elemSize();
+    return true;
+}
+
+void InstanceDecoder::decode(const cv::Mat &output, const TensorSpec &spec, int batch_index, const DetectionCandidate &candidate,
+                             const LetterboxInfo &letterbox, const cv::Size &input_size, vp::domain::model::InstanceResult &instance)
+{
+    instance.mask.width = 0;
+    instance.mask.height = 0;
+    instance.mask.data.clear();
+    instance.keypoints.clear();
+
+    const int extra_rows = this->extraRows();
+    if (extra_rows <= 0 || candidate.anchor < 0 || output.size[1] < kBoxDims + extra_rows)
+    {
+        return;
+    }
+    this->readExtras(output, spec, batch_index, candidate.anchor);
+
+    if (layout_.task == config::YoloTask::SEGMENT)
+    {
+        if (protos_ != nullptr)
+        {
+            this->assembleMask(candidate, letterbox, input_size, instance.mask);
+        }
+        return;
+    }
+
+    // 포즈: (x, y[, score]) x 키포인트, 입력 텐서 좌표 -> 원본 좌표
+    const int dims = layout_.keypoint_dims;
+    instance.keypoints.resize(layout_.num_keypoints);
+    for (int k = 0; k < layout_.num_keypoints; ++k)
+    {
+        const float *values = extras_.data() + static_cast<size_t>(k) * dims;
+        auto &keypoint = instance.keypoints[k];
+        keypoint.x = (values[0] - letterbox.pad_x) / letterbox.scale;
+        keypoint.y = (values[1] - letterbox.pad_y) / letterbox.scale;
+        keypoint.score = dims >= 3 ? values[2] : 1.0f;
+    }
+}
+
+void InstanceDecoder::readExtras(const cv::Mat &output, const TensorSpec &spec, int batch_index, int anchor)
+{
+    const int count = this->extraRows();
+    const int first = output.size[1] - count;
+    switch (output.depth())
+    {
+    case CV_32F:
+        readColumn<float>(output, spec, batch_index, anchor, first, count, extras_);
+        break;
+    case CV_16F:
+        readColumn<cv::float16_t>(output, spec, batch_index, anchor, first, count, extras_);
+        break;
+    case CV_8U:
+        readColumn<uchar>(output, spec, batch_index, anchor, first, count, extras_);
+        break;
+    case CV_8S:
+        readColumn<schar>(output, spec, batch_index, anchor, first, count, extras_);
+        break;
+    default:
+        CV_Error(cv::Error::StsUnsupportedFormat, "Unsupported YOLOv8 output depth");
+    }
+}
+
+void InstanceDecoder::assembleMask(const DetectionCandidate &candidate, const LetterboxInfo &letterbox, const cv::Size &input_size,
+                                   vp::domain::model::InstanceMask &mask)
+{
+    // 박스를 패딩 제외 영역으로 자른 뒤 프로토타입 해상도로 옮김 (바깥쪽으로 반올림)
+    const float sx = static_cast<float>(proto_w_) / static_cast<float>(input_size.width);
+    const float sy = static_cast<float>(proto_h_) / static_cast<float>(input_size.height);
+    const float x1 = std::max(candidate.cx - 0.5f * candidate.w, static_cast<float>(letterbox.pad_x));
+    const float y1 = std::max(candidate.cy - 0.5f * candidate.h, static_cast<float>(letterbox.pad_y));
+    const float x2 = std::min(candidate.cx + 0.5f * candidate.w, static_cast<float>(letterbox.pad_x + letterbox.resized_w));
+    const float y2 = std::min(candidate.cy + 0.5f * candidate.h, static_cast<float>(letterbox.pad_y + letterbox.resized_h));
+    const int px0 = std::max(0, static_cast<int>(std::floor(x1 * sx)));
+    const int py0 = std::max(0, static_cast<int>(std::floor(y1 * sy)));
+    const int px1 = std::min(proto_w_, static_cast<int>(std::ceil(x2 * sx)));
+    const int py1 = std::min(proto_h_, static_cast<int>(std::ceil(y2 * sy)));
+    if (px1 <= px0 || py1 <= py0)
+    {
+        return;
+    }
+
+    const int w = px1 - px0;
+    const int h = py1 - py0;
+    acc_.assign(static_cast<size_t>(w) * h, 0.0f);
+    if (proto_depth_ == CV_16F)
+    {
+        accumulateMask<cv::float16_t>(protos_, extras_, proto_w_, proto_h_, px0, py0, w, h, acc_.data());
+    }
+    else
+    {
+        accumulateMask<float>(protos_, extras_, proto_w_, proto_h_, px0, py0, w, h, acc_.data());
+    }
+
+    mask.width = w;
+    mask.height = h;
+    mask.data.resize(acc_.size());
+    for (size_t i = 0; i < acc_.size(); ++i)
+    {
+        mask.data[i] = acc_[i] > mask_logit_ ? 255 : 0;
+    }
+
+    // 프로토타입 좌표 -> 입력 텐서 좌표 -> 원본 좌표
+    mask.region.x = (static_cast<float>(px0) / sx - letterbox.pad_x) / letterbox.scale;
+    mask.region.y = (static_cast<float>(py0) / sy - letterbox.pad_y) / letterbox.scale;
+    mask.region.width = static_cast<float>(w) / sx / letterbox.scale;
+    mask.region.height = static_cast<float>(h) / sy / letterbox.scale;
+}
+
+} // namespace vp::adapter::out
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "instance.hpp"
+#include "letterbox_preprocessor.hpp"
+#include "tensor_spec.hpp"
+#include "yolov8_config.hpp"
+#include "yolov8_decoder.hpp"
+#include <opencv2/core/mat.hpp>
+#include <vector>
+
+namespace vp::adapter::out
+{
+
+// 세그멘테이션/포즈 출력 헤드 구성
+struct InstanceLayout
+{
+    config::YoloTask task = config::YoloTask::DETECT;
+    int num_masks = 32;
+    float mask_threshold = 0.5f;
+    int num_keypoints = 17;
+    int keypoint_dims = 3;
+};
+
+/**
+ * @brief NMS 후 남은 박스의 마스크/키포인트를 YOLOv8 세그멘테이션/포즈 출력에서 만든다
+ *
+ * 추가 행(마스크 계수, 키포인트)은 출력 텐서의 마지막 extraRows() 행이며, 남은 후보의 앵커 열만 읽는다.
+ * 마스크는 프로토타입 해상도(입력의 1/4)에서 박스가 덮는 영역만 계수 x 프로토타입 합을 계산한다.
+ * 합은 프로토타입 채널 순으로 영역의 행 단위 누적(SIMD)이며, sigmoid 대신 logit(기준) 과 비교하여 이진화한다.
+ * 원본 해상도로 늘리지 않고 영역 해상도 그대로 돌려주므로 비용은 박스 면적에만 비례한다.
+ */
+class InstanceDecoder
+{
+public:
+    void setLayout(const InstanceLayout &layout);
+    const InstanceLayout &layout() const { return layout_; }
+
+    // 클래스 행 뒤에 오는 추가 행 수 (YOLOv8Decoder::setExtraRows)
+    int extraRows() const;
+
+    // 이미지 하나(batch_index)의 프로토타입 [N, masks, H, W] 지정. SEGMENT 가 아니거나 지원하지 않는 형식이면 false (마스크 없이 진행)
+    bool setPrototypes(const cv::Mat &protos, int batch_index);
+
+    // candidate: 입력 텐서 좌표 후보 (anchor 필요). input_size: 모델 입력 크기
+    void decode(const cv::Mat &output, const TensorSpec &spec, int batch_index, const DetectionCandidate &candidate,
+                const LetterboxInfo &letterbox, const cv::Size &input_size, vp::domain::model::InstanceResult &instance);
+
+private:
+    void readExtras(const cv::Mat &output, const TensorSpec &spec, int batch_index, int anchor);
+    void assembleMask(const DetectionCandidate &candidate, const LetterboxInfo &letterbox, const cv::Size &input_size,
+                      vp::domain::model::InstanceMask &mask);
+
+    InstanceLayout layout_;
+    float mask_logit_ = 0.0f; // logit(mask_threshold)
+
+    // 현재 이미지 프로토타입 [masks, proto_h_, proto_w_] (CV_32F 또는 CV_16F)
+    const uchar *protos_ = nullptr;
+    int proto_depth_ = -1;
+    int proto_w_ = 0;
+    int proto_h_ = 0;
+
+    std::vector<float> extras_; // 후보 하나의 추가 행 값 (호출마다 재사용)
+    std::vector<float> acc_;    // 마스크 영역 누적 버퍼
+};
+
+} // namespace vp::adapter::out
@@ -0,0 +1,316 @@
+#include "letterbox_preprocessor.hpp"
+#include "gaia_log.hpp"
+#include <algorithm>
+#include <cmath>
+#include <opencv2/core.hpp>
+#include <opencv2/core/hal/intrin.hpp>
+
+namespace
+{
+constexpr float kNormScale = 1.0f / 255.0f;
+constexpr int kMaxChannels = 3;
+
+// cv::resize(INTER_LINEAR) 와 같은 픽셀 중심 정렬 매핑
+void buildLinearTable(int src_size, int dst_size, std::vector<int> &ofs, std::vector<float> &alpha)
+{
+    ofs.resize(dst_size);
+    alpha.resize(dst_size);
+
+    const double inv_scale = static_cast<double>(src_size) / dst_size;
+    for (int d = 0; d < dst_size; ++d)
+    {
+        auto f = static_cast<float>((d + 0.5) * inv_scale - 0.5);
+        int s = static_cast<int>(std::floor(f));
+        f -= static_cast<float>(s);
+
+        if (s < 0)
+        {
+            s = 0;
+            f = 0.0f;
+        }
+        if (s >= src_size - 1)
+        {
+            s = src_size - 1;
+            f = 0.0f;
+        }
+        ofs[d] = s;
+        alpha[d] = f;
+    }
+}
+
+// 두 원본 행을 세로 보간하여 float 행 하나로 (dst = row0 + (row1 - row0) * wy)
+void blendRows(const uchar *row0, const uchar *row1, float wy, float *dst, int len)
+{
+    int i = 0;
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+    const int lanes = cv::VTraits<cv::v_float32>::vlanes();
+    const cv::v_float32 v_wy = cv::vx_setall_f32(wy);
+    for (; i <= len - lanes; i += lanes)
+    {
+        cv::v_float32 a = cv::v_cvt_f32(cv::v_reinterpret_as_s32(cv::vx_load_expand_q(row0 + i)));
+        cv::v_float32 b = cv::v_cvt_f32(cv::v_reinterpret_as_s32(cv::vx_load_expand_q(row1 + i)));
+        cv::v_store(dst + i, cv::v_fma(cv::v_sub(b, a), v_wy, a));
+    }
+    cv::vx_cleanup();
+#endif
+    for (; i < len; ++i)
+    {
+        const float a = row0[i];
+        dst[i] = a + (static_cast<float>(row1[i]) - a) * wy;
+    }
+}
+
+// 보간된 픽셀 값(0~255) -> 텐서 원소
+template <typename T>
+struct ValueWriter
+{
+    explicit ValueWriter(const vp::adapter::out::TensorSpec &) {}
+    T operator()(float v) const { return static_cast<T>(v * kNormScale); }
+};
+
+template <>
+struct ValueWriter<cv::float16_t>
+{
+    explicit ValueWriter(const vp::adapter::out::TensorSpec &) {}
+    cv::float16_t operator()(float v) const { return cv::float16_t(v * kNormScale); }
+};
+
+// q = round(v / 255 / scale) + zero_point
+template <typename T>
+struct QuantizedWriter
+{
+    explicit QuantizedWriter(const vp::adapter::out::TensorSpec &spec)
+        : multiplier{kNormScale / spec.scale}, zero_point{static_cast<float>(spec.zero_point)}
+    {
+    }
+    T operator()(float v) const { return cv::saturate_cast<T>(v * multiplier + zero_point); }
+
+    float multiplier;
+    float zero_point;
+};
+
+template <>
+struct ValueWriter<uchar> : QuantizedWriter<uchar>
+{
+    using QuantizedWriter<uchar>::QuantizedWriter;
+};
+
+template <>
+struct ValueWriter<schar> : QuantizedWriter<schar>
+{
+    using QuantizedWriter<schar>::QuantizedWriter;
+};
+
+// 텐서의 [offset, offset + count) 원소를 패딩 값으로 채움
+template <typename T>
+void fillImage(cv::Mat &blob, size_t offset, size_t count, const vp::adapter::out::TensorSpec &spec)
+{
+    auto *begin = blob.ptr<T>() + offset;
+    std::fill(begin, begin + count, ValueWriter<T>(spec)(vp::adapter::out::LetterboxPreprocessor::kPadValue));
+}
+} // namespace
+
+namespace vp::adapter::out
+{
+
+void LetterboxPreprocessor::setTensorSpec(const TensorSpec &spec)
+{
+    CV_Assert(spec.depth == CV_32F || spec.depth == CV_16F || spec.depth == CV_8U || spec.depth == CV_8S);
+    CV_Assert(!spec.isQuantized() || spec.scale > 0.0f);
+    if (spec == spec_)
+    {
+        return;
+    }
+
+    spec_ = spec;
+    // 다음 호출에서 텐서와 패딩을 새 형식으로 다시 만든다
+    slots_.clear();
+    blob_.release();
+}
+
+const cv::Mat &LetterboxPreprocessor::run(const cv::Mat &src, bool swap_rb, int target_w, int target_h, LetterboxInfo &info)
+{
+    single_input_.resize(1);
+    single_input_[0].image = src;
+    single_input_[0].swap_rb = swap_rb;
+
+    const auto &blob = this->runBatch(single_input_, target_w, target_h, single_info_);
+    single_input_[0].image.release(); // 호출자 이미지 참조를 남기지 않음
+    info = single_info_[0];
+    return blob;
+}
+
+const cv::Mat &LetterboxPreprocessor::runBatch(const std::vector<LetterboxInput> &inputs, int target_w, int target_h, std::vector<LetterboxInfo> &infos)
+{
+    const int batch = static_cast<int>(inputs.size());
+    CV_Assert(batch > 0);
+    this->prepareBlob(batch, target_w, target_h);
+
+    infos.resize(batch);
+    for (int b = 0; b < batch; ++b)
+    {
+        const auto &src = inputs[b].image;
+        CV_Assert(src.depth() == CV_8U && (src.channels() == 1 || src.channels() == kMaxChannels));
+
+        auto &slot = slots_[b];
+        if (src.cols != slot.src_w || src.rows != slot.src_h || src.channels() != slot.channels)
+        {
+            this->prepareSlot(b, src);
+        }
+        infos[b] = slot.info;
+
+        // 출력 행을 스레드별로 나누어 처리 (패딩 영역은 prepareSlot 에서 채워 둠)
+        const bool swap_rb = inputs[b].swap_rb;
+        cv::parallel_for_(cv::Range(0, slot.info.resized_h), [&](const cv::Range &range)
+                          { this->processRows(b, src, swap_rb, range.start, range.end); });
+    }
+
+    return blob_;
+}
+
+cv::Size LetterboxPreprocessor::fitInputSize(const cv::Size &image, const cv::Size &max_size, int stride)
+{
+    if (image.width <= 0 || image.height <= 0 || stride <= 0)
+    {
+        return max_size;
+    }
+
+    // prepareSlot 과 같은 배율/반올림으로 리사이즈 크기를 구한 뒤 stride 배수로 올림 (max_size 를 넘지 않음)
+    const float scale = std::min(static_cast<float>(max_size.width) / image.width, static_cast<float>(max_size.height) / image.height);
+    const auto align = [&](int length, int limit)
+    {
+        const int resized = std::max(1, static_cast<int>(std::round(length * scale)));
+        return std::min(limit, (resized + stride - 1) / stride * stride);
+    };
+    return cv::Size(align(image.width, max_size.width), align(image.height, max_size.height));
+}
+
+void LetterboxPreprocessor::prepareBlob(int batch, int target_w, int target_h)
+{
+    if (batch == static_cast<int>(slots_.size()) && target_w == target_w_ && target_h == target_h_)
+    {
+        return;
+    }
+
+    LOG_DBG("Letterbox tensor changed: {}x3x{}x{} (depth: {})", batch, target_h, target_w, spec_.depth);
+    target_w_ = target_w;
+    target_h_ = target_h;
+
+    // 모든 이미지의 기하 정보를 다시 계산하도록 초기화
+    slots_.assign(batch, Slot{});
+
+    const int sizes[] = {batch, kMaxChannels, target_h, target_w};
+    blob_.create(4, sizes, spec_.depth);
+}
+
+void LetterboxPreprocessor::prepareSlot(int index, const cv::Mat &src)
+{
+    auto &slot = slots_[index];
+    const int src_w = src.cols;
+    const int src_h = src.rows;
+    LOG_DBG("Letterbox geometry changed [{}]: {}x{}x{} -> {}x{}", index, src_w, src_h, src.channels(), target_w_, target_h_);
+
+    slot.src_w = src_w;
+    slot.src_h = src_h;
+    slot.channels = src.channels();
+
+    const float scale = std::min(static_cast<float>(target_w_) / src_w, static_cast<float>(target_h_) / src_h);
+    auto &info = slot.info;
+    info.scale = scale;
+    info.resized_w = std::clamp(static_cast<int>(std::round(src_w * scale)), 1, target_w_);
+    info.resized_h = std::clamp(static_cast<int>(std::round(src_h * scale)), 1, target_h_);
+    info.pad_x = (target_w_ - info.resized_w) / 2;
+    info.pad_y = (target_h_ - info.resized_h) / 2;
+
+    buildLinearTable(src_w, info.resized_w, slot.x_ofs, slot.x_alpha);
+    buildLinearTable(src_h, info.resized_h, slot.y_ofs, slot.y_alpha);
+
+    // 패딩 영역은 매 프레임 같으므로 이 이미지의 텐서 영역 전체를 한 번만 채워 둔다
+    const size_t image_size = static_cast<size_t>(kMaxChannels) * target_w_ * target_h_;
+    switch (spec_.depth)
+    {
+    case CV_16F:
+        fillImage<cv::float16_t>(blob_, image_size * index, image_size, spec_);
+        break;
+    case CV_8U:
+        fillImage<uchar>(blob_, image_size * index, image_size, spec_);
+        break;
+    case CV_8S:
+        fillImage<schar>(blob_, image_size * index, image_size, spec_);
+        break;
+    default:
+        fillImage<float>(blob_, image_size * index, image_size, spec_);
+        break;
+    }
+}
+
+void LetterboxPreprocessor::processRows(int index, const cv::Mat &src, bool swap_rb, int begin, int end)
+{
+    switch (spec_.depth)
+    {
+    case CV_16F:
+        this->processRowsAs<cv::float16_t>(index, src, swap_rb, begin, end);
+        break;
+    case CV_8U:
+        this->processRowsAs<uchar>(index, src, swap_rb, begin, end);
+        break;
+    case CV_8S:
+        this->processRowsAs<schar>(index, src, swap_rb, begin, end);
+        break;
+    default:
+        this->processRowsAs<float>(index, src, swap_rb, begin, end);
+        break;
+    }
+}
+
+template <typename T>
+void LetterboxPreprocessor::processRowsAs(int index, const cv::Mat &src, bool swap_rb, int begin, int end)
+{
+    const auto &slot = slots_[index];
+    const auto &info = slot.info;
+    const int cn = slot.channels;
+    const int row_len = slot.src_w * cn;
+    const size_t plane_size = static_cast<size_t>(target_w_) * target_h_;
+
+    // 출력 채널(R, G, B) 별 입력 채널. MONO 는 같은 채널을 3번 사용
+    int src_channel[kMaxChannels] = {0, 0, 0};
+    if (cn == kMaxChannels)
+    {
+        src_channel[0] = swap_rb ? 2 : 0;
+        src_channel[1] = 1;
+        src_channel[2] = swap_rb ? 0 : 2;
+    }
+
+    // 세로 보간 결과 행 (스레드별 재사용)
+    thread_local std::vector<float> blended;
+    blended.resize(row_len);
+
+    const ValueWriter<T> write(spec_);
+    auto *planes = blob_.ptr<T>() + plane_size * kMaxChannels * index;
+    for (int dy = begin; dy < end; ++dy)
+    {
+        const int sy = slot.y_ofs[dy];
+        const int sy1 = std::min(sy + 1, slot.src_h - 1);
+        blendRows(src.ptr<uchar>(sy), src.ptr<uchar>(sy1), slot.y_alpha[dy], blended.data(), row_len);
+
+        const size_t out_offset = static_cast<size_t>(info.pad_y + dy) * target_w_ + info.pad_x;
+        T *out[kMaxChannels] = {planes + out_offset, planes + plane_size + out_offset, planes + 2 * plane_size + out_offset};
+
+        for (int dx = 0; dx < info.resized_w; ++dx)
+        {
+            const int sx = slot.x_ofs[dx];
+            const int i0 = sx * cn;
+            const int i1 = std::min(sx + 1, slot.src_w - 1) * cn;
+            const float wx = slot.x_alpha[dx];
+
+            for (int c = 0; c < kMaxChannels; ++c)
+            {
+                const float a = blended[i0 + src_channel[c]];
+                const float b = blended[i1 + src_channel[c]];
+                out[c][dx] = write(a + (b - a) * wx);
+            }
+        }
+    }
+}
+
+} // namespace vp::adapter::out
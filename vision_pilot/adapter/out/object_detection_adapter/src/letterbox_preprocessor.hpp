@@ -0,0 +1,87 @@
+#pragma once
+
+#include "tensor_spec.hpp"
+#include <opencv2/core/mat.hpp>
+#include <vector>
+
+namespace vp::adapter::out
+{
+
+// 원본 좌표 복원에 필요한 레터박스 변환 정보
+struct LetterboxInfo
+{
+    float scale = 1.0f; // 원본 -> 입력 텐서 배율
+    int pad_x = 0;      // 좌측 패딩 (px)
+    int pad_y = 0;      // 상단 패딩 (px)
+    int resized_w = 0;  // 패딩 제외 리사이즈 영역 크기
+    int resized_h = 0;
+};
+
+struct LetterboxInput
+{
+    cv::Mat image;        // 8bit 1채널 또는 3채널
+    bool swap_rb = false; // 입력이 BGR 이면 true
+};
+
+/**
+ * @brief 8bit BGR/RGB/MONO 이미지를 YOLO 입력 텐서(Nx3xHxW, RGB, 0~1 float)로 한 번에 변환
+ *
+ * 색 변환, 레터박스 리사이즈(bilinear, cv::resize INTER_LINEAR 와 동일한 좌표 매핑),
+ * 패딩(114), 정규화, HWC -> CHW 변환을 출력 행 단위로 한 패스에 수행한다.
+ * 행은 cv::parallel_for_ 로 나누어 처리하며, 세로 보간은 SIMD 로 계산한다.
+ * 출력 원소 형식은 setTensorSpec 으로 바꿀 수 있다 (FP16, 양자화 INT8/UINT8 모델 입력).
+ * 출력 텐서와 보간 테이블은 입력/출력 크기가 바뀔 때만 다시 만든다 (배치 내 이미지별로 유지).
+ * 스레드 안전하지 않으므로 인스턴스당 하나의 스레드에서만 호출해야 한다.
+ */
+class LetterboxPreprocessor
+{
+public:
+    static constexpr float kPadValue = 114.0f;
+
+    // 원본 비율로 max_size 안에 맞춘 리사이즈 크기를 stride 배수로 올린 입력 크기 (직사각형 레터박스, 패딩 최소화)
+    // 예: 1920x1080, 640x640, 32 -> 640x384
+    static cv::Size fitInputSize(const cv::Size &image, const cv::Size &max_size, int stride);
+
+    // 출력 텐서 형식 (기본: CV_32F). 양자화 형식이면 정규화 값(0~1)을 scale/zero_point 로 양자화하여 저장
+    void setTensorSpec(const TensorSpec &spec);
+    const TensorSpec &tensorSpec() const { return spec_; }
+
+    // swap_rb: 입력이 BGR 이면 true. 반환 텐서(1x3xHxW)는 내부 버퍼이며 다음 호출 전까지 유효
+    const cv::Mat &run(const cv::Mat &src, bool swap_rb, int target_w, int target_h, LetterboxInfo &info);
+
+    // 이미지별 크기가 달라도 됨. infos 는 inputs 와 같은 순서
+    const cv::Mat &runBatch(const std::vector<LetterboxInput> &inputs, int target_w, int target_h, std::vector<LetterboxInfo> &infos);
+
+private:
+    // 배치 내 이미지 하나의 변환 기하 정보
+    struct Slot
+    {
+        int src_w = 0;
+        int src_h = 0;
+        int channels = 0;
+        LetterboxInfo info;
+
+        // 출력 x/y -> 원본 좌표 (왼쪽 샘플 인덱스, 오른쪽 가중치)
+        std::vector<int> x_ofs;
+        std::vector<float> x_alpha;
+        std::vector<int> y_ofs;
+        std::vector<float> y_alpha;
+    };
+
+    void prepareBlob(int batch, int target_w, int target_h);
+    void prepareSlot(int index, const cv::Mat &src);
+    void processRows(int index, const cv::Mat &src, bool swap_rb, int begin, int end);
+    template <typename T>
+    void processRowsAs(int index, const cv::Mat &src, bool swap_rb, int begin, int end);
+
+    TensorSpec spec_;
+    int target_w_ = 0;
+    int target_h_ = 0;
+    std::vector<Slot> slots_;
+    std::vector<LetterboxInput> single_input_; // run() 용 (할당 재사용)
+    std::vector<LetterboxInfo> single_info_;
+
+    cv::Mat blob_; // Nx3xHxW (spec_.depth)
+};
+
+} // namespace vp::adapter::out
@@ -0,0 +1,58 @@
+#include "model_registry_adapter.hpp"
+#include "gaia_log.hpp"
+#include "model_registry_adapter_impl.hpp"
+
+namespace vp::adapter::out
+{
+ModelRegistryAdapter::ModelRegistryAdapter(const config::ModelRegistryConfig &config) : impl_(std::make_unique<ModelRegistryAdapterImpl>(config))
+{
+    LOG_TRA("");
+}
+
+ModelRegistryAdapter::~ModelRegistryAdapter()
+{
+    LOG_TRA("");
+}
+
+bool ModelRegistryAdapter::initialize()
+{
+    return impl_->initialize();
+}
+
+std::vector<vp::domain::model::Detection> ModelRegistryAdapter::detectObject(const vp::domain::model::ImagePacket &image)
+{
+    return impl_->detectObject(image, vp::port::out::DetectionLevel::FULL);
+}
+
+std::vector<vp::domain::model::Detection> ModelRegistryAdapter::detectObject(const vp::domain::model::ImagePacket &image, vp::port::out::DetectionLevel level)
+{
+    return impl_->detectObject(image, level);
+}
+
+std::vector<vp::domain::model::Detection> ModelRegistryAdapter::detectObjectInRegions(const vp::domain::model::ImagePacket &image,
+                                                                                      const std::vector<vp::domain::model::BoundingBox> &regions,
+                                                                                      vp::port::out::DetectionLevel level)
+{
+    return impl_->detectObjectInRegions(image, regions, level);
+}
+
+bool ModelRegistryAdapter::supportsLevel(vp::port::out::DetectionLevel level) const
+{
+    return impl_->supportsLevel(level);
+}
+
+std::vector<std::vector<vp::domain::model::Detection>> ModelRegistryAdapter::detectObjects(const std::vector<const vp::domain::model::ImagePacket *> &images, vp::port::out::DetectionLevel level)
+{
+    return impl_->detectObjects(images, level);
+}
+
+bool ModelRegistryAdapter::deinitialize()
+{
+    return impl_->deinitialize();
+}
+
+bool ModelRegistryAdapter::reloadModel(const std::string &name, const std::string &model_path)
+{
+    return impl_->reloadModel(name, model_path);
+}
+} // namespace vp::adapter::out
@@ -0,0 +1,319 @@
+#include "model_registry_adapter_impl.hpp"
+#include "gaia_log.hpp"
+#include "gaia_trace.hpp"
+#include "yolov8_adapter_impl.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+using vp::domain::model::BoundingBox;
+
+float iou(const BoundingBox &a, const BoundingBox &b)
+{
+    const float w = std::min(a.x + a.width, b.x + b.width) - std::max(a.x, b.x);
+    const float h = std::min(a.y + a.height, b.y + b.height) - std::max(a.y, b.y);
+    if (w <= 0.0f || h <= 0.0f)
+    {
+        return 0.0f;
+    }
+    const float inter = w * h;
+    return inter / (a.width * a.height + b.width * b.height - inter);
+}
+
+class YoloRegistryDetector : public vp::adapter::out::RegistryDetector
+{
+public:
+    explicit YoloRegistryDetector(const vp::config::YoloConfig &config) : detector_(config) {}
+
+    bool initialize() override { return detector_.initialize(); }
+    cv::Size inputSize() const override { return detector_.inputSize(); }
+    vp::adapter::out::TensorSpec inputSpec() const override { return detector_.inputSpec(); }
+    void setSharedPreprocessor(vp::adapter::out::SharedPreprocessor *preprocessor) override { detector_.setSharedPreprocessor(preprocessor); }
+    bool reloadModel(const std::string &model_path) override { return detector_.reloadModel(model_path); }
+    bool supportsLevel(vp::port::out::DetectionLevel level) const override { return detector_.supportsLevel(level); }
+
+    std::vector<std::vector<vp::domain::model::Detection>> detectObjects(const std::vector<const vp::domain::model::ImagePacket *> &images,
+                                                                         vp::port::out::DetectionLevel level) override
+    {
+        return detector_.detectObjects(images, level);
+    }
+
+    std::vector<vp::domain::model::Detection> detectObjectInRegions(const vp::domain::model::ImagePacket &image, const std::vector<BoundingBox> &regions,
+                                                                    vp::port::out::DetectionLevel level) override
+    {
+        return detector_.detectObjectInRegions(image, regions, level);
+    }
+
+private:
+    vp::adapter::out::YOLOv8AdapterImpl detector_;
+};
+} // namespace
+
+namespace vp::adapter::out
+{
+std::unique_ptr<RegistryDetector> createYoloRegistryDetector(const config::YoloConfig &config)
+{
+    return std::make_unique<YoloRegistryDetector>(config);
+}
+
+ModelRegistryAdapterImpl::ModelRegistryAdapterImpl(const config::ModelRegistryConfig &config, DetectorFactory factory)
+    : config_(config), factory_(std::move(factory))
+{
+    LOG_TRA("");
+}
+
+ModelRegistryAdapterImpl::~ModelRegistryAdapterImpl()
+{
+    LOG_TRA("");
+    this->deinitialize();
+}
+
+bool ModelRegistryAdapterImpl::initialize()
+{
+    LOG_INF("Initializing model registry ({} models)...", config_.models.size());
+
+    if (is_initialized_)
+    {
+        LOG_DBG("Model registry is already initialized.");
+        return true;
+    }
+    if (config_.models.empty() || config_.models.size() > std::numeric_limits<uint8_t>::max() + 1u)
+    {
+        LOG_ERR("Invalid number of registry models: {}", config_.models.size());
+        return false;
+    }
+
+    for (size_t i = 0; i < config_.models.size(); ++i)
+    {
+        const auto &model_config = config_.models[i];
+        auto model = std::make_unique<Model>();
+        model->config = &model_config;
+        model->index = static_cast<uint8_t>(i);
+        model->detector = factory_ ? factory_(model_config) : createYoloRegistryDetector(model_config.yolo);
+        if (model->detector == nullptr || !model->detector->initialize())
+        {
+            LOG_ERR("Failed to initialize registry model '{}': {}", model_config.name, model_config.yolo.modelPath);
+            models_.clear();
+            groups_.clear();
+            return false;
+        }
+
+        // 입력 크기/형식이 같은 모델끼리 전처리 결과 공유
+        const auto input_size = model->detector->inputSize();
+        const auto spec = model->detector->inputSpec();
+        auto group = std::find_if(groups_.begin(), groups_.end(), [&](const std::unique_ptr<InputGroup> &g)
+                                  { return g->input_size == input_size && g->spec == spec; });
+        if (group == groups_.end())
+        {
+            groups_.push_back(std::make_unique<InputGroup>());
+            group = std::prev(groups_.end());
+            (*group)->input_size = input_size;
+            (*group)->spec = spec;
+            (*group)->preprocessor.setTensorSpec(spec);
+        }
+        (*group)->models.push_back(i);
+        model->detector->setSharedPreprocessor(&(*group)->preprocessor);
+
+        LOG_INF("Registry model '{}' loaded ({}x{}, interval {} ms, input group {}).", model_config.name, input_size.width, input_size.height,
+                model_config.minIntervalMs, std::distance(groups_.begin(), group));
+        models_.push_back(std::move(model));
+    }
+
+    // 모델 수보다 많은 스레드는 쓸 일이 없음
+    pool_ = std::make_unique<InferencePool>(std::min(std::max(1, config_.numWorkers), static_cast<int>(models_.size())), config_.workerAffinity);
+    LOG_INF("Model registry initialized: {} models, {} input groups, {} threads.", models_.size(), groups_.size(), pool_->threadCount());
+    is_initialized_ = true;
+    return true;
+}
+
+bool ModelRegistryAdapterImpl::deinitialize()
+{
+    LOG_TRA("");
+    if (!is_initialized_)
+    {
+        return true;
+    }
+    pool_.reset();
+    models_.clear();
+    groups_.clear();
+    is_initialized_ = false;
+    return true;
+}
+
+bool ModelRegistryAdapterImpl::reloadModel(const std::string &name, const std::string &model_path)
+{
+    // models_ 는 초기화 이후 바뀌지 않고, 전환은 각 모델의 탐지 호출 시작 시 이루어지므로 탐지 스레드와 동기화하지 않음
+    const auto model = std::find_if(models_.begin(), models_.end(), [&](const std::unique_ptr<Model> &m)
+                                    { return m->config->name == name; });
+    if (model == models_.end())
+    {
+        LOG_ERR("Unknown registry model: {}", name);
+        return false;
+    }
+    return (*model)->detector->reloadModel(model_path);
+}
+
+bool ModelRegistryAdapterImpl::supportsLevel(vp::port::out::DetectionLevel level) const
+{
+    // 한 모델이라도 가볍게 실행되면 REDUCED 로 부하를 줄일 수 있음
+    return std::any_of(models_.begin(), models_.end(), [&](const std::unique_ptr<Model> &model)
+                       { return model->detector->supportsLevel(level); });
+}
+
+std::vector<vp::domain::model::Detection> ModelRegistryAdapterImpl::detectObject(const vp::domain::model::ImagePacket &image, vp::port::out::DetectionLevel level)
+{
+    single_image_.assign(1, &image);
+    auto results = this->detectObjects(single_image_, level);
+    return std::move(results.front());
+}
+
+std::vector<vp::domain::model::Detection> ModelRegistryAdapterImpl::detectObjectInRegions(const vp::domain::model::ImagePacket &image,
+                                                                                          const std::vector<vp::domain::model::BoundingBox> &regions,
+                                                                                          vp::port::out::DetectionLevel level)
+{
+    std::vector<std::vector<vp::domain::model::Detection>> results(1);
+    if (!is_initialized_)
+    {
+        LOG_ERR("Model registry not initialized.");
+        return {};
+    }
+
+    single_image_.assign(1, &image);
+    this->schedule(single_image_);
+    this->runModels(&regions, level);
+    this->merge(results);
+    return std::move(results.front());
+}
+
+std::vector<std::vector<vp::domain::model::Detection>> ModelRegistryAdapterImpl::detectObjects(const std::vector<const vp::domain::model::ImagePacket *> &images,
+                                                                                               vp::port::out::DetectionLevel level)
+{
+    std::vector<std::vector<vp::domain::model::Detection>> results(images.size());
+    if (!is_initialized_)
+    {
+        LOG_ERR("Model registry not initialized.");
+        return results;
+    }
+
+    this->schedule(images);
+    this->runModels(nullptr, level);
+    this->merge(results);
+    return results;
+}
+
+void ModelRegistryAdapterImpl::schedule(const std::vector<const vp::domain::model::ImagePacket *> &images)
+{
+    for (auto &model : models_)
+    {
+        model->packets.clear();
+        model->result_index.assign(images.size(), kNoResult);
+        const bool hold = model->config->holdResults;
+        for (size_t i = 0; i < images.size(); ++i)
+        {
+            // 읽는 속도와 무관하도록 소스 시각 기준. 시각이 되돌아가면 (새 입력 등) 바로 실행
+            const uint64_t time = images[i]->source_time;
+            const bool due = !model->has_run || time < model->last_run_ms || time - model->last_run_ms >= model->config->minIntervalMs;
+            if (due)
+            {
+                model->packets.push_back(images[i]);
+                model->has_run = true;
+                model->last_run_ms = time;
+            }
+            else if (!hold)
+            {
+                continue;
+            }
+            // 건너뛴 이미지는 가장 최근 실행 결과 (이번 호출에서 아직 실행 전이면 이전 호출 결과)
+            model->result_index[i] = model->packets.empty() ? kLastResults : static_cast<int>(model->packets.size()) - 1;
+        }
+    }
+}
+
+void ModelRegistryAdapterImpl::runModels(const std::vector<vp::domain::model::BoundingBox> *regions, vp::port::out::DetectionLevel level)
+{
+    // 이전 호출의 변환 결과는 버림 (프레임 버퍼가 재사용될 수 있음). 같은 묶음의 모델은 먼저 변환한 텐서를 공유
+    for (auto &group : groups_)
+    {
+        group->preprocessor.reset();
+    }
+
+    pool_->run(models_.size(), [&](size_t m)
+               {
+        TRACE_SCOPE("registry.model");
+        auto &model = *models_[m];
+        if (model.packets.empty())
+        {
+            model.results.clear();
+            return;
+        }
+        if (regions != nullptr)
+        {
+            model.results.resize(1);
+            model.results[0] = model.detector->detectObjectInRegions(*model.packets[0], *regions, level);
+        }
+        else
+        {
+            model.results = model.detector->detectObjects(model.packets, level);
+        } });
+}
+
+void ModelRegistryAdapterImpl::merge(std::vector<std::vector<vp::domain::model::Detection>> &results)
+{
+    TRACE_SCOPE("registry.merge");
+    for (auto &model : models_)
+    {
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const int index = model->result_index[i];
+            if (index == kLastResults)
+            {
+                this->appendMerged(*model, model->last_results, results[i]);
+            }
+            else if (index >= 0 && static_cast<size_t>(index) < model->results.size())
+            {
+                this->appendMerged(*model, model->results[index], results[i]);
+            }
+        }
+        if (!model->results.empty())
+        {
+            model->last_results = model->results.back();
+        }
+    }
+}
+
+void ModelRegistryAdapterImpl::appendMerged(const Model &model, const std::vector<vp::domain::model::Detection> &detections,
+                                            std::vector<vp::domain::model::Detection> &merged) const
+{
+    const auto &class_map = model.config->classMap;
+    const size_t previous = merged.size(); // 앞선 모델의 결과와만 비교
+    for (auto detection : detections)
+    {
+        if (!class_map.empty())
+        {
+            const int raw = static_cast<int>(detection.class_id);
+            if (raw < 0 || raw >= static_cast<int>(class_map.size()) || class_map[raw] < 0)
+            {
+                continue;
+            }
+            detection.class_id = static_cast<vp::domain::model::ClassId>(class_map[raw]);
+        }
+        detection.model = model.index;
+
+        if (config_.mergeIou > 0.0f)
+        {
+            const auto duplicate = std::find_if(merged.begin(), merged.begin() + previous, [&](const vp::domain::model::Detection &other)
+                                                { return other.class_id == detection.class_id && iou(other.bbox, detection.bbox) >= config_.mergeIou; });
+            if (duplicate != merged.begin() + previous)
+            {
+                if (detection.confidence > duplicate->confidence)
+                {
+                    *duplicate = detection;
+                }
+                continue;
+            }
+        }
+        merged.push_back(detection);
+    }
+}
+} // namespace vp::adapter::out
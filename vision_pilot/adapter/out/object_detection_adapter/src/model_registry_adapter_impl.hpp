@@ -0,0 +1,82 @@
+#pragma once
+
+#include "detection.hpp"
+#include "image.hpp"
+#include "inference_pool.hpp"
+#include "model_registry_config.hpp"
+#include "object_detection_port.hpp"
+#include "registry_detector.hpp"
+#include "shared_preprocessor.hpp"
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace vp::adapter::out
+{
+class ModelRegistryAdapterImpl
+{
+public:
+    // 모델 설정으로 탐지기 생성 (테스트에서 가짜 탐지기 주입용)
+    using DetectorFactory = std::function<std::unique_ptr<RegistryDetector>(const config::DetectorModelConfig &)>;
+
+    // factory 가 비어 있으면 YOLOv8 탐지기 사용
+    ModelRegistryAdapterImpl(const config::ModelRegistryConfig &config, DetectorFactory factory = nullptr);
+    ~ModelRegistryAdapterImpl();
+
+    bool initialize();
+    std::vector<vp::domain::model::Detection> detectObject(const vp::domain::model::ImagePacket &image, vp::port::out::DetectionLevel level);
+    std::vector<vp::domain::model::Detection> detectObjectInRegions(const vp::domain::model::ImagePacket &image,
+                                                                    const std::vector<vp::domain::model::BoundingBox> &regions,
+                                                                    vp::port::out::DetectionLevel level);
+    std::vector<std::vector<vp::domain::model::Detection>> detectObjects(const std::vector<const vp::domain::model::ImagePacket *> &images, vp::port::out::DetectionLevel level);
+    bool deinitialize();
+    bool reloadModel(const std::string &name, const std::string &model_path);
+    bool supportsLevel(vp::port::out::DetectionLevel level) const;
+
+private:
+    struct Model
+    {
+        const config::DetectorModelConfig *config = nullptr;
+        uint8_t index = 0; // 등록 순서 (Detection::model)
+        std::unique_ptr<RegistryDetector> detector;
+        bool has_run = false;
+        uint64_t last_run_ms = 0; // 마지막 실행 프레임의 소스 시각 (실행 간격 판단)
+        std::vector<vp::domain::model::Detection> last_results; // 마지막 실행 결과 (holdResults)
+
+        // 이번 호출에서 실행할 이미지와 결과 (호출마다 재사용)
+        std::vector<const vp::domain::model::ImagePacket *> packets;
+        std::vector<int> result_index; // 요청 이미지별 사용할 results 인덱스 (kLastResults / kNoResult)
+        std::vector<std::vector<vp::domain::model::Detection>> results;
+    };
+
+    static constexpr int kNoResult = -1;    // 이 모델의 결과 없음
+    static constexpr int kLastResults = -2; // 이전 호출의 마지막 결과 사용
+
+    // 전처리를 공유하는 모델 묶음 (입력 크기/형식이 같음). 먼저 실행된 모델이 변환한 텐서를 나머지 모델이 재사용
+    struct InputGroup
+    {
+        cv::Size input_size;
+        TensorSpec spec;
+        SharedPreprocessor preprocessor;
+        std::vector<size_t> models;
+    };
+
+    // 요청 이미지마다 실행 간격이 지난 모델을 골라 Model::packets / result_index 구성
+    void schedule(const std::vector<const vp::domain::model::ImagePacket *> &images);
+    // 모델마다 풀 작업 하나로 실행 (같은 묶음의 모델도 동시에 추론). regions != nullptr 이면 영역 탐지 (이미지 1장)
+    void runModels(const std::vector<vp::domain::model::BoundingBox> *regions, vp::port::out::DetectionLevel level);
+    // 모델별 결과를 요청 이미지별로 합침 (등록 순서, 앞선 모델과 겹치는 같은 클래스 박스는 점수가 높은 쪽만 유지)
+    void merge(std::vector<std::vector<vp::domain::model::Detection>> &results);
+    void appendMerged(const Model &model, const std::vector<vp::domain::model::Detection> &detections,
+                      std::vector<vp::domain::model::Detection> &merged) const;
+
+    const config::ModelRegistryConfig &config_;
+    DetectorFactory factory_;
+    bool is_initialized_ = false;
+    std::vector<std::unique_ptr<Model>> models_;
+    std::vector<std::unique_ptr<InputGroup>> groups_; // 모델이 공유 전처리기 주소를 보관하므로 unique_ptr 로 유지
+    std::unique_ptr<InferencePool> pool_;
+    std::vector<const vp::domain::model::ImagePacket *> single_image_; // detectObject 용 (할당 재사용)
+};
+} // namespace vp::adapter::out
@@ -0,0 +1,89 @@
+#include "mosaic_packer.hpp"
+#include <algorithm>
+#include <numeric>
+#include <opencv2/imgproc.hpp>
+
+namespace vp::adapter::out
+{
+
+int MosaicPacker::pack(const std::vector<cv::Rect> &regions, const cv::Size &frame_size, const cv::Size &canvas_size, std::vector<MosaicCell> &cells)
+{
+    cells.clear();
+    order_.resize(regions.size());
+    std::iota(order_.begin(), order_.end(), 0);
+    std::stable_sort(order_.begin(), order_.end(), [&](int a, int b)
+                     { return regions[a].height > regions[b].height; });
+
+    int canvas = 0;
+    int x = 0;
+    int y = 0;
+    int shelf_h = 0;
+    bool used = false;
+    for (int index : order_)
+    {
+        const cv::Rect src = regions[index] & cv::Rect(0, 0, frame_size.width, frame_size.height);
+        if (src.empty())
+        {
+            continue;
+        }
+
+        MosaicCell cell;
+        cell.src = src;
+        cell.scale = std::min({1.0f, static_cast<float>(canvas_size.width) / src.width, static_cast<float>(canvas_size.height) / src.height});
+        const int w = std::max(1, static_cast<int>(src.width * cell.scale));
+        const int h = std::max(1, static_cast<int>(src.height * cell.scale));
+
+        // 현재 선반에 안 들어가면 다음 선반, 캔버스에 안 들어가면 다음 캔버스
+        if (x > 0 && x + w > canvas_size.width)
+        {
+            x = 0;
+            y += shelf_h + kCellGap;
+            shelf_h = 0;
+        }
+        if (y > 0 && y + h > canvas_size.height)
+        {
+            ++canvas;
+            x = 0;
+            y = 0;
+            shelf_h = 0;
+        }
+
+        cell.canvas = canvas;
+        cell.dst = cv::Rect(x, y, w, h);
+        cell.cut_left = src.x > 0;
+        cell.cut_top = src.y > 0;
+        cell.cut_right = src.x + src.width < frame_size.width;
+        cell.cut_bottom = src.y + src.height < frame_size.height;
+        cells.push_back(cell);
+
+        x += w + kCellGap;
+        shelf_h = std::max(shelf_h, h);
+        used = true;
+    }
+    return used ? canvas + 1 : 0;
+}
+
+void MosaicPacker::compose(const cv::Mat &frame, const std::vector<MosaicCell> &cells, int canvas_index, const cv::Size &canvas_size,
+                           double pad_value, cv::Mat &canvas)
+{
+    canvas.create(canvas_size.height, canvas_size.width, frame.type());
+    canvas.setTo(cv::Scalar::all(pad_value));
+    for (const auto &cell : cells)
+    {
+        if (cell.canvas != canvas_index)
+        {
+            continue;
+        }
+        auto dst = canvas(cell.dst);
+        if (cell.dst.size() == cell.src.size())
+        {
+            frame(cell.src).copyTo(dst);
+        }
+        else
+        {
+            cv::resize(frame(cell.src), dst, cell.dst.size(), 0.0, 0.0, cv::INTER_AREA);
+        }
+    }
+}
+
+} // namespace vp::adapter::out
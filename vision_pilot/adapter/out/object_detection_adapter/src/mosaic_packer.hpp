@@ -0,0 +1,45 @@
+#pragma once
+
+#include <opencv2/core/mat.hpp>
+#include <opencv2/core/types.hpp>
+#include <vector>
+
+namespace vp::adapter::out
+{
+
+// 캔버스에 배치된 원본 영역 하나
+struct MosaicCell
+{
+    int canvas = 0;        // 캔버스 인덱스
+    cv::Rect src;          // 원본 프레임 영역
+    cv::Rect dst;          // 캔버스 내 위치
+    float scale = 1.0f;    // dst / src (1 이하)
+    bool cut_left = false; // true: 해당 변이 프레임 경계가 아님 (이 변에 닿은 박스는 잘린 박스)
+    bool cut_top = false;
+    bool cut_right = false;
+    bool cut_bottom = false;
+};
+
+/**
+ * @brief 여러 ROI 를 모델 입력 크기의 캔버스에 원본 해상도로 모아 한 번에 추론하기 위한 배치기
+ *
+ * 높이 순으로 정렬한 뒤 선반(shelf) 방식으로 왼쪽에서 오른쪽, 위에서 아래로 채운다.
+ * 캔버스보다 큰 영역만 축소하며, 셀 사이에는 패딩 간격을 두어 객체가 이어 붙지 않게 한다.
+ */
+class MosaicPacker
+{
+public:
+    static constexpr int kCellGap = 8;
+
+    // 반환: 필요한 캔버스 수. cells 는 배치 순서 (프레임 밖으로 벗어나 비는 영역은 제외)
+    int pack(const std::vector<cv::Rect> &regions, const cv::Size &frame_size, const cv::Size &canvas_size, std::vector<MosaicCell> &cells);
+
+    // 셀 영역을 캔버스에 복사 (필요 시 축소). 나머지는 pad_value 로 채움
+    static void compose(const cv::Mat &frame, const std::vector<MosaicCell> &cells, int canvas_index, const cv::Size &canvas_size,
+                        double pad_value, cv::Mat &canvas);
+
+private:
+    std::vector<int> order_;
+};
+
+} // namespace vp::adapter::out
@@ -0,0 +1,194 @@
+#include "nms_engine.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace vp::adapter::out
+{
+
+void NmsEngine::run(std::vector<DetectionCandidate> &candidates, const NmsOptions &options, std::vector<int> &keep)
+{
+    keep.clear();
+    if (candidates.empty())
+    {
+        return;
+    }
+
+    this->prepare(candidates, options);
+
+    // 클래스별이면 같은 클래스끼리만 비교
+    const size_t count = order_.size();
+    size_t begin = 0;
+    while (begin < count)
+    {
+        size_t end = count;
+        if (options.per_class)
+        {
+            end = begin + 1;
+            while (end < count && class_id_[end] == class_id_[begin])
+            {
+                ++end;
+            }
+        }
+
+        if (options.method == config::NmsMethod::HARD)
+        {
+            this->suppressHard(begin, end, options.iou_threshold, keep);
+        }
+        else
+        {
+            this->suppressSoft(begin, end, options, keep);
+        }
+        begin = end;
+    }
+
+    // keep 은 order_ 위치. 감쇠된 점수를 반영하고 원래 인덱스로 변환
+    std::sort(keep.begin(), keep.end(), [this](int a, int b)
+              { return score_[a] != score_[b] ? score_[a] > score_[b] : a < b; });
+    if (options.max_detections > 0 && keep.size() > static_cast<size_t>(options.max_detections))
+    {
+        keep.resize(options.max_detections);
+    }
+    for (auto &k : keep)
+    {
+        candidates[order_[k]].score = score_[k];
+        k = order_[k];
+    }
+}
+
+void NmsEngine::prepare(const std::vector<DetectionCandidate> &candidates, const NmsOptions &options)
+{
+    order_.resize(candidates.size());
+    for (size_t i = 0; i < order_.size(); ++i)
+    {
+        order_[i] = static_cast<int>(i);
+    }
+
+    auto by_score = [&candidates](int a, int b)
+    {
+        const float sa = candidates[a].score;
+        const float sb = candidates[b].score;
+        return sa != sb ? sa > sb : a < b;
+    };
+
+    // 정렬 전에 상위 top_k 만 남김
+    if (options.top_k > 0 && order_.size() > static_cast<size_t>(options.top_k))
+    {
+        std::nth_element(order_.begin(), order_.begin() + options.top_k, order_.end(), by_score);
+        order_.resize(options.top_k);
+    }
+
+    if (options.per_class)
+    {
+        std::sort(order_.begin(), order_.end(), [&](int a, int b)
+                  { return candidates[a].class_id != candidates[b].class_id ? candidates[a].class_id < candidates[b].class_id : by_score(a, b); });
+    }
+    else
+    {
+        std::sort(order_.begin(), order_.end(), by_score);
+    }
+
+    const size_t count = order_.size();
+    class_id_.resize(count);
+    x1_.resize(count);
+    y1_.resize(count);
+    x2_.resize(count);
+    y2_.resize(count);
+    area_.resize(count);
+    score_.resize(count);
+    removed_.assign(count, 0);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const auto &c = candidates[order_[i]];
+        class_id_[i] = c.class_id;
+        x1_[i] = c.cx - 0.5f * c.w;
+        y1_[i] = c.cy - 0.5f * c.h;
+        x2_[i] = c.cx + 0.5f * c.w;
+        y2_[i] = c.cy + 0.5f * c.h;
+        area_[i] = std::max(0.0f, c.w) * std::max(0.0f, c.h);
+        score_[i] = c.score;
+    }
+}
+
+void NmsEngine::suppressHard(size_t begin, size_t end, float iou_threshold, std::vector<int> &keep)
+{
+    for (size_t i = begin; i < end; ++i)
+    {
+        if (removed_[i])
+        {
+            continue;
+        }
+        keep.push_back(static_cast<int>(i));
+
+        // IoU > threshold  <=>  inter > threshold * union. 분기 없이 작성하여 자동 벡터화
+        const float ix1 = x1_[i];
+        const float iy1 = y1_[i];
+        const float ix2 = x2_[i];
+        const float iy2 = y2_[i];
+        const float iarea = area_[i];
+        for (size_t j = i + 1; j < end; ++j)
+        {
+            const float w = std::max(0.0f, std::min(ix2, x2_[j]) - std::max(ix1, x1_[j]));
+            const float h = std::max(0.0f, std::min(iy2, y2_[j]) - std::max(iy1, y1_[j]));
+            const float inter = w * h;
+            removed_[j] |= static_cast<uint8_t>(inter > iou_threshold * (iarea + area_[j] - inter));
+        }
+    }
+}
+
+void NmsEngine::suppressSoft(size_t begin, size_t end, const NmsOptions &options, std::vector<int> &keep)
+{
+    const bool gaussian = options.method == config::NmsMethod::SOFT_GAUSSIAN;
+    const float inv_sigma = options.sigma > 0.0f ? 1.0f / options.sigma : 0.0f;
+
+    while (true)
+    {
+        // 남은 후보 중 최고 점수 선택 (감쇠로 순서가 바뀌므로 매번 탐색)
+        size_t best = end;
+        for (size_t j = begin; j < end; ++j)
+        {
+            if (!removed_[j] && (best == end || score_[j] > score_[best]))
+            {
+                best = j;
+            }
+        }
+        if (best == end)
+        {
+            return;
+        }
+        removed_[best] = 1;
+        keep.push_back(static_cast<int>(best));
+
+        for (size_t j = begin; j < end; ++j)
+        {
+            if (removed_[j])
+            {
+                continue;
+            }
+            const float w = std::max(0.0f, std::min(x2_[best], x2_[j]) - std::max(x1_[best], x1_[j]));
+            const float h = std::max(0.0f, std::min(y2_[best], y2_[j]) - std::max(y1_[best], y1_[j]));
+            const float inter = w * h;
+            const float uni = area_[best] + area_[j] - inter;
+            const float iou = uni > 0.0f ? inter / uni : 0.0f;
+
+            if (gaussian)
+            {
+                score_[j] *= std::exp(-(iou * iou) * inv_sigma);
+            }
+            else if (iou > options.iou_threshold)
+            {
+                score_[j] *= 1.0f - iou;
+            }
+
+            // 클래스별 신뢰도 기준이 있으면 감쇠된 점수도 그 기준으로 거름
+            const int class_id = class_id_[j];
+            const bool has_class_threshold = class_id >= 0 && class_id < static_cast<int>(options.class_thresholds.size()) &&
+                                             options.class_thresholds[class_id] >= 0.0f;
+            if (score_[j] < (has_class_threshold ? options.class_thresholds[class_id] : options.score_threshold))
+            {
+                removed_[j] = 1;
+            }
+        }
+    }
+}
+
+} // namespace vp::adapter::out
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "yolov8_config.hpp"
+#include "yolov8_decoder.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace vp::adapter::out
+{
+
+struct NmsOptions
+{
+    float iou_threshold = 0.45f;
+    float score_threshold = 0.25f;       // soft 방식에서 감쇠 후 이 값 미만이면 제거
+    std::vector<float> class_thresholds; // 클래스 ID 로 인덱싱한 soft 제거 기준 (범위 밖이거나 음수면 score_threshold)
+    bool per_class = true;         // false: 클래스 무관 (agnostic)
+    config::NmsMethod method = config::NmsMethod::HARD;
+    float sigma = 0.5f;     // SOFT_GAUSSIAN 감쇠 폭
+    int top_k = 0;          // NMS 전 점수 상위 N 개만 사용 (0: 제한 없음)
+    int max_detections = 0; // 결과 최대 개수 (0: 제한 없음)
+};
+
+/**
+ * @brief 후보 박스에 NMS 적용 (클래스별/agnostic, hard/soft)
+ *
+ * 후보를 (클래스, 점수) 순으로 정렬한 뒤 좌표를 SoA 버퍼에 모아 클래스 구간별로 억제한다.
+ * 내부 버퍼는 호출 간 재사용되므로 후보 수가 이전 최대치 이하이면 할당이 없다.
+ * 스레드 안전하지 않음.
+ */
+class NmsEngine
+{
+public:
+    // soft 방식이면 candidates 의 점수를 감쇠된 값으로 갱신. keep: 남은 후보 인덱스 (점수 내림차순)
+    void run(std::vector<DetectionCandidate> &candidates, const NmsOptions &options, std::vector<int> &keep);
+
+private:
+    void prepare(const std::vector<DetectionCandidate> &candidates, const NmsOptions &options);
+    void suppressHard(size_t begin, size_t end, float iou_threshold, std::vector<int> &keep);
+    void suppressSoft(size_t begin, size_t end, const NmsOptions &options, std::vector<int> &keep);
+
+    // order_ 순서로 정렬된 후보 정보
+    std::vector<int> order_;
+    std::vector<int> class_id_;
+    std::vector<float> x1_;
+    std::vector<float> y1_;
+    std::vector<float> x2_;
+    std::vector<float> y2_;
+    std::vector<float> area_;
+    std::vector<float> score_;
+    std::vector<uint8_t> removed_;
+};
+
+} // namespace vp::adapter::out
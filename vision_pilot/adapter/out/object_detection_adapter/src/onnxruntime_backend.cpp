@@ -0,0 +1,140 @@
+#include "onnxruntime_backend.hpp"
+#include "gaia_log.hpp"
+#include <array>
+#include <cstring>
+
+namespace
+{
+// 모델 텐서 원소 형식 -> cv depth. 지원하지 않으면 -1
+int toDepth(ONNXTensorElementDataType type)
+{
+    switch (type)
+    {
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT:
+        return CV_32F;
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16:
+        return CV_16F;
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT8:
+        return CV_8U;
+    default:
+        return -1;
+    }
+}
+} // namespace
+
+namespace vp::adapter::out
+{
+
+OnnxRuntimeBackend::OnnxRuntimeBackend(int num_threads)
+    : num_threads_{num_threads},
+      env_{ORT_LOGGING_LEVEL_WARNING, "vp_yolov8"},
+      memory_info_{Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault)}
+{
+    LOG_TRA("");
+}
+
+bool OnnxRuntimeBackend::load(const std::string &model_path)
+{
+    try
+    {
+        Ort::SessionOptions options;
+        options.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_ENABLE_ALL);
+        if (num_threads_ > 0)
+        {
+            options.SetIntraOpNumThreads(num_threads_);
+        }
+        session_ = std::make_unique<Ort::Session>(env_, model_path.c_str(), options);
+
+        Ort::AllocatorWithDefaultOptions allocator;
+        input_name_ = session_->GetInputNameAllocated(0, allocator).get();
+        output_name_ = session_->GetOutputNameAllocated(0, allocator).get();
+        proto_name_.clear();
+        if (session_->GetOutputCount() > 1)
+        {
+            proto_name_ = session_->GetOutputNameAllocated(1, allocator).get();
+        }
+
+        input_type_ = session_->GetInputTypeInfo(0).GetTensorTypeAndShapeInfo().GetElementType();
+        const auto output_type = session_->GetOutputTypeInfo(0).GetTensorTypeAndShapeInfo().GetElementType();
+        const int input_depth = toDepth(input_type_);
+        const int output_depth = toDepth(output_type);
+        if (input_depth < 0 || output_depth < 0 || output_depth == CV_8U)
+        {
+            LOG_ERR("Unsupported YOLOv8 model tensor type (input: {}, output: {}).", static_cast<int>(input_type_), static_cast<int>(output_type));
+            session_.reset();
+            return false;
+        }
+        // uint8 입력 모델은 0~255 픽셀값을 그대로 받는다 (정규화는 모델 내부)
+        input_spec_ = {input_depth, input_depth == CV_8U ? 1.0f / 255.0f : 1.0f, 0};
+        output_spec_ = {output_depth, 1.0f, 0};
+    }
+    catch (const Ort::Exception &e)
+    {
+        LOG_ERR("Failed to load YOLOv8 model with ONNX Runtime: {}", e.what());
+        session_.reset();
+        return false;
+    }
+
+    LOG_INF("Using ONNX Runtime CPU backend (input: {}, output: {}, input depth: {}, output depth: {}, threads: {}).",
+            input_name_, output_name_, input_spec_.depth, output_spec_.depth, num_threads_);
+    return true;
+}
+
+bool OnnxRuntimeBackend::empty() const
+{
+    return session_ == nullptr;
+}
+
+bool OnnxRuntimeBackend::infer(const cv::Mat &input, cv::Mat &output)
+{
+    if (session_ == nullptr || input.dims != 4 || input.depth() != input_spec_.depth)
+    {
+        return false;
+    }
+
+    const std::array<int64_t, 4> input_shape = {input.size[0], input.size[1], input.size[2], input.size[3]};
+    const char *input_names[] = {input_name_.c_str()};
+    const char *output_names[] = {output_name_.c_str(), proto_name_.c_str()};
+    const size_t output_count = proto_name_.empty() ? 1 : 2;
+
+    try
+    {
+        // 입력 텐서는 복사 없이 전처리 버퍼를 그대로 사용
+        auto input_tensor = Ort::Value::CreateTensor(memory_info_, const_cast<uchar *>(input.ptr<uchar>()), input.total() * input.elemSize(),
+                                                     input_shape.data(), input_shape.size(), input_type_);
+        auto outputs = session_->Run(Ort::RunOptions{nullptr}, input_names, &input_tensor, 1, output_names, output_count);
+
+        const auto shape = outputs[0].GetTensorTypeAndShapeInfo().GetShape();
+        if (shape.size() != 3)
+        {
+            LOG_ERR("Unexpected ONNX Runtime output rank: {}", shape.size());
+            return false;
+        }
+        const int sizes[] = {static_cast<int>(shape[0]), static_cast<int>(shape[1]), static_cast<int>(shape[2])};
+        output_.create(3, sizes, output_spec_.depth);
+        std::memcpy(output_.ptr<uchar>(), outputs[0].GetTensorData<uchar>(), output_.total() * output_.elemSize());
+
+        proto_ = cv::Mat();
+        if (output_count > 1)
+        {
+            const auto proto_shape = outputs[1].GetTensorTypeAndShapeInfo().GetShape();
+            if (proto_shape.size() == 4)
+            {
+                const int proto_sizes[] = {static_cast<int>(proto_shape[0]), static_cast<int>(proto_shape[1]),
+                                           static_cast<int>(proto_shape[2]), static_cast<int>(proto_shape[3])};
+                proto_.create(4, proto_sizes, output_spec_.depth);
+                std::memcpy(proto_.ptr<uchar>(), outputs[1].GetTensorData<uchar>(), proto_.total() * proto_.elemSize());
+            }
+        }
+    }
+    catch (const Ort::Exception &e)
+    {
+        LOG_ERR("ONNX Runtime inference failed (batch: {}): {}", input.size[0], e.what());
+        return false;
+    }
+
+    output = output_;
+    return true;
+}
+
+} // namespace vp::adapter::out
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "inference_backend.hpp"
+#include <onnxruntime_cxx_api.h>
+#include <vector>
+
+namespace vp::adapter::out
+{
+
+// ONNX Runtime CPU 백엔드. 그래프 최적화(ORT_ENABLE_ALL)와 자체 스레드 풀 사용
+// 입출력 형식은 모델을 따름 (입력: float, float16, uint8 픽셀값 / 출력: float, float16)
+class OnnxRuntimeBackend : public InferenceBackend
+{
+public:
+    explicit OnnxRuntimeBackend(int num_threads);
+
+    bool load(const std::string &model_path) override;
+    bool empty() const override;
+    bool infer(const cv::Mat &input, cv::Mat &output) override;
+    cv::Mat protoOutput() const override { return proto_; }
+    TensorSpec inputSpec() const override { return input_spec_; }
+    TensorSpec outputSpec() const override { return output_spec_; }
+    const char *name() const override { return "onnxruntime"; }
+
+private:
+    int num_threads_;
+    Ort::Env env_;
+    std::unique_ptr<Ort::Session> session_;
+    Ort::MemoryInfo memory_info_;
+    std::string input_name_;
+    std::string output_name_;
+    std::string proto_name_; // 세그멘테이션 모델의 두 번째 출력 (없으면 빈 문자열)
+    TensorSpec input_spec_;
+    TensorSpec output_spec_;
+    ONNXTensorElementDataType input_type_ = ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT;
+    cv::Mat output_; // 출력 버퍼 (크기가 같으면 재사용)
+    cv::Mat proto_;
+};
+
+} // namespace vp::adapter::out
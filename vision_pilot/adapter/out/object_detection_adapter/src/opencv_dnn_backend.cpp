@@ -0,0 +1,117 @@
+#include "opencv_dnn_backend.hpp"
+#include "gaia_log.hpp"
+#include <opencv2/core.hpp>
+
+namespace vp::adapter::out
+{
+
+OpenCvDnnBackend::OpenCvDnnBackend(bool use_cuda, config::ModelPrecision precision)
+    : use_cuda_{use_cuda}, precision_{precision}
+{
+    LOG_TRA("");
+}
+
+bool OpenCvDnnBackend::load(const std::string &model_path)
+{
+    try
+    {
+        net_ = cv::dnn::readNetFromONNX(model_path);
+    }
+    catch (const cv::Exception &e)
+    {
+        LOG_ERR("Failed to load YOLOv8 network: {}", e.what());
+        return false;
+    }
+
+    const bool fp16 = precision_ == config::ModelPrecision::FP16;
+    if (use_cuda_)
+    {
+        LOG_INF("Trying to use CUDA backend{}...", fp16 ? " (FP16)" : "");
+        net_.setPreferableBackend(cv::dnn::DNN_BACKEND_CUDA);
+        net_.setPreferableTarget(fp16 ? cv::dnn::DNN_TARGET_CUDA_FP16 : cv::dnn::DNN_TARGET_CUDA);
+    }
+    else
+    {
+        LOG_INF("Using CPU backend{}...", fp16 ? " (FP16)" : "");
+        net_.setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
+        net_.setPreferableTarget(fp16 ? cv::dnn::DNN_TARGET_CPU_FP16 : cv::dnn::DNN_TARGET_CPU);
+    }
+
+    if (precision_ == config::ModelPrecision::INT8)
+    {
+        this->loadQuantizationDetails();
+    }
+
+    output_names_ = net_.getUnconnectedOutLayersNames();
+    return !net_.empty();
+}
+
+void OpenCvDnnBackend::loadQuantizationDetails()
+{
+    // 양자화된 Net 만 입출력 scale/zero_point 를 제공. QDQ 모델은 내부에서만 INT8 로 연산하고 입출력은 float
+    std::vector<float> input_scales;
+    std::vector<int> input_zero_points;
+    std::vector<float> output_scales;
+    std::vector<int> output_zero_points;
+    try
+    {
+        net_.getInputDetails(input_scales, input_zero_points);
+        net_.getOutputDetails(output_scales, output_zero_points);
+    }
+    catch (const cv::Exception &)
+    {
+        LOG_INF("Model has float input/output. INT8 layers run inside the network.");
+        return;
+    }
+
+    if (input_scales.empty() || output_scales.empty())
+    {
+        return;
+    }
+    input_spec_ = {CV_8S, input_scales[0], input_zero_points[0]};
+    output_spec_ = {CV_8S, output_scales[0], output_zero_points[0]};
+    LOG_INF("INT8 input/output (input scale: {}, zero point: {} / output scale: {}, zero point: {})",
+            input_spec_.scale, input_spec_.zero_point, output_spec_.scale, output_spec_.zero_point);
+}
+
+bool OpenCvDnnBackend::empty() const
+{
+    return net_.empty();
+}
+
+bool OpenCvDnnBackend::infer(const cv::Mat &input, cv::Mat &output)
+{
+    try
+    {
+        net_.setInput(input);
+        net_.forward(outputs_, output_names_);
+    }
+    catch (const cv::Exception &e)
+    {
+        LOG_ERR("YOLOv8 forward failed (batch: {}): {}", input.size[0], e.what());
+        return false;
+    }
+
+    if (outputs_.empty())
+    {
+        return false;
+    }
+
+    // 출력 순서는 모델마다 다를 수 있으므로 차원 수로 구분 (3: 박스 출력, 4: 마스크 프로토타입)
+    output = outputs_[0];
+    proto_ = cv::Mat();
+    for (const auto &out : outputs_)
+    {
+        if (out.dims == 3)
+        {
+            output = out;
+        }
+        else if (out.dims == 4)
+        {
+            proto_ = out;
+        }
+    }
+    return true;
+}
+
+} // namespace vp::adapter::out
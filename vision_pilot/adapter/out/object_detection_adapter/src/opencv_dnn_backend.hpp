@@ -0,0 +1,38 @@
+#pragma once
+
+#include "inference_backend.hpp"
+#include <opencv2/dnn.hpp>
+#include <vector>
+
+namespace vp::adapter::out
+{
+
+class OpenCvDnnBackend : public InferenceBackend
+{
+public:
+    // 스레드 수는 cv::setNumThreads (프로세스 전역) 를 따르며 assembly 가 한 번 설정
+    // precision: FP16 은 FP16 연산 타깃, INT8 은 양자화(QDQ) 모델의 입출력 양자화 정보를 사용
+    OpenCvDnnBackend(bool use_cuda, config::ModelPrecision precision = config::ModelPrecision::FP32);
+
+    bool load(const std::string &model_path) override;
+    bool empty() const override;
+    bool infer(const cv::Mat &input, cv::Mat &output) override;
+    cv::Mat protoOutput() const override { return proto_; }
+    TensorSpec inputSpec() const override { return input_spec_; }
+    TensorSpec outputSpec() const override { return output_spec_; }
+    const char *name() const override { return "opencv_dnn"; }
+
+private:
+    void loadQuantizationDetails();
+
+    bool use_cuda_;
+    config::ModelPrecision precision_;
+    TensorSpec input_spec_;
+    TensorSpec output_spec_;
+    cv::dnn::Net net_;
+    std::vector<cv::String> output_names_;
+    std::vector<cv::Mat> outputs_;
+    cv::Mat proto_; // 세그멘테이션 모델의 4차원 출력
+};
+
+} // namespace vp::adapter::out
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "detection.hpp"
+#include "image.hpp"
+#include "object_detection_port.hpp"
+#include "shared_preprocessor.hpp"
+#include "tensor_spec.hpp"
+#include "yolov8_config.hpp"
+#include <memory>
+#include <opencv2/core/types.hpp>
+#include <string>
+#include <vector>
+
+namespace vp::adapter::out
+{
+
+/**
+ * @brief ModelRegistry 에 등록되는 탐지 모델 하나
+ *
+ * 기본 구현은 YOLOv8AdapterImpl 을 감싸며, 테스트에서는 가짜 탐지기로 바꿔 스케줄/병합을 검증한다.
+ * 서로 다른 모델은 공유 추론 풀의 여러 스레드에서 동시에 호출된다.
+ */
+class RegistryDetector
+{
+public:
+    virtual ~RegistryDetector() = default;
+
+    virtual bool initialize() = 0;
+    // 입력 텐서 크기/형식 (initialize 이후 유효). 같은 모델끼리 전처리를 공유
+    virtual cv::Size inputSize() const = 0;
+    virtual TensorSpec inputSpec() const = 0;
+    virtual void setSharedPreprocessor(SharedPreprocessor *preprocessor) = 0;
+    virtual bool reloadModel(const std::string &model_path) = 0;
+    // ObjectDetectionPort::supportsLevel 과 같음
+    virtual bool supportsLevel(vp::port::out::DetectionLevel level) const
+    {
+        return level == vp::port::out::DetectionLevel::FULL;
+    }
+
+    virtual std::vector<std::vector<vp::domain::model::Detection>> detectObjects(const std::vector<const vp::domain::model::ImagePacket *> &images,
+                                                                                 vp::port::out::DetectionLevel level) = 0;
+    virtual std::vector<vp::domain::model::Detection> detectObjectInRegions(const vp::domain::model::ImagePacket &image,
+                                                                            const std::vector<vp::domain::model::BoundingBox> &regions,
+                                                                            vp::port::out::DetectionLevel level) = 0;
+};
+
+// YOLOv8AdapterImpl 기반 모델. config 는 반환 객체보다 오래 유지되어야 함
+std::unique_ptr<RegistryDetector> createYoloRegistryDetector(const config::YoloConfig &config);
+
+} // namespace vp::adapter::out
@@ -0,0 +1,78 @@
+#include "shared_preprocessor.hpp"
+
+namespace vp::adapter::out
+{
+
+void SharedPreprocessor::setTensorSpec(const TensorSpec &spec)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    spec_ = spec;
+    for (auto &entry : entries_)
+    {
+        entry.preprocessor.setTensorSpec(spec);
+    }
+    used_ = 0;
+}
+
+void SharedPreprocessor::reset()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    used_ = 0;
+}
+
+uint64_t SharedPreprocessor::reuseCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return reuse_count_;
+}
+
+const cv::Mat &SharedPreprocessor::runBatch(const std::vector<LetterboxInput> &inputs, int target_w, int target_h,
+                                            std::vector<LetterboxInfo> &infos)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < used_; ++i)
+    {
+        if (matches(entries_[i], inputs, target_w, target_h))
+        {
+            ++reuse_count_;
+            infos = entries_[i].infos;
+            return *entries_[i].blob;
+        }
+    }
+
+    // 다른 스레드가 읽고 있을 수 있는 결과는 덮어쓰지 않고 다음 칸에 변환
+    if (used_ == entries_.size())
+    {
+        entries_.emplace_back().preprocessor.setTensorSpec(spec_);
+    }
+    auto &entry = entries_[used_++];
+    entry.blob = &entry.preprocessor.runBatch(inputs, target_w, target_h, infos);
+    entry.infos = infos;
+    entry.keys.clear();
+    for (const auto &input : inputs)
+    {
+        entry.keys.push_back({input.image.data, input.image.rows, input.image.cols, input.image.type(), input.image.step, input.swap_rb});
+    }
+    entry.target_w = target_w;
+    entry.target_h = target_h;
+    return *entry.blob;
+}
+
+bool SharedPreprocessor::matches(const Entry &entry, const std::vector<LetterboxInput> &inputs, int target_w, int target_h)
+{
+    if (target_w != entry.target_w || target_h != entry.target_h || inputs.size() != entry.keys.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        const auto &image = inputs[i].image;
+        if (!(entry.keys[i] == InputKey{image.data, image.rows, image.cols, image.type(), image.step, inputs[i].swap_rb}))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace vp::adapter::out
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "letterbox_preprocessor.hpp"
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace vp::adapter::out
+{
+
+/**
+ * @brief 입력 크기/형식이 같은 모델끼리 전처리 결과를 공유하는 LetterboxPreprocessor
+ *
+ * 이번 호출에서 이미 변환한 입력(데이터 주소/크기/색 순서)과 출력 크기가 같으면 변환을 건너뛰고 같은 텐서를 돌려준다.
+ * 프레임 버퍼는 다음 프레임에 재사용될 수 있으므로, 소유자는 새 탐지 호출마다 reset() 으로 결과를 무효화해야 한다.
+ * 변환 결과는 reset() 전까지 덮어쓰지 않으므로 공유하는 모델들이 여러 스레드에서 동시에 추론해도 된다.
+ * (동시에 같은 입력을 요청하면 한 스레드만 변환하고 나머지는 끝날 때까지 기다려 재사용)
+ */
+class SharedPreprocessor
+{
+public:
+    void setTensorSpec(const TensorSpec &spec);
+    const TensorSpec &tensorSpec() const { return spec_; }
+
+    // 보관 중인 변환 결과 무효화. 반환했던 텐서를 쓰는 스레드가 없을 때 호출
+    void reset();
+
+    const cv::Mat &runBatch(const std::vector<LetterboxInput> &inputs, int target_w, int target_h, std::vector<LetterboxInfo> &infos);
+
+    // 변환을 건너뛴 횟수 (통계용)
+    uint64_t reuseCount() const;
+
+private:
+    struct InputKey
+    {
+        const uchar *data = nullptr;
+        int rows = 0;
+        int cols = 0;
+        int type = 0;
+        size_t step = 0;
+        bool swap_rb = false;
+
+        bool operator==(const InputKey &other) const
+        {
+            return data == other.data && rows == other.rows && cols == other.cols && type == other.type && step == other.step &&
+                   swap_rb == other.swap_rb;
+        }
+    };
+
+    // 변환 결과 하나. 버퍼는 reset() 후 다음 호출에서 재사용
+    struct Entry
+    {
+        LetterboxPreprocessor preprocessor;
+        std::vector<InputKey> keys; // 변환한 입력
+        std::vector<LetterboxInfo> infos;
+        int target_w = 0;
+        int target_h = 0;
+        const cv::Mat *blob = nullptr;
+    };
+
+    static bool matches(const Entry &entry, const std::vector<LetterboxInput> &inputs, int target_w, int target_h);
+
+    TensorSpec spec_;
+    mutable std::mutex mutex_;
+    std::deque<Entry> entries_; // 원소 주소가 유지되어야 하므로 deque
+    size_t used_ = 0;           // 이번 호출에서 유효한 entries_ 수
+    uint64_t reuse_count_ = 0;
+};
+
+} // namespace vp::adapter::out
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <opencv2/core/hal/interface.h>
+
+namespace vp::adapter::out
+{
+
+/**
+ * @brief 모델 입출력 텐서 원소 형식과 양자화 파라미터
+ *
+ * 양자화 텐서(CV_8U/CV_8S)는 real = (q - zero_point) * scale 로 해석한다.
+ * CV_32F/CV_16F 는 scale/zero_point 를 사용하지 않는다.
+ */
+struct TensorSpec
+{
+    int depth = CV_32F; // CV_32F, CV_16F, CV_8U, CV_8S
+    float scale = 1.0f;
+    int zero_point = 0;
+
+    bool isQuantized() const { return depth == CV_8U || depth == CV_8S; }
+
+    bool operator==(const TensorSpec &other) const
+    {
+        return depth == other.depth && scale == other.scale && zero_point == other.zero_point;
+    }
+    bool operator!=(const TensorSpec &other) const { return !(*this == other); }
+};
+
+} // namespace vp::adapter::out
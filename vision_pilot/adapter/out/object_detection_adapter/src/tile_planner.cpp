@@ -0,0 +1,98 @@
+#include "tile_planner.hpp"
+#include "gaia_log.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+// 한 축에서 [begin, end) 구간을 덮는 길이 tile 의 시작 위치 목록 (양 끝 타일은 구간 끝에 맞춤)
+void tileStarts(int begin, int end, int tile, int frame_len, float overlap, std::vector<int> &starts)
+{
+    starts.clear();
+    const int span = end - begin;
+    if (span <= tile)
+    {
+        starts.push_back(std::clamp(begin + (span - tile) / 2, 0, frame_len - tile));
+        return;
+    }
+
+    const int stride = std::max(1, static_cast<int>(std::lround(tile * (1.0f - overlap))));
+    const int count = (span - tile + stride - 1) / stride + 1;
+    for (int i = 0; i < count; ++i)
+    {
+        // 같은 간격으로 펼쳐 마지막 타일이 구간 끝에 닿도록 함 (간격은 stride 이하)
+        starts.push_back(begin + static_cast<int>(std::lround(static_cast<double>(i) * (span - tile) / (count - 1))));
+    }
+}
+} // namespace
+
+namespace vp::adapter::out
+{
+
+TilePlanner::TilePlanner(const config::TilingConfig &config)
+    : config_{config}
+{
+}
+
+const std::vector<cv::Rect> &TilePlanner::plan(int frame_w, int frame_h)
+{
+    if (frame_size_ == cv::Size(frame_w, frame_h))
+    {
+        return tiles_;
+    }
+
+    frame_size_ = cv::Size(frame_w, frame_h);
+    tiles_.clear();
+    if (config_.regions.empty())
+    {
+        this->appendRegion(config::TileRegion{}, frame_w, frame_h);
+    }
+    for (const auto &region : config_.regions)
+    {
+        this->appendRegion(region, frame_w, frame_h);
+    }
+
+    LOG_INF("Tiling plan for {}x{}: {} tiles{}", frame_w, frame_h, tiles_.size(), config_.fullFrame ? " + full frame" : "");
+    return tiles_;
+}
+
+void TilePlanner::appendRegion(const config::TileRegion &region, int frame_w, int frame_h)
+{
+    const int x0 = std::clamp(static_cast<int>(std::lround(region.left * frame_w)), 0, frame_w);
+    const int x1 = std::clamp(static_cast<int>(std::lround(region.right * frame_w)), 0, frame_w);
+    const int y0 = std::clamp(static_cast<int>(std::lround(region.top * frame_h)), 0, frame_h);
+    const int y1 = std::clamp(static_cast<int>(std::lround(region.bottom * frame_h)), 0, frame_h);
+    if (x1 <= x0 || y1 <= y0 || region.tileSize <= 0)
+    {
+        LOG_WRN("Ignoring empty tile region ({}, {}, {}, {})", region.left, region.top, region.right, region.bottom);
+        return;
+    }
+
+    const int tile_w = std::min(region.tileSize, frame_w);
+    const int tile_h = std::min(region.tileSize, frame_h);
+    const float overlap = std::clamp(config_.overlap, 0.0f, 0.5f);
+
+    std::vector<int> xs;
+    std::vector<int> ys;
+    tileStarts(x0, x1, tile_w, frame_w, overlap, xs);
+    tileStarts(y0, y1, tile_h, frame_h, overlap, ys);
+
+    const cv::Rect full(0, 0, frame_w, frame_h);
+    for (int y : ys)
+    {
+        for (int x : xs)
+        {
+            const cv::Rect tile(x, y, tile_w, tile_h);
+            if (config_.fullFrame && tile == full)
+            {
+                continue;
+            }
+            if (std::find(tiles_.begin(), tiles_.end(), tile) == tiles_.end())
+            {
+                tiles_.push_back(tile);
+            }
+        }
+    }
+}
+
+} // namespace vp::adapter::out
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "yolov8_config.hpp"
+#include <opencv2/core/types.hpp>
+#include <vector>
+
+namespace vp::adapter::out
+{
+
+/**
+ * @brief 프레임을 겹치는 정사각 타일로 나누는 배치 계획
+ *
+ * 영역(TileRegion)마다 타일 크기를 달리하여 지평선 부근 등 필요한 곳만 촘촘하게 나눈다.
+ * 영역이 타일보다 작은 축은 타일 하나를 영역 중심에 둔다.
+ * 결과는 프레임 크기가 바뀔 때만 다시 계산한다.
+ */
+class TilePlanner
+{
+public:
+    explicit TilePlanner(const config::TilingConfig &config);
+
+    // 프레임 좌표 기준 타일 목록. fullFrame 이 켜져 있으면 프레임 전체와 같은 타일은 제외
+    const std::vector<cv::Rect> &plan(int frame_w, int frame_h);
+
+private:
+    void appendRegion(const config::TileRegion &region, int frame_w, int frame_h);
+
+    const config::TilingConfig config_;
+    cv::Size frame_size_;
+    std::vector<cv::Rect> tiles_;
+};
+
+} // namespace vp::adapter::out
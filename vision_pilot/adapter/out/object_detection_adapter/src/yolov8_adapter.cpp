@@ -21,11 +21,55 @@ bool YOLOv8Adapter::initialize()
 
 std::vector<vp::domain::model::Detection> YOLOv8Adapter::detectObject(const vp::domain::model::ImagePacket &image)
 {
-    return impl_->detectObject(image);
+    return impl_->detectObject(image, vp::port::out::DetectionLevel::FULL);
+}
+
+std::vector<vp::domain::model::Detection> YOLOv8Adapter::detectObject(const vp::domain::model::ImagePacket &image, vp::port::out::DetectionLevel level)
+{
+    return impl_->detectObject(image, level);
+}
+
+bool YOLOv8Adapter::supportsLevel(vp::port::out::DetectionLevel level) const
+{
+    return impl_->supportsLevel(level);
+}
+
+std::vector<vp::domain::model::Detection> YOLOv8Adapter::detectObjectInRegions(const vp::domain::model::ImagePacket &image,
+                                                                               const std::vector<vp::domain::model::BoundingBox> &regions,
+                                                                               vp::port::out::DetectionLevel level)
+{
+    return impl_->detectObjectInRegions(image, regions, level);
+}
+
+std::vector<std::vector<vp::domain::model::Detection>> YOLOv8Adapter::detectObjects(const std::vector<const vp::domain::model::ImagePacket *> &images, vp::port::out::DetectionLevel level)
+{
+    return impl_->detectObjects(images, level);
+}
+
+std::vector<vp::domain::model::Detection> YOLOv8Adapter::detectInstances(const vp::domain::model::ImagePacket &image, vp::port::out::DetectionLevel level,
+                                                                         std::vector<vp::domain::model::InstanceResult> &instances)
+{
+    return impl_->detectInstances(image, level, instances);
+}
+
+void YOLOv8Adapter::submitDetection(const vp::domain::model::ImagePacket &image, vp::port::out::DetectionLevel level,
+                                    vp::port::out::DetectionCallback callback)
+{
+    impl_->submitDetection(image, level, std::move(callback));
 }
 
 bool YOLOv8Adapter::deinitialize()
 {
     return impl_->deinitialize();
 }
+
+bool YOLOv8Adapter::reloadModel(const std::string &model_path)
+{
+    return impl_->reloadModel(model_path);
+}
+
+bool YOLOv8Adapter::isReloading() const
+{
+    return impl_->isReloading();
+}
 } // namespace vp::adapter::out
\ No newline at end of file
@@ -1,53 +1,75 @@
 #include "yolov8_adapter_impl.hpp"
 #include "gaia_log.hpp"
+#include "gaia_trace.hpp"
+#include <chrono>
 #include <fstream>
 #include <opencv2/core/mat.hpp>
-#include <opencv2/dnn.hpp>
 #include <opencv2/opencv.hpp>
 
-namespace
+namespace vp::adapter::out
 {
-cv::Mat addPadding(const cv::Mat &resized_img)
+
+YOLOv8AdapterImpl::YOLOv8AdapterImpl(const config::YoloConfig &config, BackendFactory factory)
+    : backend_factory_(std::move(factory)), tile_planner_(config.tiling), config_(config)
 {
     LOG_TRA("");
 
-    int new_height = resized_img.rows;
-
-    if (new_height < 640)
+    // 클래스 필터/클래스별 기준은 디코딩 단계에서 적용 (제외된 클래스는 점수도 읽지 않음)
+    ClassFilter class_filter;
+    class_filter.class_ids = config_.classes;
+    for (const auto &entry : config_.classThresholds)
     {
-        int padding = (640 - new_height) / 2;
-        cv::Mat padded_img;
-        cv::copyMakeBorder(resized_img, padded_img, padding, 640 - new_height - padding, 0, 0, cv::BORDER_CONSTANT, cv::Scalar(0, 0, 0));
-        return padded_img;
+        if (entry.classId < 0)
+        {
+            LOG_WRN("Invalid class id in classThresholds: {}", entry.classId);
+            continue;
+        }
+        if (static_cast<int>(class_filter.thresholds.size()) <= entry.classId)
+        {
+            class_filter.thresholds.resize(entry.classId + 1, -1.0f);
+        }
+        class_filter.thresholds[entry.classId] = entry.threshold;
+    }
+    decoder_.setClassFilter(class_filter);
+    if (!config_.classes.empty())
+    {
+        LOG_INF("YOLOv8 class filter: {} classes enabled.", config_.classes.size());
     }
 
-    return resized_img;
-}
-
-cv::Mat resizeImage(const cv::Mat &input_img, int target_width)
-{
-    LOG_TRA("");
-
-    int original_width = input_img.cols;
-    int original_height = input_img.rows;
-
-    float scale = static_cast<float>(target_width) / static_cast<float>(original_width);
-    int new_height = static_cast<int>(original_height * scale);
-
-    cv::Mat resized_img;
-    cv::resize(input_img, resized_img, cv::Size(target_width, new_height));
-
-    return resized_img;
-}
-} // namespace
-
-namespace vp::adapter::out
-{
+    // 세그멘테이션/포즈: 클래스 행 뒤의 마스크 계수/키포인트 행은 클래스 점수로 읽지 않음
+    InstanceLayout layout;
+    layout.task = config_.task;
+    layout.num_masks = config_.numMasks;
+    layout.mask_threshold = config_.maskThreshold;
+    layout.num_keypoints = config_.numKeypoints;
+    layout.keypoint_dims = config_.keypointDims;
+    instance_decoder_.setLayout(layout);
+    decoder_.setExtraRows(instance_decoder_.extraRows());
+
+    nms_options_.iou_threshold = config_.nmsThreshold;
+    nms_options_.score_threshold = config_.confThreshold;     // Soft-NMS 감쇠 후 제거 기준
+    nms_options_.class_thresholds = class_filter.thresholds; // 클래스별 기준이 있는 클래스는 그 기준으로 제거
+    nms_options_.per_class = config_.nmsPerClass;
+    nms_options_.method = config_.nmsMethod;
+    nms_options_.sigma = config_.softNmsSigma;
+    nms_options_.top_k = config_.nmsTopK;
+    nms_options_.max_detections = config_.maxDetections;
+    tile_nms_options_ = nms_options_;
+    tile_nms_options_.method = config::NmsMethod::HARD;
+    tile_nms_options_.max_detections = 0;
+
+    if (config_.pipelineOverlap)
+    {
+        // 호출 스레드 + 작업 스레드 2 개가 단계를 하나씩 맡음
+        pipeline_pool_ = std::make_unique<InferencePool>(kPipelineStages, config_.workerAffinity);
+        LOG_INF("YOLOv8 preprocess/inference/postprocess overlap enabled.");
+    }
 
-YOLOv8AdapterImpl::YOLOv8AdapterImpl(const config::YoloConfig &config)
-    : config_(config)
-{
-    LOG_TRA("");
+    const int stride = std::max(1, config_.inputStride);
+    if (config_.inputWidth % stride != 0 || config_.inputHeight % stride != 0)
+    {
+        LOG_WRN("YOLOv8 input size {}x{} is not a multiple of stride {}.", config_.inputWidth, config_.inputHeight, stride);
+    }
     this->initialize();
 }
 
@@ -74,60 +96,625 @@ bool YOLOv8AdapterImpl::initialize()
         return false;
     }
 
-    try
+    backend_ = this->loadBackend(config_.modelPath);
+    if (backend_ == nullptr)
     {
-        net_ = std::make_unique<cv::dnn::Net>(cv::dnn::readNetFromONNX(config_.modelPath));
+        return false;
+    }
+    // 전처리 출력 형식을 모델 입력(FP32/FP16/양자화)에 맞춤
+    preprocessor_.setTensorSpec(backend_->inputSpec());
 
-        if (config_.useCuda)
+    if (!config_.reducedModelPath.empty())
+    {
+        LOG_INF("Loading reduced YOLOv8 model: {}", config_.reducedModelPath);
+        reduced_backend_ = this->loadBackend(config_.reducedModelPath);
+        if (reduced_backend_ != nullptr)
         {
-            LOG_INF("Trying to use CUDA backend...");
-            net_->setPreferableBackend(cv::dnn::DNN_BACKEND_CUDA);
-            net_->setPreferableTarget(cv::dnn::DNN_TARGET_CUDA);
+            reduced_preprocessor_.setTensorSpec(reduced_backend_->inputSpec());
         }
-        else
+    }
+    if (reduced_backend_ == nullptr)
+    {
+        // 동적 입력 모델의 REDUCED 탐지용 (입력 크기가 다르므로 기본 전처리 버퍼와 분리)
+        reduced_preprocessor_.setTensorSpec(backend_->inputSpec());
+    }
+
+    // 워밍업: 첫 추론의 메모리 할당/커널 선택 비용을 초기화 단계에서 치름. 출력 형식이 맞지 않는 모델은 여기서 거름
+    if (!this->warmup(*backend_, config_.inputWidth, config_.inputHeight, config_.warmupRuns))
+    {
+        backend_.reset();
+        reduced_backend_.reset();
+        return false;
+    }
+    if (reduced_backend_ != nullptr && !this->warmup(*reduced_backend_, config_.reducedInputWidth, config_.reducedInputHeight, config_.warmupRuns))
+    {
+        LOG_WRN("Reduced YOLOv8 model is not usable. REDUCED detection uses the main model.");
+        reduced_backend_.reset();
+        reduced_preprocessor_.setTensorSpec(backend_->inputSpec());
+    }
+
+    if (!config_.cachePath.empty() && cache_.open(config_.cachePath))
+    {
+        reduced_model_hash_ = reduced_backend_ != nullptr ? DetectionCache::hashFile(config_.reducedModelPath) : 0;
+        this->updateCacheSeed(DetectionCache::hashFile(config_.modelPath));
+    }
+
+    LOG_INF("YOLOv8 initialized successfully ({} backend).", backend_->name());
+    is_initialized_ = true;
+    return true;
+}
+
+std::unique_ptr<InferenceBackend> YOLOv8AdapterImpl::loadBackend(const std::string &model_path) const
+{
+    auto backend = backend_factory_ ? backend_factory_(config_) : createInferenceBackend(config_);
+    if (backend == nullptr || !backend->load(model_path))
+    {
+        return nullptr;
+    }
+    return backend;
+}
+
+bool YOLOv8AdapterImpl::warmup(InferenceBackend &backend, int input_w, int input_h, int runs) const
+{
+    if (runs <= 0)
+    {
+        return true;
+    }
+
+    const int sizes[] = {1, 3, input_h, input_w};
+    cv::Mat input(4, sizes, backend.inputSpec().depth, cv::Scalar::all(0));
+    cv::Mat output;
+    double first_ms = 0.0;
+    double last_ms = 0.0;
+    for (int i = 0; i < runs; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        if (!backend.infer(input, output))
+        {
+            LOG_ERR("YOLOv8 warm-up inference failed ({}x{}).", input_w, input_h);
+            return false;
+        }
+        if (i == 0 && (output.dims != 3 || output.size[0] != 1 || !decoder_.acceptsOutput(output)))
+        {
+            LOG_ERR("YOLOv8 model output does not match the decoder (dims: {}, rows: {}, extra rows: {}).",
+                    output.dims, output.dims == 3 ? output.size[1] : 0, decoder_.extraRows());
+            return false;
+        }
+        last_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (i == 0)
         {
-            LOG_INF("Using CPU backend...");
-            net_->setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
-            net_->setPreferableTarget(cv::dnn::DNN_TARGET_CPU);
+            first_ms = last_ms;
         }
+    }
+    LOG_INF("YOLOv8 warm-up done ({}x{}, {} runs): first {:.1f} ms, last {:.1f} ms", input_w, input_h, runs, first_ms, last_ms);
+    return true;
+}
 
-        // 워밍업 (선택사항: 첫 추론 속도 향상)
-        // cv::Mat dummy = cv::Mat::zeros(config_.inputHeight, config_.inputWidth, CV_32FC3);
-        // cv::dnn::blobFromImage(dummy); // ...
+bool YOLOv8AdapterImpl::reloadModel(const std::string &model_path)
+{
+    LOG_INF("YOLOv8 model reload requested: {}", model_path);
 
-        LOG_INF("YOLOv8 initialized successfully.");
-        is_initialized_ = true;
-        return true;
+    if (!is_initialized_)
+    {
+        LOG_ERR("YOLOv8 Adapter is not initialized. Model reload is ignored.");
+        return false;
     }
-    catch (const cv::Exception &e)
+    std::ifstream f(model_path.c_str());
+    if (!f.good())
     {
-        LOG_ERR("Failed to load YOLOv8 network: {}", e.what());
+        LOG_ERR("YOLOv8 model file not found: {}", model_path);
         return false;
     }
+    if (reloading_.exchange(true, std::memory_order_acq_rel))
+    {
+        LOG_WRN("YOLOv8 model reload is already in progress.");
+        return false;
+    }
+
+    // 이전 교체 스레드는 이미 끝난 상태 (reloading_ 이 false 였음)
+    if (reload_thread_.joinable())
+    {
+        reload_thread_.join();
+    }
+    reload_thread_ = std::thread(&YOLOv8AdapterImpl::loadReplacement, this, model_path);
+    return true;
+}
+
+void YOLOv8AdapterImpl::loadReplacement(const std::string &model_path)
+{
+    TRACE_THREAD_NAME("yolo_reload");
+    const auto start = std::chrono::steady_clock::now();
+
+    // 탐지는 기존 모델로 계속 진행하고, 새 모델은 로드와 워밍업(출력 형식 확인)까지 마친 뒤에 넘김
+    // 워밍업을 끈 설정이어도 추론 한 번으로 확인. 실패하면 기존 모델 유지
+    const int runs = std::max(1, config_.warmupRuns);
+    auto backend = this->loadBackend(model_path);
+    if (backend == nullptr || !this->warmup(*backend, config_.inputWidth, config_.inputHeight, runs))
+    {
+        LOG_ERR("Failed to load YOLOv8 model for reload. Keeping the current model: {}", model_path);
+        reloading_.store(false, std::memory_order_release);
+        return;
+    }
+
+    // 경량 모델은 기본 모델과 짝이므로 같은 경로에서 다시 읽어 함께 교체
+    std::unique_ptr<InferenceBackend> reduced_backend;
+    if (!config_.reducedModelPath.empty())
+    {
+        reduced_backend = this->loadBackend(config_.reducedModelPath);
+        if (reduced_backend == nullptr || !this->warmup(*reduced_backend, config_.reducedInputWidth, config_.reducedInputHeight, runs))
+        {
+            LOG_ERR("Failed to load reduced YOLOv8 model for reload. Keeping the current models: {}", config_.reducedModelPath);
+            reloading_.store(false, std::memory_order_release);
+            return;
+        }
+    }
+    const uint64_t model_hash = config_.cachePath.empty() ? 0 : DetectionCache::hashFile(model_path);
+    const uint64_t reduced_hash = config_.cachePath.empty() || reduced_backend == nullptr ? 0 : DetectionCache::hashFile(config_.reducedModelPath);
+
+    {
+        std::lock_guard<std::mutex> lock(reload_mutex_);
+        replacement_ = std::move(backend);
+        replacement_reduced_ = std::move(reduced_backend);
+        replacement_hash_ = model_hash;
+        replacement_reduced_hash_ = reduced_hash;
+        replacement_ready_.store(true, std::memory_order_release);
+    }
+    LOG_INF("YOLOv8 model ready for switch-over ({:.1f} ms): {}",
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count(), model_path);
+    reloading_.store(false, std::memory_order_release);
+}
+
+void YOLOv8AdapterImpl::applyReplacement()
+{
+    if (!replacement_ready_.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    std::unique_ptr<InferenceBackend> previous;
+    std::unique_ptr<InferenceBackend> previous_reduced;
+    uint64_t model_hash = 0;
+    bool reduced_switched = false;
+    {
+        std::lock_guard<std::mutex> lock(reload_mutex_);
+        previous = std::move(backend_);
+        backend_ = std::move(replacement_);
+        reduced_switched = replacement_reduced_ != nullptr;
+        if (reduced_switched)
+        {
+            previous_reduced = std::move(reduced_backend_);
+            reduced_backend_ = std::move(replacement_reduced_);
+            reduced_model_hash_ = replacement_reduced_hash_;
+        }
+        model_hash = replacement_hash_;
+        replacement_ready_.store(false, std::memory_order_release);
+    }
+
+    // 새 모델 입력 형식에 맞춰 전처리 재설정, 배치 지원 여부는 다시 확인
+    preprocessor_.setTensorSpec(backend_->inputSpec());
+    reduced_preprocessor_.setTensorSpec(reduced_backend_ != nullptr ? reduced_backend_->inputSpec() : backend_->inputSpec());
+    if (shared_preprocessor_ != nullptr && shared_preprocessor_->tensorSpec() != backend_->inputSpec())
+    {
+        LOG_WRN("Reloaded YOLOv8 model input format differs from shared input group. Using its own preprocessing.");
+        shared_preprocessor_ = nullptr;
+    }
+    batch_supported_ = true;
+    dynamic_supported_ = true;
+    if (cache_.isOpen())
+    {
+        this->updateCacheSeed(model_hash);
+    }
+    LOG_INF("YOLOv8 model switched ({} backend{}).", backend_->name(), reduced_switched ? ", with reduced model" : "");
+
+    // 탐지 호출 사이에서 전환하므로 이전 모델로 진행 중인 추론은 없음
+    previous.reset();
+    previous_reduced.reset();
+}
+
+void YOLOv8AdapterImpl::updateCacheSeed(uint64_t model_hash)
+{
+    nlohmann::json settings = config_;
+    settings.erase("cachePath");
+    settings.erase("asyncQueueSize");
+    settings.erase("pipelineOverlap");
+    const std::string dump = settings.dump();
+    cache_seed_ = DetectionCache::hashBytes(dump.data(), dump.size());
+    cache_seed_ = DetectionCache::hashBytes(&model_hash, sizeof(model_hash), cache_seed_);
+    cache_seed_ = DetectionCache::hashBytes(&reduced_model_hash_, sizeof(reduced_model_hash_), cache_seed_);
+}
+
+uint64_t YOLOv8AdapterImpl::frameKey(const cv::Mat &image, vp::domain::model::ImageEncoding encoding, vp::port::out::DetectionLevel level) const
+{
+    TRACE_SCOPE("yolo.cache_key");
+    const int header[] = {static_cast<int>(level), static_cast<int>(encoding), image.cols, image.rows, image.type()};
+    uint64_t key = DetectionCache::hashBytes(header, sizeof(header), cache_seed_);
+    const size_t row_bytes = static_cast<size_t>(image.cols) * image.elemSize();
+    for (int r = 0; r < image.rows; ++r)
+    {
+        key = DetectionCache::hashBytes(image.ptr<uchar>(r), row_bytes, key);
+    }
+    return DetectionCache::finishHash(key);
 }
 
 bool YOLOv8AdapterImpl::deinitialize()
 {
     LOG_TRA("");
+    {
+        // 대기 중인 비동기 요청은 모델을 해제하기 전에 모두 처리
+        std::lock_guard<std::mutex> lock(async_mutex_);
+        async_queue_.reset();
+    }
+    if (reload_thread_.joinable())
+    {
+        reload_thread_.join();
+    }
+    {
+        std::lock_guard<std::mutex> lock(reload_mutex_);
+        replacement_.reset();
+        replacement_reduced_.reset();
+        replacement_ready_.store(false, std::memory_order_release);
+    }
     if (!is_initialized_)
     {
         LOG_DBG("YOLOv8 Adapter is not initialized.");
         return true;
     }
-    net_.reset();
+    backend_.reset();
+    reduced_backend_.reset();
+    cache_.close();
     is_initialized_ = false;
     return true;
 }
 
-std::vector<vp::domain::model::Detection> YOLOv8AdapterImpl::detectObject(const vp::domain::model::ImagePacket &packet)
+std::vector<vp::domain::model::Detection> YOLOv8AdapterImpl::detectObject(const vp::domain::model::ImagePacket &packet, vp::port::out::DetectionLevel level)
 {
-    if (!is_initialized_ || net_ == nullptr || net_->empty())
+    auto results = this->detectObjects({&packet}, level);
+    return std::move(results.front());
+}
+
+void YOLOv8AdapterImpl::submitDetection(const vp::domain::model::ImagePacket &packet, vp::port::out::DetectionLevel level, vp::port::out::DetectionCallback callback)
+{
+    AsyncDetectionQueue *queue = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(async_mutex_);
+        if (async_queue_ == nullptr)
+        {
+            LOG_INF("Starting asynchronous YOLOv8 detection (queue size: {}, batch: {}).", config_.asyncQueueSize, config_.maxBatchSize);
+            // 단계 겹침 사용 시 단계 수만큼의 배치를 한 번에 넘겨 요청 사이에서도 전처리/추론/후처리가 겹치도록 함
+            const int max_batch = std::max(1, config_.maxBatchSize) * (pipeline_pool_ != nullptr ? kPipelineStages : 1);
+            async_queue_ = std::make_unique<AsyncDetectionQueue>(std::max(1, config_.asyncQueueSize), max_batch,
+                                                                 [this](const std::vector<const vp::domain::model::ImagePacket *> &packets, vp::port::out::DetectionLevel batch_level)
+                                                                 { return this->detectObjects(packets, batch_level); },
+                                                                 config_.workerAffinity);
+        }
+        queue = async_queue_.get();
+    }
+    // 대기열이 가득 차면 여기서 대기 (deinitialize 와 동시에 호출하지 않는 한 queue 는 유효)
+    queue->submit(packet, level, std::move(callback));
+}
+
+std::vector<std::vector<vp::domain::model::Detection>> YOLOv8AdapterImpl::detectObjects(const std::vector<const vp::domain::model::ImagePacket *> &packets, vp::port::out::DetectionLevel level)
+{
+    std::lock_guard<std::mutex> detect_lock(detect_mutex_);
+    std::vector<std::vector<vp::domain::model::Detection>> results(packets.size());
+    this->applyReplacement();
+    if (!is_initialized_ || backend_ == nullptr || backend_->empty())
     {
         LOG_ERR("Network not initialized.");
+        return results;
+    }
+    if (!this->supportsLevel(level))
+    {
+        // FULL 과 같은 탐지이므로 같은 프레임이 단계별로 따로 캐시되지 않도록 FULL 로 처리
+        level = vp::port::out::DetectionLevel::FULL;
+    }
+
+    // 1. ImagePacket에서 cv::Mat 추출 (이미지가 없는 패킷은 빈 결과)
+    const bool tiling = config_.tiling.enable && level == vp::port::out::DetectionLevel::FULL;
+    inputs_.clear();
+    views_.clear();
+    tiled_images_.clear();
+    cache_misses_.clear();
+    for (size_t i = 0; i < packets.size(); ++i)
+    {
+        LetterboxInput input;
+        if (!toMat(*packets[i], input.image))
+        {
+            continue;
+        }
+        input.swap_rb = packets[i]->encoding == vp::domain::model::ImageEncoding::BGR8;
+
+        // 캐시에 같은 프레임 결과가 있으면 추론하지 않음
+        if (cache_.isOpen())
+        {
+            const uint64_t key = this->frameKey(input.image, packets[i]->encoding, level);
+            if (cache_.find(key, results[i]))
+            {
+                continue;
+            }
+            cache_misses_.emplace_back(i, key);
+        }
+        const cv::Rect full(0, 0, input.image.cols, input.image.rows);
+        if (!tiling)
+        {
+            inputs_.push_back(input);
+            views_.push_back({i, full, full.size(), false, -1});
+            continue;
+        }
+
+        // 타일 모드: (전체 프레임 +) 타일 ROI 를 배치 입력으로 추가 (복사 없음), 결과는 이미지별로 모아 병합
+        tiled_images_.push_back({i, full.size()});
+        tile_candidates_.resize(std::max(tile_candidates_.size(), i + 1));
+        tile_candidates_[i].clear();
+        if (config_.tiling.fullFrame)
+        {
+            inputs_.push_back(input);
+            views_.push_back({i, full, full.size(), true, -1});
+        }
+        for (const auto &tile : tile_planner_.plan(full.width, full.height))
+        {
+            inputs_.push_back({input.image(tile), input.swap_rb});
+            views_.push_back({i, tile, full.size(), true, -1});
+        }
+    }
+
+    if (this->inferViews(this->selectBackend(level), results))
+    {
+        for (const auto &miss : cache_misses_)
+        {
+            cache_.store(miss.second, results[miss.first]);
+        }
+    }
+    return results;
+}
+
+std::vector<vp::domain::model::Detection> YOLOv8AdapterImpl::detectObjectInRegions(const vp::domain::model::ImagePacket &packet,
+                                                                                   const std::vector<vp::domain::model::BoundingBox> &regions,
+                                                                                   vp::port::out::DetectionLevel level)
+{
+    std::lock_guard<std::mutex> detect_lock(detect_mutex_);
+    std::vector<std::vector<vp::domain::model::Detection>> results(1);
+    this->applyReplacement();
+    if (!is_initialized_ || backend_ == nullptr || backend_->empty())
+    {
+        LOG_ERR("Network not initialized.");
+        return {};
+    }
+
+    LetterboxInput input;
+    if (!toMat(packet, input.image))
+    {
         return {};
     }
+    input.swap_rb = packet.encoding == vp::domain::model::ImageEncoding::BGR8;
+    const cv::Size frame_size(input.image.cols, input.image.rows);
+
+    // 영역들을 원본 해상도로 모델 입력 크기의 캔버스에 모음 -> 캔버스 수만큼만 추론
+    const auto selection = this->selectBackend(level);
+    region_rects_.clear();
+    for (const auto &region : regions)
+    {
+        region_rects_.emplace_back(cvFloor(region.x), cvFloor(region.y), cvCeil(region.width), cvCeil(region.height));
+    }
+    const int canvas_count = mosaic_packer_.pack(region_rects_, frame_size, selection.input_size, mosaic_cells_);
+
+    inputs_.clear();
+    views_.clear();
+    tiled_images_.clear();
+    tiled_images_.push_back({0, frame_size});
+    tile_candidates_.resize(std::max<size_t>(tile_candidates_.size(), 1));
+    tile_candidates_[0].clear();
+    canvases_.resize(std::max<size_t>(canvases_.size(), canvas_count));
+    {
+        TRACE_SCOPE("yolo.compose_regions");
+        for (int c = 0; c < canvas_count; ++c)
+        {
+            MosaicPacker::compose(input.image, mosaic_cells_, c, selection.input_size, LetterboxPreprocessor::kPadValue, canvases_[c]);
+            inputs_.push_back({canvases_[c], input.swap_rb});
+            views_.push_back({0, cv::Rect(cv::Point(), selection.input_size), frame_size, true, c});
+        }
+    }
+
+    this->inferViews(selection, results);
+    return std::move(results.front());
+}
+
+std::vector<vp::domain::model::Detection> YOLOv8AdapterImpl::detectInstances(const vp::domain::model::ImagePacket &packet, vp::port::out::DetectionLevel level,
+                                                                             std::vector<vp::domain::model::InstanceResult> &instances)
+{
+    std::lock_guard<std::mutex> detect_lock(detect_mutex_);
+    std::vector<std::vector<vp::domain::model::Detection>> results(1);
+    instances.clear();
+    this->applyReplacement();
+    if (!is_initialized_ || backend_ == nullptr || backend_->empty())
+    {
+        LOG_ERR("Network not initialized.");
+        return {};
+    }
+
+    LetterboxInput input;
+    if (!toMat(packet, input.image))
+    {
+        return {};
+    }
+    input.swap_rb = packet.encoding == vp::domain::model::ImageEncoding::BGR8;
+
+    // 마스크/키포인트는 앵커 단위 출력이라 타일/영역 병합 없이 전체 프레임 한 장으로 추론
+    const cv::Rect full(0, 0, input.image.cols, input.image.rows);
+    inputs_.assign(1, input);
+    views_.assign(1, {0, full, full.size(), false, -1});
+    tiled_images_.clear();
+    instances_ = &instances;
+    try
+    {
+        this->inferViews(this->selectBackend(level), results);
+    }
+    catch (...)
+    {
+        // 추론 예외는 호출 측으로 넘기되 다음 탐지가 해제된 결과 벡터에 쓰지 않도록 해제
+        instances_ = nullptr;
+        throw;
+    }
+    instances_ = nullptr;
+    return std::move(results.front());
+}
+
+bool YOLOv8AdapterImpl::supportsLevel(vp::port::out::DetectionLevel level) const
+{
+    if (level == vp::port::out::DetectionLevel::FULL)
+    {
+        return true;
+    }
+    return reduced_backend_ != nullptr || config_.dynamicInput || config_.tiling.enable;
+}
+
+YOLOv8AdapterImpl::BackendSelection YOLOv8AdapterImpl::selectBackend(vp::port::out::DetectionLevel level)
+{
+    if (level == vp::port::out::DetectionLevel::REDUCED && reduced_backend_ != nullptr && !reduced_backend_->empty())
+    {
+        return {reduced_backend_.get(), &reduced_preprocessor_, nullptr, cv::Size(config_.reducedInputWidth, config_.reducedInputHeight), false};
+    }
+
+    // 동적 입력 모델은 경량 모델 없이 입력 크기만 줄여 부하를 낮춤
+    const bool dynamic = config_.dynamicInput && dynamic_supported_;
+    if (level == vp::port::out::DetectionLevel::REDUCED && dynamic)
+    {
+        return {backend_.get(), &reduced_preprocessor_, nullptr, cv::Size(config_.reducedInputWidth, config_.reducedInputHeight), true};
+    }
+    return {backend_.get(), &preprocessor_, shared_preprocessor_, cv::Size(config_.inputWidth, config_.inputHeight), dynamic};
+}
+
+cv::Size YOLOv8AdapterImpl::batchInputSize(const BackendSelection &selection, size_t begin, size_t end) const
+{
+    // 영역 모음 캔버스는 이미 입력 크기로 구성됨
+    if (!selection.dynamic || views_[begin].mosaic >= 0)
+    {
+        return selection.input_size;
+    }
+
+    // 배치 안의 이미지는 같은 텐서 크기를 써야 하므로 가장 큰 크기로 맞춤 (같은 카메라면 모두 같음)
+    cv::Size size;
+    for (size_t i = begin; i < end; ++i)
+    {
+        const auto fit = LetterboxPreprocessor::fitInputSize(inputs_[i].image.size(), selection.input_size, config_.inputStride);
+        size.width = std::max(size.width, fit.width);
+        size.height = std::max(size.height, fit.height);
+    }
+    return size;
+}
+
+bool YOLOv8AdapterImpl::inferViews(BackendSelection selection, std::vector<std::vector<vp::domain::model::Detection>> &results)
+{
+    // 마스크/키포인트는 마지막 추론의 프로토타입 출력을 쓰고, 공유 전처리는 다른 모델과 버퍼를 함께 쓰므로 겹쳐 실행하지 않음
+    size_t begin = 0;
+    if (pipeline_pool_ != nullptr && instances_ == nullptr && selection.shared_preprocessor == nullptr)
+    {
+        begin = this->inferPipelined(selection, results);
+    }
+
+    // maxBatchSize 단위로 나누어 추론. 모델이 배치 입력을 받지 못하면 이후로는 한 장씩 처리
+    while (begin < inputs_.size())
+    {
+        const size_t chunk = batch_supported_ ? static_cast<size_t>(std::max(1, config_.maxBatchSize)) : 1;
+        const size_t end = std::min(begin + chunk, inputs_.size());
+        if (!this->runInference(selection, begin, end, results))
+        {
+            if (selection.dynamic && !dynamic_supported_)
+            {
+                // 고정 입력 모델: 설정된 입력 크기로 다시 시도
+                selection = this->selectBackend(vp::port::out::DetectionLevel::FULL);
+                continue;
+            }
+            if (end - begin == 1)
+            {
+                return false;
+            }
+            LOG_WRN("Batched inference is not supported by the model. Falling back to single image inference.");
+            batch_supported_ = false;
+            continue;
+        }
+        begin = end;
+    }
+
+    // 타일/영역별 후보를 프레임 좌표에서 한 번 더 NMS 하여 병합
+    for (const auto &tiled : tiled_images_)
+    {
+        TRACE_SCOPE("yolo.merge_tiles");
+        this->mergeTiles(tile_candidates_[tiled.image], tiled.frame_size, results[tiled.image]);
+    }
+    return true;
+}
 
-    // 1. ImagePacket에서 cv::Mat 추출
+size_t YOLOv8AdapterImpl::inferPipelined(const BackendSelection &selection, std::vector<std::vector<vp::domain::model::Detection>> &results)
+{
+    const size_t chunk = batch_supported_ ? static_cast<size_t>(std::max(1, config_.maxBatchSize)) : 1;
+    pipeline_batches_.clear();
+    for (size_t begin = 0; begin < inputs_.size(); begin += chunk)
+    {
+        pipeline_batches_.emplace_back(begin, std::min(begin + chunk, inputs_.size()));
+    }
+    const size_t count = pipeline_batches_.size();
+    if (count < 2)
+    {
+        return 0; // 겹칠 배치가 없으면 순차 처리
+    }
+
+    TRACE_SCOPE("yolo.pipeline");
+    auto &backend = *selection.backend;
+    const TensorSpec output_spec = backend.outputSpec();
+    for (auto &input : pipeline_inputs_)
+    {
+        input.preprocessor.setTensorSpec(selection.preprocessor->tensorSpec());
+    }
+
+    // 단계 t: 배치 t 전처리 | 배치 t-1 추론 | 배치 t-2 후처리 (단계마다 모두 끝난 뒤 다음 단계로)
+    // 배치 k 의 입력/출력 버퍼는 k % 2 이므로 같은 단계 안에서 읽고 쓰는 버퍼가 겹치지 않음
+    size_t failed = count; // 추론에 실패한 첫 배치
+    for (size_t tick = 0; tick < count + 2 && failed == count; ++tick)
+    {
+        pipeline_pool_->run(kPipelineStages, [&](size_t stage)
+                            {
+            if (stage == 0 && tick < count)
+            {
+                TRACE_SCOPE("yolo.preprocess");
+                const auto [begin, end] = pipeline_batches_[tick];
+                auto &input = pipeline_inputs_[tick % 2];
+                input.input_size = this->batchInputSize(selection, begin, end);
+                input.inputs.assign(inputs_.begin() + begin, inputs_.begin() + end);
+                input.blob = &input.preprocessor.runBatch(input.inputs, input.input_size.width, input.input_size.height, input.letterboxes);
+            }
+            else if (stage == 1 && tick >= 1 && tick - 1 < count)
+            {
+                TRACE_SCOPE("yolo.forward");
+                const size_t batch = tick - 1;
+                const auto &input = pipeline_inputs_[batch % 2];
+                auto &output = pipeline_outputs_[batch % 2];
+                cv::Mat result;
+                const int expected = static_cast<int>(pipeline_batches_[batch].second - pipeline_batches_[batch].first);
+                if (!backend.infer(*input.blob, result) || result.dims != 3 || result.size[0] != expected)
+                {
+                    failed = batch;
+                    return;
+                }
+                result.copyTo(output.output);
+                output.letterboxes = input.letterboxes;
+                output.input_size = input.input_size;
+            }
+            else if (stage == 2 && tick >= 2)
+            {
+                TRACE_SCOPE("yolo.postprocess");
+                const size_t batch = tick - 2;
+                const auto &output = pipeline_outputs_[batch % 2];
+                this->postprocessBatch(output.output, output_spec, pipeline_batches_[batch].first, pipeline_batches_[batch].second,
+                                       output.letterboxes, cv::Mat(), output.input_size, results);
+            } });
+    }
+    // 실패한 배치 이전까지는 후처리까지 끝남 (실패한 단계에서 배치 failed - 1 후처리 완료)
+    return failed < count ? pipeline_batches_[failed].first : inputs_.size();
+}
+
+bool YOLOv8AdapterImpl::toMat(const vp::domain::model::ImagePacket &packet, cv::Mat &frame)
+{
     const vp::domain::model::RawImage *raw_ptr = nullptr;
     std::visit([&](auto &&arg)
                {
@@ -143,150 +730,238 @@ std::vector<vp::domain::model::Detection> YOLOv8AdapterImpl::detectObject(const
 
     if (!raw_ptr || raw_ptr->data.empty())
     {
-        return {};
+        return false;
     }
 
-    // Raw -> Mat 변환
+    // Raw -> Mat 변환 (복사 없음)
     int type = (raw_ptr->channels == 3) ? CV_8UC3 : CV_8UC1;
-    cv::Mat frame(raw_ptr->height, raw_ptr->width, type, const_cast<uint8_t *>(raw_ptr->data.data()), raw_ptr->step);
+    frame = cv::Mat(raw_ptr->height, raw_ptr->width, type, const_cast<uint8_t *>(raw_ptr->data.data()), raw_ptr->step);
+    return true;
+}
 
-    // RGB 변환
-    cv::Mat rgb_frame;
-    if (packet.encoding == vp::domain::model::ImageEncoding::BGR8)
+bool YOLOv8AdapterImpl::runInference(const BackendSelection &selection, size_t begin, size_t end,
+                                     std::vector<std::vector<vp::domain::model::Detection>> &results)
+{
+    TRACE_SCOPE("yolo.infer");
+    auto &backend = *selection.backend;
+    const auto batch = static_cast<int>(end - begin);
+    const cv::Size input_size = this->batchInputSize(selection, begin, end);
+    const int target_w = input_size.width;
+    const int target_h = input_size.height;
+
+    // 2. Pre-processing: 색 변환 + Letterbox + 정규화 + CHW 변환을 한 번에 수행 (N 장을 하나의 텐서로)
+    const cv::Mat *blob = nullptr;
     {
-        cv::cvtColor(frame, rgb_frame, cv::COLOR_BGR2RGB);
+        TRACE_SCOPE("yolo.preprocess");
+        batch_inputs_.assign(inputs_.begin() + begin, inputs_.begin() + end);
+        // 공유 전처리: 같은 입력을 이미 변환한 모델이 있으면 그 텐서를 재사용
+        blob = selection.shared_preprocessor != nullptr ? &selection.shared_preprocessor->runBatch(batch_inputs_, target_w, target_h, letterboxes_)
+                                                        : &selection.preprocessor->runBatch(batch_inputs_, target_w, target_h, letterboxes_);
     }
-    else if (packet.encoding == vp::domain::model::ImageEncoding::MONO8)
+
+    // 3. Inference
+    cv::Mat output;
+    bool ok = false;
     {
-        cv::cvtColor(frame, rgb_frame, cv::COLOR_GRAY2RGB);
+        TRACE_SCOPE("yolo.forward");
+        ok = backend.infer(*blob, output);
     }
-    else
+    if (!ok || output.dims != 3 || output.size[0] != batch)
     {
-        rgb_frame = frame;
+        if (selection.dynamic && input_size != this->inputSize())
+        {
+            // 배치 크기보다 먼저 의심: 고정 크기로 내보낸 모델이 흔함 (배치 문제면 다음 시도에서 배치 폴백)
+            LOG_WRN("YOLOv8 model rejected {}x{} input. Dynamic input size disabled.", target_w, target_h);
+            dynamic_supported_ = false;
+            return false;
+        }
+        LOG_ERR("YOLOv8 inference failed or returned unexpected output shape (batch: {}).", batch);
+        return false;
     }
 
-    // 2. Pre-processing: Letterbox
-    int img_w = rgb_frame.cols;
-    int img_h = rgb_frame.rows;
-    int target_w = config_.inputWidth;
-    int target_h = config_.inputHeight;
-
-    // 스케일 계산
-    float scale = std::min((float)target_w / img_w, (float)target_h / img_h);
-
-    int new_w = std::round(img_w * scale);
-    int new_h = std::round(img_h * scale);
-
-    // 리사이즈 수행
-    cv::Mat resized_img;
-    cv::resize(rgb_frame, resized_img, cv::Size(new_w, new_h));
+    // 4. Post-processing (이미지별)
+    TRACE_SCOPE("yolo.postprocess");
+    this->postprocessBatch(output, backend.outputSpec(), begin, end, letterboxes_, backend.protoOutput(), input_size, results);
+    return true;
+}
 
-    // 패딩 계산 (중앙 정렬)
-    int dw = (target_w - new_w) / 2;
-    int dh = (target_h - new_h) / 2;
+void YOLOv8AdapterImpl::postprocessBatch(const cv::Mat &output, const TensorSpec &output_spec, size_t begin, size_t end, const std::vector<LetterboxInfo> &letterboxes,
+                                         const cv::Mat &protos, const cv::Size &input_size, std::vector<std::vector<vp::domain::model::Detection>> &results)
+{
+    for (size_t i = begin; i < end; ++i)
+    {
+        const auto &view = views_[i];
+        const int b = static_cast<int>(i - begin);
+        if (view.mosaic >= 0)
+        {
+            this->collectMosaic(output, output_spec, b, letterboxes[b], view, tile_candidates_[view.image]);
+        }
+        else if (view.tiled)
+        {
+            this->collectTile(output, output_spec, b, letterboxes[b], view, tile_candidates_[view.image]);
+        }
+        else
+        {
+            this->postprocess(output, output_spec, b, letterboxes[b], view.roi.width, view.roi.height, protos, input_size, results[view.image]);
+        }
+    }
+}
 
-    // 캔버스 생성
-    cv::Mat input_blob_img(target_h, target_w, CV_8UC3, cv::Scalar(114, 114, 114));
+void YOLOv8AdapterImpl::postprocess(const cv::Mat &output, const TensorSpec &output_spec, int batch_index, const LetterboxInfo &letterbox,
+                                    int img_w, int img_h, const cv::Mat &protos, const cv::Size &input_size,
+                                    std::vector<vp::domain::model::Detection> &detections)
+{
+    decoder_.decode(output, config_.confThreshold, candidates_, batch_index, output_spec);
 
-    // 리사이즈된 이미지를 캔버스 중앙에 복사
-    resized_img.copyTo(input_blob_img(cv::Rect(dw, dh, new_w, new_h)));
+    // 5. NMS (입력 텐서 좌표 기준, 남은 후보만 원본 좌표로 복원)
+    nms_.run(candidates_, nms_options_, keep_);
 
-    // 640x640 이미지 생성 완료. 이제 blobFromImage는 리사이즈 없이 값 정규화만 수행
-    cv::Mat blob;
-    cv::dnn::blobFromImage(input_blob_img, blob, 1.0 / 255.0, cv::Size(), cv::Scalar(), false, false);
+    // 6. 결과 변환
+    detections.clear();
+    detections.reserve(keep_.size());
+    for (int idx : keep_)
+    {
+        appendDetection(restoreCandidate(candidates_[idx], letterbox, {0, 0}), img_w, img_h, detections);
+    }
 
-    net_->setInput(blob);
+    // 7. 마스크/키포인트 (NMS 후 남은 후보만)
+    if (instances_ == nullptr)
+    {
+        return;
+    }
+    TRACE_SCOPE("yolo.instances");
+    if (config_.task == config::YoloTask::SEGMENT && !instance_decoder_.setPrototypes(protos, batch_index) && !proto_warned_)
+    {
+        LOG_WRN("YOLOv8 segmentation model has no usable prototype output (FP32/FP16 [N, {}, H, W]). Masks are disabled.", config_.numMasks);
+        proto_warned_ = true;
+    }
+    instances_->resize(keep_.size());
+    for (size_t i = 0; i < keep_.size(); ++i)
+    {
+        instance_decoder_.decode(output, output_spec, batch_index, candidates_[keep_[i]], letterbox, input_size, (*instances_)[i]);
+    }
+}
 
-    // 3. Inference
-    std::vector<cv::Mat> outputs;
-    net_->forward(outputs, net_->getUnconnectedOutLayersNames());
+void YOLOv8AdapterImpl::collectTile(const cv::Mat &output, const TensorSpec &output_spec, int batch_index, const LetterboxInfo &letterbox,
+                                    const InputView &view, std::vector<DetectionCandidate> &merged)
+{
+    decoder_.decode(output, config_.confThreshold, candidates_, batch_index, output_spec);
 
-    // 4. Post-processing
-    cv::Mat &output = outputs[0];
+    // 타일 안에서 먼저 hard NMS 로 후보를 줄임 (설정된 NMS 방식은 병합 단계에서 적용)
+    nms_.run(candidates_, tile_nms_options_, keep_);
 
-    // YOLOv8 Output: [Batch, 4+Classes, Anchors] -> [1, 84, 8400]
-    int dimensions = output.size[1];
-    int rows = output.size[2];
-    float *pdata = (float *)output.data;
+    const float margin = kTileEdgeMargin / letterbox.scale;
+    for (int idx : keep_)
+    {
+        const auto candidate = restoreCandidate(candidates_[idx], letterbox, view.roi.tl());
+
+        // 프레임 안쪽 타일 경계에 닿은 박스는 잘린 박스이므로 버림 (겹친 이웃 타일이나 전체 프레임에서 검출됨)
+        const float x1 = candidate.cx - 0.5f * candidate.w;
+        const float y1 = candidate.cy - 0.5f * candidate.h;
+        const float x2 = candidate.cx + 0.5f * candidate.w;
+        const float y2 = candidate.cy + 0.5f * candidate.h;
+        const bool cut_left = view.roi.x > 0 && x1 < view.roi.x + margin;
+        const bool cut_top = view.roi.y > 0 && y1 < view.roi.y + margin;
+        const bool cut_right = view.roi.x + view.roi.width < view.frame.width && x2 > view.roi.x + view.roi.width - margin;
+        const bool cut_bottom = view.roi.y + view.roi.height < view.frame.height && y2 > view.roi.y + view.roi.height - margin;
+        if (cut_left || cut_top || cut_right || cut_bottom)
+        {
+            continue;
+        }
+        merged.push_back(candidate);
+    }
+}
 
-    std::vector<int> class_ids;
-    std::vector<float> confidences;
-    std::vector<cv::Rect> boxes;
+void YOLOv8AdapterImpl::collectMosaic(const cv::Mat &output, const TensorSpec &output_spec, int batch_index, const LetterboxInfo &letterbox,
+                                      const InputView &view, std::vector<DetectionCandidate> &merged)
+{
+    decoder_.decode(output, config_.confThreshold, candidates_, batch_index, output_spec);
+    nms_.run(candidates_, tile_nms_options_, keep_);
 
-    for (int r = 0; r < rows; ++r)
+    const float margin = kTileEdgeMargin / letterbox.scale;
+    for (int idx : keep_)
     {
-        float max_conf = 0.f;
-        int max_class_id = -1;
-
-        // Class Score 파싱
-        for (int c = 4; c < dimensions; ++c)
+        // 캔버스 좌표 -> 중심이 속한 셀 -> 프레임 좌표 (셀 사이 간격에 걸친 후보는 버림)
+        const auto candidate = restoreCandidate(candidates_[idx], letterbox, {0, 0});
+        const auto cell = std::find_if(mosaic_cells_.begin(), mosaic_cells_.end(), [&](const MosaicCell &c)
+                                       { return c.canvas == view.mosaic && c.dst.contains(cv::Point(cvFloor(candidate.cx), cvFloor(candidate.cy))); });
+        if (cell == mosaic_cells_.end())
         {
-            float score = pdata[c * rows + r];
-            if (score > max_conf)
-            {
-                max_conf = score;
-                max_class_id = c - 4;
-            }
+            continue;
         }
 
-        if (max_conf >= config_.confThreshold)
+        const auto &dst = cell->dst;
+        const bool cut = (cell->cut_left && candidate.cx - 0.5f * candidate.w < dst.x + margin) ||
+                         (cell->cut_top && candidate.cy - 0.5f * candidate.h < dst.y + margin) ||
+                         (cell->cut_right && candidate.cx + 0.5f * candidate.w > dst.x + dst.width - margin) ||
+                         (cell->cut_bottom && candidate.cy + 0.5f * candidate.h > dst.y + dst.height - margin);
+        if (cut)
         {
-            // 예측 좌표 (640x640 Letterbox 기준)
-            float cx = pdata[0 * rows + r];
-            float cy = pdata[1 * rows + r];
-            float w = pdata[2 * rows + r];
-            float h = pdata[3 * rows + r];
-
-            // =========================================================
-            // 좌표 복원 (Coordinate Restoration)
-            // =========================================================
-            // 1. 패딩 제거 (Letterbox 좌표 -> 리사이즈 이미지 좌표)
-            float original_cx = (cx - dw);
-            float original_cy = (cy - dh);
-
-            // 2. 스케일 역변환 (리사이즈 이미지 좌표 -> 원본 이미지 좌표)
-            original_cx /= scale;
-            original_cy /= scale;
-            float original_w = w / scale;
-            float original_h = h / scale;
-
-            // 3. Top-Left 변환
-            int left = static_cast<int>(original_cx - 0.5f * original_w);
-            int top = static_cast<int>(original_cy - 0.5f * original_h);
-            int width = static_cast<int>(original_w);
-            int height = static_cast<int>(original_h);
-
-            // 경계값 처리 (이미지 밖으로 나가는 경우 방지)
-            left = std::max(0, std::min(left, img_w - 1));
-            top = std::max(0, std::min(top, img_h - 1));
-            width = std::max(1, std::min(width, img_w - left));
-            height = std::max(1, std::min(height, img_h - top));
-
-            boxes.push_back(cv::Rect(left, top, width, height));
-            confidences.push_back(max_conf);
-            class_ids.push_back(max_class_id);
+            continue;
         }
+
+        DetectionCandidate restored = candidate;
+        restored.cx = (candidate.cx - static_cast<float>(dst.x)) / cell->scale + static_cast<float>(cell->src.x);
+        restored.cy = (candidate.cy - static_cast<float>(dst.y)) / cell->scale + static_cast<float>(cell->src.y);
+        restored.w = candidate.w / cell->scale;
+        restored.h = candidate.h / cell->scale;
+        merged.push_back(restored);
     }
+}
 
-    // 5. NMS
-    std::vector<int> nms_result;
-    cv::dnn::NMSBoxes(boxes, confidences, config_.confThreshold, config_.nmsThreshold, nms_result);
+void YOLOv8AdapterImpl::mergeTiles(std::vector<DetectionCandidate> &merged, const cv::Size &frame_size,
+                                   std::vector<vp::domain::model::Detection> &detections)
+{
+    nms_.run(merged, nms_options_, keep_);
 
-    // 6. 결과 변환
-    std::vector<vp::domain::model::Detection> detections;
-    for (int idx : nms_result)
+    detections.clear();
+    detections.reserve(keep_.size());
+    for (int idx : keep_)
     {
-        vp::domain::model::Detection det;
-        det.class_id = static_cast<vp::domain::model::ClassId>(class_ids[idx]);
-        det.confidence = confidences[idx];
-        det.bbox.x = static_cast<float>(boxes[idx].x);
-        det.bbox.y = static_cast<float>(boxes[idx].y);
-        det.bbox.width = static_cast<float>(boxes[idx].width);
-        det.bbox.height = static_cast<float>(boxes[idx].height);
-        detections.push_back(det);
+        appendDetection(merged[idx], frame_size.width, frame_size.height, detections);
     }
+}
 
-    return detections;
+DetectionCandidate YOLOv8AdapterImpl::restoreCandidate(const DetectionCandidate &candidate, const LetterboxInfo &letterbox, const cv::Point &offset)
+{
+    // =========================================================
+    // 좌표 복원 (Coordinate Restoration)
+    // =========================================================
+    // 1. 패딩 제거 (Letterbox 좌표 -> 리사이즈 이미지 좌표)
+    float original_cx = (candidate.cx - letterbox.pad_x);
+    float original_cy = (candidate.cy - letterbox.pad_y);
+
+    // 2. 스케일 역변환 (리사이즈 이미지 좌표 -> 원본 이미지 좌표), 타일이면 타일 위치만큼 이동
+    DetectionCandidate restored = candidate;
+    restored.cx = original_cx / letterbox.scale + static_cast<float>(offset.x);
+    restored.cy = original_cy / letterbox.scale + static_cast<float>(offset.y);
+    restored.w = candidate.w / letterbox.scale;
+    restored.h = candidate.h / letterbox.scale;
+    return restored;
+}
+
+void YOLOv8AdapterImpl::appendDetection(const DetectionCandidate &candidate, int img_w, int img_h, std::vector<vp::domain::model::Detection> &detections)
+{
+    // 3. Top-Left 변환
+    int left = static_cast<int>(candidate.cx - 0.5f * candidate.w);
+    int top = static_cast<int>(candidate.cy - 0.5f * candidate.h);
+    int width = static_cast<int>(candidate.w);
+    int height = static_cast<int>(candidate.h);
+
+    // 경계값 처리 (이미지 밖으로 나가는 경우 방지)
+    left = std::max(0, std::min(left, img_w - 1));
+    top = std::max(0, std::min(top, img_h - 1));
+    width = std::max(1, std::min(width, img_w - left));
+    height = std::max(1, std::min(height, img_h - top));
+
+    vp::domain::model::Detection det;
+    det.class_id = static_cast<vp::domain::model::ClassId>(candidate.class_id);
+    det.confidence = candidate.score;
+    det.bbox.x = static_cast<float>(left);
+    det.bbox.y = static_cast<float>(top);
+    det.bbox.width = static_cast<float>(width);
+    det.bbox.height = static_cast<float>(height);
+    detections.push_back(det);
 }
 
 } // namespace vp::adapter::out
\ No newline at end of file
@@ -1,10 +1,28 @@
 #pragma once
 
+#include "async_detection_queue.hpp"
 #include "detection.hpp"
+#include "detection_cache.hpp"
 #include "image.hpp"
+#include "inference_backend.hpp"
+#include "inference_pool.hpp"
+#include "instance.hpp"
+#include "instance_decoder.hpp"
+#include "letterbox_preprocessor.hpp"
+#include "mosaic_packer.hpp"
+#include "nms_engine.hpp"
+#include "object_detection_port.hpp"
+#include "shared_preprocessor.hpp"
+#include "tile_planner.hpp"
 #include "yolov8_config.hpp"
+#include "yolov8_decoder.hpp"
+#include <array>
+#include <atomic>
+#include <functional>
 #include <memory>
-#include <opencv2/dnn.hpp>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <vector>
 
 namespace vp::adapter::out
@@ -12,16 +30,188 @@ namespace vp::adapter::out
 class YOLOv8AdapterImpl
 {
 public:
-    YOLOv8AdapterImpl(const config::YoloConfig &config);
+    // 설정으로 추론 백엔드 생성 (테스트에서 가짜 백엔드 주입용)
+    using BackendFactory = std::function<std::unique_ptr<InferenceBackend>(const config::YoloConfig &)>;
+
+    // factory 가 비어 있으면 createInferenceBackend 사용
+    YOLOv8AdapterImpl(const config::YoloConfig &config, BackendFactory factory = nullptr);
     ~YOLOv8AdapterImpl();
 
     bool initialize();
-    std::vector<vp::domain::model::Detection> detectObject(const vp::domain::model::ImagePacket &image);
+    std::vector<vp::domain::model::Detection> detectObject(const vp::domain::model::ImagePacket &image, vp::port::out::DetectionLevel level);
+    // REDUCED 가 FULL 과 다르게 실행되는지. 아니면 REDUCED 요청도 FULL 로 처리 (캐시 키 포함)
+    bool supportsLevel(vp::port::out::DetectionLevel level) const;
+    std::vector<vp::domain::model::Detection> detectObjectInRegions(const vp::domain::model::ImagePacket &image,
+                                                                    const std::vector<vp::domain::model::BoundingBox> &regions,
+                                                                    vp::port::out::DetectionLevel level);
+    std::vector<std::vector<vp::domain::model::Detection>> detectObjects(const std::vector<const vp::domain::model::ImagePacket *> &images, vp::port::out::DetectionLevel level);
+    // 세그멘테이션/포즈 모델의 마스크/키포인트 포함 탐지 (타일링 없이 전체 프레임 한 장)
+    std::vector<vp::domain::model::Detection> detectInstances(const vp::domain::model::ImagePacket &image, vp::port::out::DetectionLevel level,
+                                                              std::vector<vp::domain::model::InstanceResult> &instances);
+    // 비동기 탐지 요청. 첫 요청 시 대기열/작업 스레드를 만들고, 대기 요청을 maxBatchSize 장씩 묶어 detectObjects 로 탐지
+    void submitDetection(const vp::domain::model::ImagePacket &image, vp::port::out::DetectionLevel level, vp::port::out::DetectionCallback callback);
     bool deinitialize();
 
+    // 기본 모델 교체 요청. 백그라운드 스레드에서 로드/워밍업한 뒤 다음 탐지 호출 시작 시(프레임 사이) 전환한다.
+    // 입력 크기와 후처리 설정은 유지되므로 같은 입력 크기의 모델이어야 한다. 워밍업 추론이 실패하거나 출력 형식이 맞지 않으면 기존 모델 유지.
+    // reducedModelPath 가 있으면 경량 모델도 그 경로에서 다시 읽어 함께 교체한다. 초기화 전이거나 이미 교체 중이면 false
+    bool reloadModel(const std::string &model_path);
+    bool isReloading() const { return reloading_.load(std::memory_order_acquire); }
+
+    // 기본 모델 입력 텐서 크기/형식 (initialize 이후 유효). ModelRegistry 가 전처리 공유 그룹을 나눌 때 사용
+    cv::Size inputSize() const { return cv::Size(config_.inputWidth, config_.inputHeight); }
+    TensorSpec inputSpec() const { return backend_ != nullptr ? backend_->inputSpec() : TensorSpec{}; }
+    // 기본 모델(DetectionLevel::FULL) 전처리를 다른 모델과 공유. nullptr 이면 자체 전처리 사용
+    void setSharedPreprocessor(SharedPreprocessor *preprocessor) { shared_preprocessor_ = preprocessor; }
+
 private:
+    // 배치 입력 하나 (전체 이미지 또는 타일)
+    struct InputView
+    {
+        size_t image = 0;   // 요청 이미지 인덱스
+        cv::Rect roi;       // 이미지 안의 입력 영역
+        cv::Size frame;     // 이미지 크기
+        bool tiled = false; // true: 결과를 tile_candidates_ 에 모아 병합
+        int mosaic = -1;    // >= 0: 영역 모음 캔버스 인덱스 (mosaic_cells_)
+    };
+
+    struct BackendSelection
+    {
+        InferenceBackend *backend = nullptr;
+        LetterboxPreprocessor *preprocessor = nullptr;
+        SharedPreprocessor *shared_preprocessor = nullptr; // 설정 시 preprocessor 대신 사용
+        cv::Size input_size;                               // dynamic 이면 최대 크기
+        bool dynamic = false;                              // 배치마다 프레임 비율에 맞춘 직사각형 입력 사용
+    };
+
+    struct TiledImage
+    {
+        size_t image = 0;
+        cv::Size frame_size;
+    };
+
+    // 타일 안쪽 경계에서 이 거리(입력 텐서 px) 안에 닿은 박스는 잘린 박스로 간주
+    static constexpr float kTileEdgeMargin = 4.0f;
+
+    // 파이프라인 단계 수 (전처리 / 추론 / 후처리)
+    static constexpr int kPipelineStages = 3;
+
+    // 전처리 -> 추론 단계 버퍼 (배치 번호 % 2 로 번갈아 사용)
+    struct PipelineInput
+    {
+        LetterboxPreprocessor preprocessor;
+        std::vector<LetterboxInput> inputs;
+        std::vector<LetterboxInfo> letterboxes;
+        const cv::Mat *blob = nullptr; // preprocessor 내부 텐서
+        cv::Size input_size;
+    };
+
+    // 추론 -> 후처리 단계 버퍼. 백엔드 출력은 다음 추론에서 덮어쓰일 수 있으므로 복사해 둠
+    struct PipelineOutput
+    {
+        cv::Mat output;
+        std::vector<LetterboxInfo> letterboxes;
+        cv::Size input_size;
+    };
+
+    std::unique_ptr<InferenceBackend> loadBackend(const std::string &model_path) const;
+    BackendSelection selectBackend(vp::port::out::DetectionLevel level);
+    // inputs_/views_ 를 배치 단위로 추론하고 타일/영역 결과를 이미지별로 병합. 추론에 실패하면 false
+    bool inferViews(BackendSelection selection, std::vector<std::vector<vp::domain::model::Detection>> &results);
+    // inputs_ 의 배치들을 전처리/추론/후처리 단계로 겹쳐 실행. 반환: 처리하지 못한 첫 입력 인덱스
+    // 추론이 실패하면 그 배치부터는 inferViews 의 순차 처리가 다시 시도하며 배치/동적 입력 폴백을 판단
+    // 단계에서 던진 예외는 모든 단계가 끝난 뒤 InferencePool 이 다시 던지므로 순차 처리와 같이 탐지 호출 밖으로 전달됨
+    size_t inferPipelined(const BackendSelection &selection, std::vector<std::vector<vp::domain::model::Detection>> &results);
+    // inputs_[begin, end) 를 함께 넣을 입력 텐서 크기 (dynamic 이면 가장 큰 직사각형 입력)
+    cv::Size batchInputSize(const BackendSelection &selection, size_t begin, size_t end) const;
+    // 교체 모델 로드/워밍업 (reload_thread_)
+    void loadReplacement(const std::string &model_path);
+    // 준비된 교체 모델로 전환 (탐지 스레드, 탐지 호출 시작 시). 이전 모델은 진행 중인 추론이 없으므로 바로 해제
+    void applyReplacement();
+    // 캐시 키의 모델/설정 부분 (모델 파일이나 설정이 바뀌면 이전 결과를 쓰지 않음)
+    void updateCacheSeed(uint64_t model_hash);
+    uint64_t frameKey(const cv::Mat &image, vp::domain::model::ImageEncoding encoding, vp::port::out::DetectionLevel level) const;
+    // runs 회 빈 입력 추론. 추론이 실패하거나 출력을 디코딩할 수 없으면 false
+    bool warmup(InferenceBackend &backend, int input_w, int input_h, int runs) const;
+    static bool toMat(const vp::domain::model::ImagePacket &packet, cv::Mat &frame);
+    // inputs_[begin, end) 를 하나의 배치로 추론. 모델이 해당 배치 크기를 처리하지 못하면 false
+    bool runInference(const BackendSelection &selection, size_t begin, size_t end, std::vector<std::vector<vp::domain::model::Detection>> &results);
+    // views_[begin, end) 의 추론 결과를 이미지별 결과 또는 타일 후보로 변환
+    void postprocessBatch(const cv::Mat &output, const TensorSpec &output_spec, size_t begin, size_t end, const std::vector<LetterboxInfo> &letterboxes,
+                          const cv::Mat &protos, const cv::Size &input_size, std::vector<std::vector<vp::domain::model::Detection>> &results);
+    // protos/input_size: instances_ 가 설정된 경우 마스크 조립에 사용
+    void postprocess(const cv::Mat &output, const TensorSpec &output_spec, int batch_index, const LetterboxInfo &letterbox,
+                     int img_w, int img_h, const cv::Mat &protos, const cv::Size &input_size, std::vector<vp::domain::model::Detection> &detections);
+    // 타일 하나의 후보를 프레임 좌표로 복원하여 merged 에 추가 (타일 경계에 잘린 박스 제외)
+    void collectTile(const cv::Mat &output, const TensorSpec &output_spec, int batch_index, const LetterboxInfo &letterbox,
+                     const InputView &view, std::vector<DetectionCandidate> &merged);
+    // 영역 모음 캔버스의 후보를 셀별로 원본 프레임 좌표로 되돌려 merged 에 추가
+    void collectMosaic(const cv::Mat &output, const TensorSpec &output_spec, int batch_index, const LetterboxInfo &letterbox,
+                       const InputView &view, std::vector<DetectionCandidate> &merged);
+    void mergeTiles(std::vector<DetectionCandidate> &merged, const cv::Size &frame_size, std::vector<vp::domain::model::Detection> &detections);
+    // 입력 텐서 좌표 -> 이미지 좌표 (offset: 이미지 안의 입력 영역 위치)
+    static DetectionCandidate restoreCandidate(const DetectionCandidate &candidate, const LetterboxInfo &letterbox, const cv::Point &offset);
+    static void appendDetection(const DetectionCandidate &candidate, int img_w, int img_h, std::vector<vp::domain::model::Detection> &detections);
+
+    BackendFactory backend_factory_;
     bool is_initialized_ = false;
-    std::unique_ptr<cv::dnn::Net> net_;
+    // 탐지 호출 직렬화 (비동기 작업 스레드와 동기 호출이 버퍼/백엔드를 함께 쓰지 않도록). 재진입 없이 공개 탐지 함수에서만 잠금
+    std::mutex detect_mutex_;
+    std::mutex async_mutex_;
+    std::unique_ptr<AsyncDetectionQueue> async_queue_; // async_mutex_ 로 보호 (생성/해제)
+    std::unique_ptr<InferenceBackend> backend_;
+    std::unique_ptr<InferenceBackend> reduced_backend_; // (선택) 경량 모델
+    LetterboxPreprocessor preprocessor_;                // 모델별 입력 텐서 버퍼를 따로 유지
+    LetterboxPreprocessor reduced_preprocessor_;
+    SharedPreprocessor *shared_preprocessor_ = nullptr; // (선택) 다른 모델과 공유하는 기본 모델 전처리
+
+    // 모델 교체 (hot reload)
+    std::thread reload_thread_;
+    std::atomic<bool> reloading_{false};            // 로드/워밍업 진행 중
+    std::atomic<bool> replacement_ready_{false};    // replacement_ 에 전환할 모델이 있음 (탐지 호출마다 잠금 없이 확인)
+    std::mutex reload_mutex_;
+    std::unique_ptr<InferenceBackend> replacement_;         // reload_mutex_ 로 보호
+    std::unique_ptr<InferenceBackend> replacement_reduced_; // 함께 교체할 경량 모델 (reducedModelPath 가 있을 때, reload_mutex_ 로 보호)
+    uint64_t replacement_hash_ = 0;                         // 교체 모델 파일 해시 (캐시 사용 시, reload_mutex_ 로 보호)
+    uint64_t replacement_reduced_hash_ = 0;
+
+    // (선택) 탐지 결과 캐시
+    DetectionCache cache_;
+    uint64_t cache_seed_ = 0;
+    uint64_t reduced_model_hash_ = 0;
+    std::vector<std::pair<size_t, uint64_t>> cache_misses_; // 이번 호출에서 추론한 (이미지 인덱스, 키)
+    YOLOv8Decoder decoder_;
+    InstanceDecoder instance_decoder_;
+    std::vector<vp::domain::model::InstanceResult> *instances_ = nullptr; // detectInstances 호출 중에만 설정
+    bool proto_warned_ = false;                                           // 프로토타입 출력 없음 경고 (한 번만)
+    NmsEngine nms_;
+    NmsOptions nms_options_;
+    NmsOptions tile_nms_options_; // 타일별 1차 NMS (hard)
+    TilePlanner tile_planner_;
+    std::vector<DetectionCandidate> candidates_; // 프레임마다 재사용
+    std::vector<int> keep_;
+    bool batch_supported_ = true;   // 배치 추론 실패 시 false 로 전환
+    bool dynamic_supported_ = true; // 설정 크기가 아닌 입력을 모델이 거부하면 false 로 전환
+
+    // 단계 겹침 실행 (pipelineOverlap)
+    std::unique_ptr<InferencePool> pipeline_pool_;
+    std::array<PipelineInput, 2> pipeline_inputs_;
+    std::array<PipelineOutput, 2> pipeline_outputs_;
+    std::vector<std::pair<size_t, size_t>> pipeline_batches_; // inputs_ 배치 구간 [begin, end)
+
+    // 배치 구성 버퍼 (호출마다 재사용)
+    std::vector<LetterboxInput> inputs_;
+    std::vector<InputView> views_; // inputs_[i] 에 해당하는 요청 이미지/영역
+    std::vector<TiledImage> tiled_images_;
+    std::vector<std::vector<DetectionCandidate>> tile_candidates_; // 요청 이미지별 타일 후보 (프레임 좌표)
+
+    // 영역 탐지 버퍼 (호출마다 재사용)
+    MosaicPacker mosaic_packer_;
+    std::vector<cv::Rect> region_rects_;
+    std::vector<MosaicCell> mosaic_cells_;
+    std::vector<cv::Mat> canvases_;
+    std::vector<LetterboxInput> batch_inputs_;
+    std::vector<LetterboxInfo> letterboxes_;
     const config::YoloConfig &config_;
 };
 } // namespace vp::adapter::out
@@ -0,0 +1,242 @@
+#include "yolov8_decoder.hpp"
+#include <algorithm>
+#include <opencv2/core.hpp>
+#include <opencv2/core/hal/intrin.hpp>
+
+namespace
+{
+constexpr int kBoxDims = 4;        // cx, cy, w, h
+constexpr int kBlockAnchors = 256; // 블록별 최대 점수/클래스가 L1 에 머무는 크기
+
+// 텐서 원소 -> float (양자화 텐서는 역양자화 전 정수 값)
+inline float toFloat(float v) { return v; }
+inline float toFloat(cv::float16_t v) { return static_cast<float>(v); }
+inline float toFloat(uchar v) { return static_cast<float>(v); }
+inline float toFloat(schar v) { return static_cast<float>(v); }
+
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+inline cv::v_float32 loadFloat(const float *p) { return cv::vx_load(p); }
+inline cv::v_float32 loadFloat(const cv::float16_t *p) { return cv::vx_load_expand(p); }
+inline cv::v_float32 loadFloat(const uchar *p) { return cv::v_cvt_f32(cv::v_reinterpret_as_s32(cv::vx_load_expand_q(p))); }
+inline cv::v_float32 loadFloat(const schar *p) { return cv::v_cvt_f32(cv::vx_load_expand_q(p)); }
+#endif
+
+// anchors [begin, end) 의 rows 중 최대 점수/행 인덱스를 계산. 반환: 기준 이상인 앵커가 있는지
+// 점수와 기준은 텐서 원소 값 기준 (양자화 텐서도 scale > 0 이면 대소 관계가 같음)
+template <typename T>
+bool reduceBlock(const T *scores, const int *rows, int num_rows, int num_anchors, int begin, int end, float conf_threshold,
+                 float *max_score, float *max_class)
+{
+    const int len = end - begin;
+    const T *row0 = scores + static_cast<size_t>(rows[0]) * num_anchors + begin;
+    for (int i = 0; i < len; ++i)
+    {
+        max_score[i] = toFloat(row0[i]);
+        max_class[i] = 0.0f;
+    }
+
+    int i = 0;
+    bool any = false;
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+    const int lanes = cv::VTraits<cv::v_float32>::vlanes();
+    const cv::v_float32 v_threshold = cv::vx_setall_f32(conf_threshold);
+    for (; i <= len - lanes; i += lanes)
+    {
+        cv::v_float32 v_max = cv::vx_load(max_score + i);
+        cv::v_float32 v_cls = cv::vx_load(max_class + i);
+        for (int c = 1; c < num_rows; ++c)
+        {
+            const cv::v_float32 v = loadFloat(scores + static_cast<size_t>(rows[c]) * num_anchors + begin + i);
+            // 같은 점수는 앞선 클래스 유지 (스칼라 구현과 동일)
+            const cv::v_float32 mask = cv::v_gt(v, v_max);
+            v_max = cv::v_select(mask, v, v_max);
+            v_cls = cv::v_select(mask, cv::vx_setall_f32(static_cast<float>(c)), v_cls);
+        }
+        cv::v_store(max_score + i, v_max);
+        cv::v_store(max_class + i, v_cls);
+        any = any || cv::v_check_any(cv::v_ge(v_max, v_threshold));
+    }
+    cv::vx_cleanup();
+#endif
+    for (; i < len; ++i)
+    {
+        for (int c = 1; c < num_rows; ++c)
+        {
+            const float v = toFloat(scores[static_cast<size_t>(rows[c]) * num_anchors + begin + i]);
+            if (v > max_score[i])
+            {
+                max_score[i] = v;
+                max_class[i] = static_cast<float>(c);
+            }
+        }
+        any = any || max_score[i] >= conf_threshold;
+    }
+    return any;
+}
+
+// rows: 평가할 클래스 행, thresholds: 행별 기준 (실수 점수 단위)
+template <typename T>
+void decodeAs(const cv::Mat &output, const std::vector<int> &rows, const std::vector<float> &thresholds, const vp::adapter::out::TensorSpec &spec,
+              std::vector<vp::adapter::out::DetectionCandidate> &candidates, int batch_index)
+{
+    const int dimensions = output.size[1];
+    const int num_anchors = output.size[2];
+    const int num_rows = static_cast<int>(rows.size());
+    if (num_rows <= 0 || num_anchors <= 0)
+    {
+        return;
+    }
+
+    // 블록 건너뛰기는 가장 낮은 기준으로 판단 (후보별 기준은 해당 클래스 기준으로 다시 확인)
+    // 양자화 텐서: 기준을 정수 영역으로 옮겨 비교하고, 통과한 앵커만 역양자화
+    const auto [min_threshold, max_threshold] = std::minmax_element(thresholds.begin(), thresholds.end());
+    const float lowest_threshold = *min_threshold;
+    const bool uniform = *min_threshold == *max_threshold;
+    float block_threshold = lowest_threshold;
+    float scale = 1.0f;
+    float zero_point = 0.0f;
+    if (spec.isQuantized())
+    {
+        scale = spec.scale;
+        zero_point = static_cast<float>(spec.zero_point);
+        block_threshold = block_threshold / scale + zero_point;
+    }
+    const auto dequantize = [&](T v)
+    { return (toFloat(v) - zero_point) * scale; };
+
+    const T *data = output.ptr<T>() + static_cast<size_t>(batch_index) * dimensions * num_anchors;
+    const T *scores = data + static_cast<size_t>(kBoxDims) * num_anchors;
+
+    float max_score[kBlockAnchors];
+    float max_class[kBlockAnchors];
+    for (int begin = 0; begin < num_anchors; begin += kBlockAnchors)
+    {
+        const int end = std::min(begin + kBlockAnchors, num_anchors);
+        if (!reduceBlock(scores, rows.data(), num_rows, num_anchors, begin, end, block_threshold, max_score, max_class))
+        {
+            continue;
+        }
+
+        for (int a = begin; a < end; ++a)
+        {
+            float score = (max_score[a - begin] - zero_point) * scale;
+            auto row = static_cast<int>(max_class[a - begin]);
+            if (score < thresholds[row])
+            {
+                if (uniform || score < lowest_threshold)
+                {
+                    continue;
+                }
+                // 최고 점수 클래스가 자기 기준에 못 미쳐도 기준이 낮은 다른 클래스는 통과할 수 있으므로
+                // 기준을 넘은 클래스 중 점수가 가장 높은 클래스를 다시 찾음 (드문 경우라 스칼라로 처리)
+                row = -1;
+                for (int r = 0; r < num_rows; ++r)
+                {
+                    const float v = dequantize(scores[static_cast<size_t>(rows[r]) * num_anchors + a]);
+                    if (v >= thresholds[r] && (row < 0 || v > score))
+                    {
+                        row = r;
+                        score = v;
+                    }
+                }
+                if (row < 0)
+                {
+                    continue;
+                }
+            }
+
+            vp::adapter::out::DetectionCandidate candidate;
+            candidate.cx = dequantize(data[a]);
+            candidate.cy = dequantize(data[num_anchors + a]);
+            candidate.w = dequantize(data[2 * num_anchors + a]);
+            candidate.h = dequantize(data[3 * num_anchors + a]);
+            candidate.score = score;
+            candidate.class_id = rows[row];
+            candidate.anchor = a;
+            candidates.push_back(candidate);
+        }
+    }
+}
+} // namespace
+
+namespace vp::adapter::out
+{
+
+void YOLOv8Decoder::setClassFilter(const ClassFilter &filter)
+{
+    filter_ = filter;
+    std::sort(filter_.class_ids.begin(), filter_.class_ids.end());
+    filter_.class_ids.erase(std::unique(filter_.class_ids.begin(), filter_.class_ids.end()), filter_.class_ids.end());
+}
+
+void YOLOv8Decoder::prepareRows(int num_classes, float conf_threshold)
+{
+    // 오름차순 유지: 같은 점수면 앞선 클래스 (필터가 없을 때와 동일)
+    rows_.clear();
+    if (filter_.class_ids.empty())
+    {
+        for (int c = 0; c < num_classes; ++c)
+        {
+            rows_.push_back(c);
+        }
+    }
+    else
+    {
+        for (int c : filter_.class_ids)
+        {
+            if (c >= 0 && c < num_classes)
+            {
+                rows_.push_back(c);
+            }
+        }
+    }
+
+    row_thresholds_.clear();
+    for (int c : rows_)
+    {
+        const bool has_threshold = c < static_cast<int>(filter_.thresholds.size()) && filter_.thresholds[c] >= 0.0f;
+        row_thresholds_.push_back(has_threshold ? filter_.thresholds[c] : conf_threshold);
+    }
+}
+
+bool YOLOv8Decoder::acceptsOutput(const cv::Mat &output) const
+{
+    const int depth = output.depth();
+    return output.dims == 3 && output.size[2] > 0 && output.size[1] - kBoxDims - extra_rows_ > 0 &&
+           (depth == CV_32F || depth == CV_16F || depth == CV_8U || depth == CV_8S);
+}
+
+void YOLOv8Decoder::decode(const cv::Mat &output, float conf_threshold, std::vector<DetectionCandidate> &candidates, int batch_index,
+                           const TensorSpec &spec)
+{
+    candidates.clear();
+
+    // YOLOv8 Output: [Batch, 4+Classes(+Extra), Anchors] -> [1, 84, 8400]
+    CV_Assert(output.dims == 3 && output.isContinuous());
+    CV_Assert(batch_index >= 0 && batch_index < output.size[0]);
+    CV_Assert(!spec.isQuantized() || spec.scale > 0.0f);
+
+    const int num_classes = output.size[1] - kBoxDims - extra_rows_;
+    CV_Assert(num_classes > 0);
+    this->prepareRows(num_classes, conf_threshold);
+
+    switch (output.depth())
+    {
+    case CV_32F:
+        decodeAs<float>(output, rows_, row_thresholds_, spec, candidates, batch_index);
+        break;
+    case CV_16F:
+        decodeAs<cv::float16_t>(output, rows_, row_thresholds_, spec, candidates, batch_index);
+        break;
+    case CV_8U:
+        decodeAs<uchar>(output, rows_, row_thresholds_, spec, candidates, batch_index);
+        break;
+    case CV_8S:
+        decodeAs<schar>(output, rows_, row_thresholds_, spec, candidates, batch_index);
+        break;
+    default:
+        CV_Error(cv::Error::StsUnsupportedFormat, "Unsupported YOLOv8 output depth");
+    }
+}
+
+} // namespace vp::adapter::out
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "tensor_spec.hpp"
+#include <opencv2/core/mat.hpp>
+#include <vector>
+
+namespace vp::adapter::out
+{
+
+// 신뢰도 기준을 넘은 앵커 하나 (좌표는 입력 텐서 기준 중심/크기)
+struct DetectionCandidate
+{
+    float cx = 0.0f;
+    float cy = 0.0f;
+    float w = 0.0f;
+    float h = 0.0f;
+    float score = 0.0f;
+    int class_id = -1;
+    int anchor = -1; // 출력 텐서의 앵커 인덱스 (NMS 후 남은 후보의 마스크 계수/키포인트 조회용)
+};
+
+// 디코딩 시 평가할 클래스와 클래스별 신뢰도 기준
+struct ClassFilter
+{
+    std::vector<int> class_ids;    // 평가할 클래스 (비어 있으면 전체)
+    std::vector<float> thresholds; // 클래스 ID 로 인덱싱한 기준 (범위 밖이거나 음수면 decode 의 conf_threshold)
+};
+
+/**
+ * @brief YOLOv8 출력 텐서 [N, 4 + classes, anchors] 를 후보 목록으로 변환
+ *
+ * 클래스별 점수 행이 앵커 방향으로 연속이므로, 앵커 블록 단위로 클래스 행을 순회하며
+ * 앵커 여러 개의 최대 점수/클래스를 SIMD 로 동시에 갱신한다.
+ * 블록 전체가 기준 미만이면 좌표를 읽지 않고 건너뛴다.
+ * FP16/양자화 출력은 원소 값 그대로 비교하고, 기준을 넘은 앵커만 float 로 역양자화한다.
+ * 클래스 필터가 있으면 선택된 클래스 행만 읽어 최대 점수를 구하고, 그 클래스의 기준으로 후보를 거른다.
+ * 클래스별 기준이 다르면 자기 기준을 넘은 클래스 중 점수가 가장 높은 클래스를 후보로 한다
+ * (최고 점수 클래스가 기준 미만이어도 기준이 낮은 다른 클래스로 남을 수 있음).
+ * 세그멘테이션/포즈 출력은 클래스 행 뒤의 추가 행(마스크 계수, 키포인트)을 setExtraRows 로 알려 주면
+ * 클래스 점수로 읽지 않는다. 추가 행은 여기서 읽지 않고 NMS 후 남은 후보만 InstanceDecoder 가 읽는다.
+ */
+class YOLOv8Decoder
+{
+public:
+    // candidates 는 비운 뒤 채움 (용량은 재사용). batch_index: 배치 출력 [N, 4 + classes, anchors] 중 디코딩할 이미지
+    // output: CV_32F, CV_16F, CV_8U, CV_8S. 양자화 출력이면 spec 의 scale/zero_point 로 역양자화
+    void decode(const cv::Mat &output, float conf_threshold, std::vector<DetectionCandidate> &candidates, int batch_index = 0,
+                const TensorSpec &spec = {});
+
+    void setClassFilter(const ClassFilter &filter);
+    // output 을 decode 할 수 있는지 (형식 [N, 4 + classes + extra rows, anchors], 지원 자료형)
+    bool acceptsOutput(const cv::Mat &output) const;
+
+    // 클래스 행 뒤에 오는 추가 행 수 (세그멘테이션: 마스크 계수 수, 포즈: 키포인트 값 수)
+    void setExtraRows(int extra_rows) { extra_rows_ = extra_rows; }
+    int extraRows() const { return extra_rows_; }
+
+private:
+    void prepareRows(int num_classes, float conf_threshold);
+
+    ClassFilter filter_;
+    int extra_rows_ = 0;
+    std::vector<int> rows_;             // 평가할 클래스 행 (오름차순)
+    std::vector<float> row_thresholds_; // rows_ 별 신뢰도 기준
+};
+
+} // namespace vp::adapter::out
@@ -0,0 +1,119 @@
+#include "jsonl_result_sink_adapter.hpp"
+#include "nlohmann/json.hpp"
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace vp::adapter::out
+{
+class JsonlResultSinkAdapterTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        config_.outputPath = "test_results.jsonl";
+        config_.flushInterval = 1;
+    }
+
+    void TearDown() override
+    {
+        std::remove(config_.outputPath.c_str());
+    }
+
+    std::vector<nlohmann::json> readLines() const
+    {
+        std::vector<nlohmann::json> lines;
+        std::ifstream ifs(config_.outputPath);
+        std::string line;
+        while (std::getline(ifs, line))
+        {
+            lines.push_back(nlohmann::json::parse(line));
+        }
+        return lines;
+    }
+
+    config::ResultSinkConfig config_;
+};
+
+TEST_F(JsonlResultSinkAdapterTest, WritesOneLinePerFrame)
+{
+    JsonlResultSinkAdapter sink{config_};
+    ASSERT_TRUE(sink.initialize());
+
+    for (uint64_t id = 1; id <= 3; ++id)
+    {
+        domain::model::FrameResult result;
+        result.frame_id = id;
+        result.timestamp = id * 100;
+        result.detections.push_back({domain::model::ClassId::CAR, 0.9f, {1.0f, 2.0f, 3.0f, 4.0f}});
+        sink.publish(result);
+    }
+    sink.flush();
+
+    auto lines = this->readLines();
+    ASSERT_EQ(lines.size(), 3U);
+    EXPECT_EQ(lines[0]["frameId"], 1);
+    EXPECT_EQ(lines[2]["timestamp"], 300);
+    ASSERT_EQ(lines[1]["detections"].size(), 1U);
+    EXPECT_EQ(lines[1]["detections"][0]["classId"], static_cast<int>(domain::model::ClassId::CAR));
+    EXPECT_EQ(lines[1]["detections"][0]["bbox"][3], 4.0);
+    EXPECT_FALSE(lines[1]["detections"][0].contains("trackId"));
+    EXPECT_FALSE(lines[1]["detections"][0].contains("model"));
+}
+
+TEST_F(JsonlResultSinkAdapterTest, WritesTrackIdVelocityAndModelOfDetections)
+{
+    JsonlResultSinkAdapter sink{config_};
+    ASSERT_TRUE(sink.initialize());
+
+    domain::model::FrameResult result;
+    result.frame_id = 1;
+    domain::model::Detection tracked{domain::model::ClassId::PERSON, 0.8f, {1.0f, 2.0f, 3.0f, 4.0f}};
+    tracked.track_id = 7;
+    tracked.velocity_x = 12.5f;
+    tracked.velocity_y = -3.0f;
+    tracked.model = 1;
+    result.detections.push_back(tracked);
+    sink.publish(result);
+    sink.flush();
+
+    auto lines = this->readLines();
+    ASSERT_EQ(lines.size(), 1U);
+    const auto &det = lines[0]["detections"][0];
+    EXPECT_EQ(det["trackId"], 7);
+    EXPECT_EQ(det["velocity"][0], 12.5);
+    EXPECT_EQ(det["velocity"][1], -3.0);
+    EXPECT_EQ(det["model"], 1);
+}
+
+TEST_F(JsonlResultSinkAdapterTest, OmitsTimingsWhenDisabled)
+{
+    config_.writeTimings = false;
+    JsonlResultSinkAdapter sink{config_};
+    ASSERT_TRUE(sink.initialize());
+
+    domain::model::FrameResult result;
+    result.frame_id = 1;
+    result.localization_us = 1234;
+    result.detection_us = 5678;
+    sink.publish(result);
+    sink.flush();
+
+    auto lines = this->readLines();
+    ASSERT_EQ(lines.size(), 1U);
+    EXPECT_EQ(lines[0]["frameId"], 1);
+    EXPECT_FALSE(lines[0].contains("localizationUs"));
+    EXPECT_FALSE(lines[0].contains("detectionUs"));
+}
+
+TEST_F(JsonlResultSinkAdapterTest, PublishBeforeInitializeIsIgnored)
+{
+    JsonlResultSinkAdapter sink{config_};
+    sink.publish(domain::model::FrameResult{});
+    ASSERT_TRUE(sink.deinitialize());
+
+    EXPECT_TRUE(this->readLines().empty());
+}
+} // namespace vp::adapter::out
@@ -0,0 +1,25 @@
+#pragma once
+#include "result_sink_config.hpp"
+#include "result_sink_port.hpp"
+#include <memory>
+
+namespace vp::adapter::out
+{
+class JsonlResultSinkAdapterImpl;
+
+// 프레임 처리 결과를 JSON Lines 파일로 기록 (배치 처리 결과 비교/정확도 측정용)
+class JsonlResultSinkAdapter : public vp::port::out::ResultSinkPort
+{
+public:
+    JsonlResultSinkAdapter(const config::ResultSinkConfig &config);
+    ~JsonlResultSinkAdapter() override;
+
+    bool initialize();
+    void publish(const domain::model::FrameResult &result) override;
+    void flush() override;
+    bool deinitialize();
+
+private:
+    std::unique_ptr<JsonlResultSinkAdapterImpl> impl_;
+};
+} // namespace vp::adapter::out
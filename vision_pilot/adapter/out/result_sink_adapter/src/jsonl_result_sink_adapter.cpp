@@ -0,0 +1,37 @@
+#include "jsonl_result_sink_adapter.hpp"
+#include "gaia_log.hpp"
+#include "jsonl_result_sink_adapter_impl.hpp"
+
+namespace vp::adapter::out
+{
+JsonlResultSinkAdapter::JsonlResultSinkAdapter(const config::ResultSinkConfig &config)
+    : impl_(std::make_unique<JsonlResultSinkAdapterImpl>(config))
+{
+    LOG_TRA("");
+}
+
+JsonlResultSinkAdapter::~JsonlResultSinkAdapter()
+{
+    LOG_TRA("");
+}
+
+bool JsonlResultSinkAdapter::initialize()
+{
+    return impl_->initialize();
+}
+
+void JsonlResultSinkAdapter::publish(const domain::model::FrameResult &result)
+{
+    impl_->publish(result);
+}
+
+void JsonlResultSinkAdapter::flush()
+{
+    impl_->flush();
+}
+
+bool JsonlResultSinkAdapter::deinitialize()
+{
+    return impl_->deinitialize();
+}
+} // namespace vp::adapter::out
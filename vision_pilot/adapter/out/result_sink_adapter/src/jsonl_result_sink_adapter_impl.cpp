@@ -0,0 +1,112 @@
+#include "jsonl_result_sink_adapter_impl.hpp"
+#include "gaia_log.hpp"
+#include "nlohmann/json.hpp"
+
+namespace
+{
+nlohmann::json toJson(const vp::domain::model::FrameResult &result, bool write_timings)
+{
+    nlohmann::json detections = nlohmann::json::array();
+    for (const auto &det : result.detections)
+    {
+        nlohmann::json item = {
+            {"classId", static_cast<int>(det.class_id)},
+            {"confidence", det.confidence},
+            {"bbox", {det.bbox.x, det.bbox.y, det.bbox.width, det.bbox.height}},
+        };
+        if (det.track_id >= 0)
+        {
+            item["trackId"] = det.track_id;
+            item["velocity"] = {det.velocity_x, det.velocity_y};
+        }
+        if (det.model > 0)
+        {
+            item["model"] = det.model;
+        }
+        detections.push_back(std::move(item));
+    }
+
+    const auto &pose = result.pose;
+    nlohmann::json line = {
+        {"frameId", result.frame_id},
+        {"timestamp", result.timestamp},
+        {"pose", {{"lost", pose.is_lost}, {"t", {pose.x, pose.y, pose.z}}, {"q", {pose.qw, pose.qx, pose.qy, pose.qz}}}},
+        {"detected", result.detected},
+        {"detections", std::move(detections)},
+    };
+    if (write_timings)
+    {
+        line["localizationUs"] = result.localization_us;
+        line["detectionUs"] = result.detection_us;
+    }
+    return line;
+}
+} // namespace
+
+namespace vp::adapter::out
+{
+JsonlResultSinkAdapterImpl::JsonlResultSinkAdapterImpl(const config::ResultSinkConfig &config)
+    : config_{config}
+{
+    LOG_TRA("");
+}
+
+JsonlResultSinkAdapterImpl::~JsonlResultSinkAdapterImpl()
+{
+    LOG_TRA("");
+    this->deinitialize();
+}
+
+bool JsonlResultSinkAdapterImpl::initialize()
+{
+    LOG_TRA("");
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ofs_.open(config_.outputPath, std::ios::out | std::ios::trunc);
+    if (!ofs_.is_open())
+    {
+        LOG_ERR("Failed to open result file: {}", config_.outputPath);
+        return false;
+    }
+    written_count_ = 0;
+    LOG_INF("Writing frame results to {}", config_.outputPath);
+    return true;
+}
+
+void JsonlResultSinkAdapterImpl::publish(const domain::model::FrameResult &result)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!ofs_.is_open())
+    {
+        return;
+    }
+
+    ofs_ << toJson(result, config_.writeTimings).dump() << '\n';
+    ++written_count_;
+
+    if (config_.flushInterval > 0 && written_count_ % config_.flushInterval == 0)
+    {
+        ofs_.flush();
+    }
+}
+
+void JsonlResultSinkAdapterImpl::flush()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (ofs_.is_open())
+    {
+        ofs_.flush();
+    }
+}
+
+bool JsonlResultSinkAdapterImpl::deinitialize()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (ofs_.is_open())
+    {
+        ofs_.close();
+        LOG_INF("Saved {} frame results to {}", written_count_, config_.outputPath);
+    }
+    return true;
+}
+} // namespace vp::adapter::out
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "frame_result.hpp"
+#include "result_sink_config.hpp"
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+
+namespace vp::adapter::out
+{
+class JsonlResultSinkAdapterImpl
+{
+public:
+    JsonlResultSinkAdapterImpl(const config::ResultSinkConfig &config);
+    ~JsonlResultSinkAdapterImpl();
+
+    bool initialize();
+    void publish(const domain::model::FrameResult &result);
+    void flush();
+    bool deinitialize();
+
+private:
+    const config::ResultSinkConfig &config_;
+
+    std::mutex mutex_;
+    std::ofstream ofs_;
+    uint64_t written_count_ = 0;
+};
+} // namespace vp::adapter::out
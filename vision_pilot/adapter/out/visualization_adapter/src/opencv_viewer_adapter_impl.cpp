@@ -1,6 +1,8 @@
 // adapter/out/visualizer/src/opencv_viewer_adapter_impl.cpp
 #include "opencv_viewer_adapter_impl.hpp"
 #include "gaia_log.hpp"
+#include <algorithm>
+#include <cstdio>
 #include <opencv2/highgui/highgui.hpp>
 #include <opencv2/imgproc/imgproc.hpp>
 
@@ -42,7 +44,7 @@ bool OpenCVViewerAdapterImpl::stop()
 }
 
 void OpenCVViewerAdapterImpl::render(const domain::model::Pose &pose,
-                                     std::vector<domain::model::Detection> detections,
+                                     const domain::model::DetectionBuffer &detections,
                                      const domain::model::ImagePacket &frame)
 {
     cv::Mat canvas;
@@ -87,12 +89,17 @@ void OpenCVViewerAdapterImpl::render(const domain::model::Pose &pose,
         cv::rectangle(canvas, rect, box_color, 2);
 
         // 라벨 텍스트 생성
-        // "Person 0.95"
-        std::string class_name = domain::model::ClassIdHelper::toString(det.class_id);
-
-        std::stringstream ss;
-        ss << class_name << " " << std::fixed << std::setprecision(2) << det.confidence;
-        std::string label_text = ss.str();
+        // "Person 0.95" (추적 결과는 "Person 0.95 #3"). 박스마다 할당하지 않도록 스택 버퍼에 만든 뒤 label_ 재사용
+        const auto class_name = domain::model::ClassIdHelper::toString(det.class_id);
+
+        char buffer[64];
+        const int length = det.track_id >= 0
+                               ? std::snprintf(buffer, sizeof(buffer), "%.*s %.2f #%d", static_cast<int>(class_name.size()), class_name.data(),
+                                               det.confidence, det.track_id)
+                               : std::snprintf(buffer, sizeof(buffer), "%.*s %.2f", static_cast<int>(class_name.size()), class_name.data(),
+                                               det.confidence);
+        label_.assign(buffer, length > 0 ? std::min<size_t>(length, sizeof(buffer) - 1) : 0);
+        const std::string &label_text = label_;
 
         // 텍스트 배경 그리기
         // 폰트 크기(0.5)와 두께(1)를 작게 설정
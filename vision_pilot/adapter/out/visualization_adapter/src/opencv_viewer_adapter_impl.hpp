@@ -4,6 +4,7 @@
 #include "image.hpp"
 #include "pose.hpp"
 #include "vslam_config.hpp"
+#include <string>
 namespace vp::adapter::out
 {
 class OpenCVViewerAdapterImpl
@@ -14,10 +15,11 @@ public:
     bool start();
     bool stop();
 
-    void render(const domain::model::Pose &pose, std::vector<domain::model::Detection> detections, const domain::model::ImagePacket &frame);
+    void render(const domain::model::Pose &pose, const domain::model::DetectionBuffer &detections, const domain::model::ImagePacket &frame);
 
 private:
     const config::VslamViewerConfig config_;
     const std::string window_name_ = "VisionPilot - OpenCV Viewer";
+    std::string label_; // 박스 라벨 (프레임마다 재사용)
 };
 } // namespace vp::adapter::out
\ No newline at end of file
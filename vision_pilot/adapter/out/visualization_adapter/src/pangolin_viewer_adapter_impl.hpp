@@ -15,7 +15,7 @@ public:
     ~PangolinViewerAdapterImpl();
     bool start();
     bool stop();
-    void render(const domain::model::Pose &pose, std::vector<domain::model::Detection> detections, const domain::model::ImagePacket &frame);
+    void render(const domain::model::Pose &pose, const domain::model::DetectionBuffer &detections, const domain::model::ImagePacket &frame);
 
 private:
     config::VslamViewerConfig config_;
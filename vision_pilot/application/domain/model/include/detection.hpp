@@ -1,5 +1,7 @@
 #pragma once
-#include <string>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
 
 namespace vp::domain::model
 {
@@ -97,182 +99,104 @@ public:
     // int -> Enum 변환
     static ClassId fromInt(int id)
     {
-        if (id >= 0 && id <= 79)
+        if (id >= 0 && id < kClassCount)
         {
             return static_cast<ClassId>(id);
         }
         return ClassId::UNKNOWN;
     }
 
-    // Enum -> String 변환 (디버깅/로깅용)
-    static std::string toString(ClassId id)
+    // Enum -> String 변환 (디버깅/로깅용). 정적 테이블을 가리키므로 할당 없음
+    static constexpr std::string_view toString(ClassId id)
     {
-        switch (id)
-        {
-        case ClassId::PERSON:
-            return "Person";
-        case ClassId::BICYCLE:
-            return "Bicycle";
-        case ClassId::CAR:
-            return "Car";
-        case ClassId::MOTORCYCLE:
-            return "Motorcycle";
-        case ClassId::AIRPLANE:
-            return "Airplane";
-        case ClassId::BUS:
-            return "Bus";
-        case ClassId::TRAIN:
-            return "Train";
-        case ClassId::TRUCK:
-            return "Truck";
-        case ClassId::BOAT:
-            return "Boat";
-        case ClassId::TRAFFIC_LIGHT:
-            return "Traffic Light";
-        case ClassId::FIRE_HYDRANT:
-            return "Fire Hydrant";
-        case ClassId::STOP_SIGN:
-            return "Stop Sign";
-        case ClassId::PARKING_METER:
-            return "Parking Meter";
-        case ClassId::BENCH:
-            return "Bench";
-        case ClassId::BIRD:
-            return "Bird";
-        case ClassId::CAT:
-            return "Cat";
-        case ClassId::DOG:
-            return "Dog";
-        case ClassId::HORSE:
-            return "Horse";
-        case ClassId::SHEEP:
-            return "Sheep";
-        case ClassId::COW:
-            return "Cow";
-        case ClassId::ELEPHANT:
-            return "Elephant";
-        case ClassId::BEAR:
-            return "Bear";
-        case ClassId::ZEBRA:
-            return "Zebra";
-        case ClassId::GIRAFFE:
-            return "Giraffe";
-        case ClassId::BACKPACK:
-            return "Backpack";
-        case ClassId::UMBRELLA:
-            return "Umbrella";
-        case ClassId::HANDBAG:
-            return "Handbag";
-        case ClassId::TIE:
-            return "Tie";
-        case ClassId::SUITCASE:
-            return "Suitcase";
-        case ClassId::FRISBEE:
-            return "Frisbee";
-        case ClassId::SKIS:
-            return "Skis";
-        case ClassId::SNOWBOARD:
-            return "Snowboard";
-        case ClassId::SPORTS_BALL:
-            return "Sports Ball";
-        case ClassId::KITE:
-            return "Kite";
-        case ClassId::BASEBALL_BAT:
-            return "Baseball Bat";
-        case ClassId::BASEBALL_GLOVE:
-            return "Baseball Glove";
-        case ClassId::SKATEBOARD:
-            return "Skateboard";
-        case ClassId::SURFBOARD:
-            return "Surfboard";
-        case ClassId::TENNIS_RACKET:
-            return "Tennis Racket";
-        case ClassId::BOTTLE:
-            return "Bottle";
-        case ClassId::WINE_GLASS:
-            return "Wine Glass";
-        case ClassId::CUP:
-            return "Cup";
-        case ClassId::FORK:
-            return "Fork";
-        case ClassId::KNIFE:
-            return "Knife";
-        case ClassId::SPOON:
-            return "Spoon";
-        case ClassId::BOWL:
-            return "Bowl";
-        case ClassId::BANANA:
-            return "Banana";
-        case ClassId::APPLE:
-            return "Apple";
-        case ClassId::SANDWICH:
-            return "Sandwich";
-        case ClassId::ORANGE:
-            return "Orange";
-        case ClassId::BROCCOLI:
-            return "Broccoli";
-        case ClassId::CARROT:
-            return "Carrot";
-        case ClassId::HOT_DOG:
-            return "Hot Dog";
-        case ClassId::PIZZA:
-            return "Pizza";
-        case ClassId::DONUT:
-            return "Donut";
-        case ClassId::CAKE:
-            return "Cake";
-        case ClassId::CHAIR:
-            return "Chair";
-        case ClassId::COUCH:
-            return "Couch";
-        case ClassId::POTTED_PLANT:
-            return "Potted Plant";
-        case ClassId::BED:
-            return "Bed";
-        case ClassId::DINING_TABLE:
-            return "Dining Table";
-        case ClassId::TOILET:
-            return "Toilet";
-        case ClassId::TV:
-            return "TV";
-        case ClassId::LAPTOP:
-            return "Laptop";
-        case ClassId::MOUSE:
-            return "Mouse";
-        case ClassId::REMOTE:
-            return "Remote";
-        case ClassId::KEYBOARD:
-            return "Keyboard";
-        case ClassId::CELL_PHONE:
-            return "Cell Phone";
-        case ClassId::MICROWAVE:
-            return "Microwave";
-        case ClassId::OVEN:
-            return "Oven";
-        case ClassId::TOASTER:
-            return "Toaster";
-        case ClassId::SINK:
-            return "Sink";
-        case ClassId::REFRIGERATOR:
-            return "Refrigerator";
-        case ClassId::BOOK:
-            return "Book";
-        case ClassId::CLOCK:
-            return "Clock";
-        case ClassId::VASE:
-            return "Vase";
-        case ClassId::SCISSORS:
-            return "Scissors";
-        case ClassId::TEDDY_BEAR:
-            return "Teddy Bear";
-        case ClassId::HAIR_DRIER:
-            return "Hair Drier";
-        case ClassId::TOOTHBRUSH:
-            return "Toothbrush";
-        default:
-            return "Unknown";
-        }
+        const int index = static_cast<int>(id);
+        return (index >= 0 && index < kClassCount) ? kNames[index] : std::string_view{"Unknown"};
     }
+
+private:
+    static constexpr int kClassCount = 80;
+    static constexpr std::string_view kNames[kClassCount] = {
+        "Person",
+        "Bicycle",
+        "Car",
+        "Motorcycle",
+        "Airplane",
+        "Bus",
+        "Train",
+        "Truck",
+        "Boat",
+        "Traffic Light",
+        "Fire Hydrant",
+        "Stop Sign",
+        "Parking Meter",
+        "Bench",
+        "Bird",
+        "Cat",
+        "Dog",
+        "Horse",
+        "Sheep",
+        "Cow",
+        "Elephant",
+        "Bear",
+        "Zebra",
+        "Giraffe",
+        "Backpack",
+        "Umbrella",
+        "Handbag",
+        "Tie",
+        "Suitcase",
+        "Frisbee",
+        "Skis",
+        "Snowboard",
+        "Sports Ball",
+        "Kite",
+        "Baseball Bat",
+        "Baseball Glove",
+        "Skateboard",
+        "Surfboard",
+        "Tennis Racket",
+        "Bottle",
+        "Wine Glass",
+        "Cup",
+        "Fork",
+        "Knife",
+        "Spoon",
+        "Bowl",
+        "Banana",
+        "Apple",
+        "Sandwich",
+        "Orange",
+        "Broccoli",
+        "Carrot",
+        "Hot Dog",
+        "Pizza",
+        "Donut",
+        "Cake",
+        "Chair",
+        "Couch",
+        "Potted Plant",
+        "Bed",
+        "Dining Table",
+        "Toilet",
+        "TV",
+        "Laptop",
+        "Mouse",
+        "Remote",
+        "Keyboard",
+        "Cell Phone",
+        "Microwave",
+        "Oven",
+        "Toaster",
+        "Sink",
+        "Refrigerator",
+        "Book",
+        "Clock",
+        "Vase",
+        "Scissors",
+        "Teddy Bear",
+        "Hair Drier",
+        "Toothbrush",
+    };
 };
 
 struct BoundingBox
@@ -285,10 +209,16 @@ struct BoundingBox
 
 struct Detection
 {
-    ClassId class_id;  // YOLO Class ID (0: person, etc.)
-    float confidence;  // 신뢰도 (0.0 ~ 1.0)
-    BoundingBox bbox;  // 위치 정보
-    std::string label; // (Optional) "person", "car" 등 디버깅용
+    ClassId class_id;        // YOLO Class ID (0: person, etc.)
+    float confidence;        // 신뢰도 (0.0 ~ 1.0)
+    BoundingBox bbox;        // 위치 정보
+    int32_t track_id = -1;   // 추적 ID (-1: 추적기를 거치지 않은 탐지 결과)
+    float velocity_x = 0.0f; // 화면상 중심 이동 속도 (px/s, 추적 결과에서만 유효)
+    float velocity_y = 0.0f;
+    uint8_t model = 0;       // 탐지한 모델 (ModelRegistry 등록 순서, 단일 모델이면 0)
 };
 
+// 스레드 간 복사/전달 시 할당이 없도록 POD 로 유지 (라벨은 ClassIdHelper::toString)
+static_assert(std::is_trivially_copyable_v<Detection>, "Detection must stay trivially copyable");
+
 } // namespace vp::domain::model
\ No newline at end of file
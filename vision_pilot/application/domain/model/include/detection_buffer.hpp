@@ -0,0 +1,88 @@
+#pragma once
+#include "detection.hpp"
+#include <array>
+#include <cstddef>
+
+namespace vp::domain::model
+{
+
+/**
+ * @brief 고정 용량 탐지 결과 버퍼
+ *
+ * 매 프레임 렌더링/스레드 간 전달 시 힙 할당이 없도록 결과를 내부 배열에 담는다.
+ * 복사는 사용 중인 원소만 복사하며, 용량을 넘는 결과는 버리고 truncated() 로 알린다.
+ * (여러 모델 병합 결과 등 용량을 넘을 수 있는 입력은 호출 측에서 확인해 기록)
+ */
+class DetectionBuffer
+{
+public:
+    static constexpr size_t kCapacity = 300; // YOLOv8 기본 max_det
+
+    DetectionBuffer() = default;
+    DetectionBuffer(const DetectionBuffer &other)
+    {
+        this->assign(other.begin(), other.end());
+        truncated_ = other.truncated_;
+    }
+    DetectionBuffer &operator=(const DetectionBuffer &other)
+    {
+        if (this != &other)
+        {
+            this->assign(other.begin(), other.end());
+            truncated_ = other.truncated_;
+        }
+        return *this;
+    }
+
+    // 반환: false 이면 용량을 넘는 뒤쪽 결과를 버림
+    template <typename Iterator>
+    bool assign(Iterator first, Iterator last)
+    {
+        size_ = 0;
+        for (; first != last && size_ < kCapacity; ++first)
+        {
+            items_[size_++] = *first;
+        }
+        truncated_ = first != last;
+        return !truncated_;
+    }
+
+    // 반환: false 이면 용량 초과로 버려짐
+    bool push_back(const Detection &detection)
+    {
+        if (size_ >= kCapacity)
+        {
+            truncated_ = true;
+            return false;
+        }
+        items_[size_++] = detection;
+        return true;
+    }
+
+    void clear()
+    {
+        size_ = 0;
+        truncated_ = false;
+    }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    // 마지막 clear/assign 이후 용량 초과로 버린 결과가 있음
+    bool truncated() const { return truncated_; }
+    static constexpr size_t capacity() { return kCapacity; }
+
+    Detection &operator[](size_t index) { return items_[index]; }
+    const Detection &operator[](size_t index) const { return items_[index]; }
+    const Detection &front() const { return items_[0]; }
+
+    Detection *begin() { return items_.data(); }
+    Detection *end() { return items_.data() + size_; }
+    const Detection *begin() const { return items_.data(); }
+    const Detection *end() const { return items_.data() + size_; }
+
+private:
+    std::array<Detection, kCapacity> items_{};
+    size_t size_ = 0;
+    bool truncated_ = false;
+};
+
+} // namespace vp::domain::model
@@ -0,0 +1,22 @@
+#pragma once
+#include "detection.hpp"
+#include "pose.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace vp::domain::model
+{
+
+// 프레임 1장에 대한 파이프라인 처리 결과 (BATCH/DETERMINISTIC 모드 결과 출력용)
+struct FrameResult
+{
+    uint64_t frame_id = 0;
+    uint64_t timestamp = 0; // 프레임 시각 (us). 소스 기준 시각이라 읽는 속도와 무관하게 실행 간 같음
+    Pose pose;
+    std::vector<Detection> detections;
+    bool detected = true;         // false: 탐지 대상 프레임이 아님 (DETERMINISTIC 모드 stride)
+    uint64_t localization_us = 0; // 위치 추정 소요 시간
+    uint64_t detection_us = 0;    // 객체 탐지 소요 시간
+};
+
+} // namespace vp::domain::model
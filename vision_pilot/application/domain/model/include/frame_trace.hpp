@@ -0,0 +1,60 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace vp::domain::model
+{
+
+/**
+ * @brief 프레임이 파이프라인을 통과하며 기록하는 타임스탬프 지점
+ */
+enum class TracePoint : uint8_t
+{
+    CAPTURED = 0,       // 로더에서 프레임 생성
+    ENQUEUED,           // EventQueue push 직전
+    DEQUEUED,           // EventRouter pop 직후
+    LOCALIZATION_BEGIN, // LocalizationPort::update 호출 전
+    LOCALIZATION_END,   // LocalizationPort::update 반환 후
+    DETECTION_QUEUED,   // 탐지 스레드로 전달
+    DETECTION_BEGIN,    // ObjectDetectionPort::detectObject 호출 전
+    DETECTION_END,      // ObjectDetectionPort::detectObject 반환 후
+    RENDER_BEGIN,       // VisualizationPort::render 호출 전
+    RENDER_END,         // VisualizationPort::render 반환 후
+    COUNT
+};
+
+/**
+ * @brief 단조 증가 시계(steady_clock) 기준 단계별 타임스탬프 (ns, 0: 미기록)
+ */
+struct FrameTrace
+{
+    std::array<uint64_t, static_cast<std::size_t>(TracePoint::COUNT)> stamps_ns{};
+
+    static uint64_t nowNs()
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::steady_clock::now().time_since_epoch())
+                                         .count());
+    }
+
+    void mark(TracePoint point) { stamps_ns.at(static_cast<std::size_t>(point)) = nowNs(); }
+    void mark(TracePoint point, uint64_t stamp_ns) { stamps_ns.at(static_cast<std::size_t>(point)) = stamp_ns; }
+
+    uint64_t at(TracePoint point) const { return stamps_ns.at(static_cast<std::size_t>(point)); }
+    bool has(TracePoint point) const { return at(point) != 0; }
+
+    // 두 지점 사이 경과 시간 (us). 어느 한쪽이라도 미기록이면 false
+    bool elapsedUs(TracePoint from, TracePoint to, uint64_t &out_us) const
+    {
+        if (!has(from) || !has(to) || at(to) < at(from))
+        {
+            return false;
+        }
+        out_us = (at(to) - at(from)) / 1000;
+        return true;
+    }
+};
+
+} // namespace vp::domain::model
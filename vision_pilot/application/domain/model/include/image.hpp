@@ -1,4 +1,5 @@
 #pragma once
+#include "frame_trace.hpp"
 #include <cstdint>
 #include <variant>
 #include <vector>
@@ -48,9 +49,13 @@ struct ImagePacket
     ImageEncoding encoding = ImageEncoding::BGR8;
     uint64_t frame_id = 0;
     uint64_t timestamp = 0;
+    uint64_t source_time = 0; // 소스 기준 시각 (ms). 파일/프레임셋은 영상 내 위치라 읽는 속도와 무관
 
     // variant를 통해 타입 안전성 확보
     std::variant<MonoImagePacket, StereoImagePacket> payload;
+
+    // 파이프라인 단계별 타임스탬프 (지연 시간 측정용)
+    FrameTrace trace;
 };
 
 } // namespace vp::domain::model
\ No newline at end of file
@@ -0,0 +1,32 @@
+#pragma once
+#include "detection.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace vp::domain::model
+{
+
+struct Keypoint
+{
+    float x = 0.0f; // 원본 이미지 좌표
+    float y = 0.0f;
+    float score = 1.0f; // 가시성 점수 (모델이 제공하지 않으면 1.0)
+};
+
+// 인스턴스 마스크. 박스 주변 영역만 모델 마스크 해상도(입력의 1/4)로 보관하며, region 위에 늘려서 사용
+struct InstanceMask
+{
+    BoundingBox region{}; // 마스크가 덮는 원본 이미지 영역 (Top-Left 기준)
+    int width = 0;        // 마스크 픽셀 수
+    int height = 0;
+    std::vector<uint8_t> data; // width * height, 0 또는 255
+};
+
+// 세그멘테이션/포즈 모델의 박스별 추가 결과 (Detection 과 같은 순서)
+struct InstanceResult
+{
+    InstanceMask mask;               // SEGMENT 모델만
+    std::vector<Keypoint> keypoints; // POSE 모델만
+};
+
+} // namespace vp::domain::model
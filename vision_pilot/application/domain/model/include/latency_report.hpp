@@ -0,0 +1,63 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace vp::domain::model
+{
+
+/**
+ * @brief 지연 시간 통계를 집계하는 파이프라인 구간
+ */
+enum class PipelineStage : uint8_t
+{
+    QUEUE = 0,      // ENQUEUED -> DEQUEUED
+    LOCALIZATION,   // LOCALIZATION_BEGIN -> LOCALIZATION_END
+    DETECTION_WAIT, // DETECTION_QUEUED -> DETECTION_BEGIN
+    DETECTION,      // DETECTION_BEGIN -> DETECTION_END
+    RENDER,         // RENDER_BEGIN -> RENDER_END
+    END_TO_END,     // CAPTURED (없으면 LOCALIZATION_BEGIN) -> RENDER_END
+    COUNT
+};
+
+constexpr std::size_t kPipelineStageCount = static_cast<std::size_t>(PipelineStage::COUNT);
+
+inline const char *toString(PipelineStage stage)
+{
+    switch (stage)
+    {
+    case PipelineStage::QUEUE:
+        return "queue";
+    case PipelineStage::LOCALIZATION:
+        return "localization";
+    case PipelineStage::DETECTION_WAIT:
+        return "detection_wait";
+    case PipelineStage::DETECTION:
+        return "detection";
+    case PipelineStage::RENDER:
+        return "render";
+    case PipelineStage::END_TO_END:
+        return "end_to_end";
+    default:
+        return "unknown";
+    }
+}
+
+struct StageLatency
+{
+    uint64_t count = 0;
+    double mean_ms = 0.0;
+    double p50_ms = 0.0;
+    double p95_ms = 0.0;
+    double p99_ms = 0.0;
+    double max_ms = 0.0;
+};
+
+struct LatencyReport
+{
+    std::array<StageLatency, kPipelineStageCount> stages{};
+
+    const StageLatency &at(PipelineStage stage) const { return stages.at(static_cast<std::size_t>(stage)); }
+};
+
+} // namespace vp::domain::model
@@ -2,14 +2,91 @@
 
 #include "detection.hpp"
 #include "image.hpp"
+#include "instance.hpp"
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
 #include <vector>
 
 namespace vp::port::out
 {
+
+// 탐지 품질 단계 (부하에 따라 서비스가 선택)
+enum class DetectionLevel
+{
+    FULL = 0, // 기본 모델/해상도
+    REDUCED   // 경량 모델 또는 저해상도 입력
+};
+
+// 비동기 탐지 결과 전달. frame_id: 요청 이미지의 frame_id
+using DetectionCallback = std::function<void(uint64_t frame_id, std::vector<vp::domain::model::Detection> detections)>;
+
 class ObjectDetectionPort
 {
 public:
     virtual ~ObjectDetectionPort() = default;
     virtual std::vector<vp::domain::model::Detection> detectObject(const vp::domain::model::ImagePacket &image) = 0;
+
+    // 경량 탐지를 지원하지 않는 어댑터는 항상 기본 탐지를 수행
+    virtual std::vector<vp::domain::model::Detection> detectObject(const vp::domain::model::ImagePacket &image, DetectionLevel /* level */)
+    {
+        return detectObject(image);
+    }
+
+    // level 탐지가 FULL 과 다르게 (더 가볍게) 실행되는지. false 인 단계는 FULL 과 같이 처리됨 (초기화 이후 호출)
+    virtual bool supportsLevel(DetectionLevel level) const
+    {
+        return level == DetectionLevel::FULL;
+    }
+
+    // 이미지 안의 regions(원본 좌표, Top-Left 기준) 주변만 탐지 (이전 탐지 결과 주변 재탐지용)
+    // 영역 탐지를 지원하지 않는 어댑터는 전체 프레임을 탐지
+    virtual std::vector<vp::domain::model::Detection> detectObjectInRegions(const vp::domain::model::ImagePacket &image,
+                                                                            const std::vector<vp::domain::model::BoundingBox> & /* regions */,
+                                                                            DetectionLevel level)
+    {
+        return detectObject(image, level);
+    }
+
+    // 세그멘테이션/포즈 모델의 마스크/키포인트까지 탐지. instances 는 반환 결과와 같은 순서
+    // 해당 출력을 지원하지 않는 어댑터는 박스만 탐지하고 instances 를 비움
+    virtual std::vector<vp::domain::model::Detection> detectInstances(const vp::domain::model::ImagePacket &image, DetectionLevel level,
+                                                                      std::vector<vp::domain::model::InstanceResult> &instances)
+    {
+        instances.clear();
+        return detectObject(image, level);
+    }
+
+    // 여러 이미지를 한 번에 탐지 (다중 카메라, 오프라인 처리). 결과는 images 와 같은 순서
+    // 배치 추론을 지원하지 않는 어댑터는 한 장씩 탐지
+    virtual std::vector<std::vector<vp::domain::model::Detection>> detectObjects(const std::vector<const vp::domain::model::ImagePacket *> &images, DetectionLevel level)
+    {
+        std::vector<std::vector<vp::domain::model::Detection>> results;
+        results.reserve(images.size());
+        for (const auto *image : images)
+        {
+            results.push_back(detectObject(*image, level));
+        }
+        return results;
+    }
+
+    // 탐지를 요청하고 바로 반환. 결과는 요청 순서대로 callback 으로 전달 (어댑터 내부 스레드에서 호출될 수 있음)
+    // image 는 호출 중에 복사되므로 반환 후 재사용해도 됨. callback 안에서 다시 요청하며 대기하면 안 됨
+    // 비동기 탐지를 지원하지 않는 어댑터는 호출 스레드에서 탐지한 뒤 callback 호출
+    virtual void submitDetection(const vp::domain::model::ImagePacket &image, DetectionLevel level, DetectionCallback callback)
+    {
+        callback(image.frame_id, detectObject(image, level));
+    }
+
+    // submitDetection 의 future 형태
+    std::future<std::vector<vp::domain::model::Detection>> detectObjectAsync(const vp::domain::model::ImagePacket &image, DetectionLevel level)
+    {
+        auto promise = std::make_shared<std::promise<std::vector<vp::domain::model::Detection>>>();
+        auto future = promise->get_future();
+        submitDetection(image, level, [promise](uint64_t, std::vector<vp::domain::model::Detection> detections)
+                        { promise->set_value(std::move(detections)); });
+        return future;
+    }
 };
 } // namespace vp::port::out
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "frame_result.hpp"
+
+namespace vp::port::out
+{
+
+class ResultSinkPort
+{
+public:
+    virtual ~ResultSinkPort() = default;
+
+    // 프레임 처리 결과 전달. 서비스는 frame_id 오름차순으로 호출한다
+    virtual void publish(const domain::model::FrameResult &result) = 0;
+
+    // 버퍼링된 결과를 저장소에 반영
+    virtual void flush() {}
+};
+
+} // namespace vp::port::out
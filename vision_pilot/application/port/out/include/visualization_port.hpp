@@ -1,5 +1,5 @@
 #pragma once
-#include "detection.hpp"
+#include "detection_buffer.hpp"
 #include "image.hpp"
 #include "pose.hpp"
 
@@ -11,7 +11,7 @@ class VisualizationPort
 public:
     virtual ~VisualizationPort() = default;
 
-    virtual void render(const domain::model::Pose &pose, std::vector<domain::model::Detection> detections, const domain::model::ImagePacket &frame) = 0;
+    virtual void render(const domain::model::Pose &pose, const domain::model::DetectionBuffer &detections, const domain::model::ImagePacket &frame) = 0;
 };
 
 } // namespace vp::port::out
\ No newline at end of file
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "localization_port.hpp"
+#include "object_detection_port.hpp"
+#include "result_sink_port.hpp"
+#include "visualization_port.hpp"
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+// 외부 라이브러리(SLAM, DNN, 뷰어) 없이 서비스 동작을 검증하기 위한 테스트용 포트
+namespace vp::service::test
+{
+
+// frame_id 를 x 좌표에 담은 포즈 반환
+class FakeLocalization : public vp::port::out::LocalizationPort
+{
+public:
+    domain::model::Pose update(const domain::model::ImagePacket &image, uint64_t timestamp) override
+    {
+        domain::model::Pose pose{static_cast<double>(image.frame_id), 0.0, 0.0, 1.0, 0.0, 0.0, 0.0};
+        pose.timestamp = timestamp;
+        pose.is_lost = false;
+        return pose;
+    }
+};
+
+// 렌더링 시점에 전달된 탐지 결과의 출처(frame_id)를 기록. 탐지 결과가 없으면 0
+class FakeVisualization : public vp::port::out::VisualizationPort
+{
+public:
+    void render(const domain::model::Pose & /* pose */, const domain::model::DetectionBuffer &detections, const domain::model::ImagePacket & /* frame */) override
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        rendered_sources.push_back(detections.empty() ? 0 : static_cast<uint64_t>(detections.front().confidence));
+    }
+
+    std::mutex mutex;
+    std::vector<uint64_t> rendered_sources;
+};
+
+// frame_id 를 confidence 에 담아 어떤 프레임의 결과인지 확인. max_delay_ms > 0 이면 임의 지연으로 스레드 타이밍을 흔듦
+class FakeDetection : public vp::port::out::ObjectDetectionPort
+{
+public:
+    explicit FakeDetection(int max_delay_ms = 1, uint32_t seed = 0)
+        : max_delay_ms_{max_delay_ms}, rng_{seed} {}
+
+    std::vector<domain::model::Detection> detectObject(const domain::model::ImagePacket &image) override
+    {
+        if (max_delay_ms_ > 0)
+        {
+            std::uniform_int_distribution<int> dist(0, max_delay_ms_);
+            std::this_thread::sleep_for(std::chrono::milliseconds(dist(rng_)));
+        }
+        ++detect_count;
+        return {{domain::model::ClassId::CAR, static_cast<float>(image.frame_id), {0.0f, 0.0f, 1.0f, 1.0f}}};
+    }
+
+    std::vector<std::vector<domain::model::Detection>> detectObjects(const std::vector<const domain::model::ImagePacket *> &images, vp::port::out::DetectionLevel level) override
+    {
+        const int size = static_cast<int>(images.size());
+        if (size > max_batch_size)
+        {
+            max_batch_size = size;
+        }
+        return ObjectDetectionPort::detectObjects(images, level);
+    }
+
+    std::atomic<int> detect_count{0};
+    std::atomic<int> max_batch_size{0}; // detectObjects 로 받은 최대 이미지 수
+
+private:
+    int max_delay_ms_;
+    std::mt19937 rng_;
+};
+
+// submitDetection 을 요청마다 별도 스레드에서 처리 (완료 순서는 요청 순서와 다를 수 있음). 동시에 진행 중인 최대 요청 수를 기록
+class FakeAsyncDetection : public FakeDetection
+{
+public:
+    explicit FakeAsyncDetection(int delay_ms = 2) : FakeDetection{0}, delay_ms_{delay_ms} {}
+    ~FakeAsyncDetection() override
+    {
+        std::lock_guard<std::mutex> lock(tasks_mutex_);
+        tasks_.clear(); // std::async future 소멸 시 작업 완료 대기
+    }
+
+    void submitDetection(const domain::model::ImagePacket &image, vp::port::out::DetectionLevel /* level */, vp::port::out::DetectionCallback callback) override
+    {
+        const int current = ++in_flight;
+        int previous = max_in_flight.load();
+        while (previous < current && !max_in_flight.compare_exchange_weak(previous, current))
+        {
+        }
+
+        std::lock_guard<std::mutex> lock(tasks_mutex_);
+        tasks_.push_back(std::async(std::launch::async, [this, image, callback = std::move(callback)]
+                                    {
+            std::this_thread::sleep_for(std::chrono::milliseconds(delay_ms_));
+            auto detections = detectObject(image);
+            --in_flight;
+            callback(image.frame_id, std::move(detections)); }));
+    }
+
+    std::atomic<int> in_flight{0};
+    std::atomic<int> max_in_flight{0};
+
+private:
+    int delay_ms_;
+    std::mutex tasks_mutex_;
+    std::vector<std::future<void>> tasks_;
+};
+
+class RecordingSink : public vp::port::out::ResultSinkPort
+{
+public:
+    void publish(const domain::model::FrameResult &result) override
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        results.push_back(result);
+    }
+
+    void flush() override
+    {
+        ++flush_count;
+    }
+
+    std::mutex mutex;
+    std::vector<domain::model::FrameResult> results;
+    std::atomic<int> flush_count{0};
+};
+
+inline domain::model::ImagePacket makeFrame(uint64_t frame_id)
+{
+    domain::model::ImagePacket packet;
+    packet.frame_id = frame_id;
+    packet.timestamp = frame_id * 33;
+    packet.source_time = frame_id * 33;
+    return packet;
+}
+
+} // namespace vp::service::test
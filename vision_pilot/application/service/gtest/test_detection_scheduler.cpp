@@ -0,0 +1,138 @@
+#include "detection_scheduler.hpp"
+#include <gtest/gtest.h>
+
+namespace vp::service
+{
+using vp::port::out::DetectionLevel;
+
+class DetectionSchedulerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        config_.enable = true;
+        config_.targetHz = 10.0; // 100ms 주기
+        config_.latencyBudgetMs = 50.0;
+        config_.maxDutyCycle = 0.5;
+        config_.ewmaAlpha = 1.0; // 최신 측정값을 그대로 사용
+        config_.allowReduced = true;
+        config_.probeInterval = 3;
+    }
+
+    static constexpr uint64_t kMs = 1000;
+
+    config::DetectionSchedulerConfig config_;
+};
+
+TEST_F(DetectionSchedulerTest, DisabledSchedulerAlwaysDetects)
+{
+    config_.enable = false;
+    DetectionScheduler scheduler{config_};
+
+    for (uint64_t t = 0; t < 10; ++t)
+    {
+        auto decision = scheduler.decide(t * kMs, true);
+        EXPECT_EQ(decision.action, DetectionAction::DETECT);
+        EXPECT_EQ(decision.level, DetectionLevel::FULL);
+    }
+}
+
+TEST_F(DetectionSchedulerTest, ShouldLimitDetectionRateToTargetHz)
+{
+    DetectionScheduler scheduler{config_};
+
+    int detect_count = 0;
+    // 30Hz 입력 1초
+    for (uint64_t i = 0; i < 30; ++i)
+    {
+        auto now = i * 33 * kMs;
+        auto decision = scheduler.decide(now, false);
+        if (decision.action == DetectionAction::DETECT)
+        {
+            ++detect_count;
+            scheduler.reportInference(decision.level, 10 * kMs);
+        }
+    }
+
+    EXPECT_EQ(detect_count, 10);
+}
+
+TEST_F(DetectionSchedulerTest, ShouldSkipWhileDetectorIsBusy)
+{
+    DetectionScheduler scheduler{config_};
+
+    EXPECT_EQ(scheduler.decide(0, true).action, DetectionAction::SKIP);
+    EXPECT_EQ(scheduler.decide(0, false).action, DetectionAction::DETECT);
+}
+
+TEST_F(DetectionSchedulerTest, ShouldSwitchToReducedWhenOverBudget)
+{
+    DetectionScheduler scheduler{config_};
+
+    auto decision = scheduler.decide(0, false);
+    ASSERT_EQ(decision.level, DetectionLevel::FULL);
+    scheduler.reportInference(decision.level, 80 * kMs); // 예산(50ms) 초과
+
+    decision = scheduler.decide(1000 * kMs, false);
+    EXPECT_EQ(decision.action, DetectionAction::DETECT);
+    EXPECT_EQ(decision.level, DetectionLevel::REDUCED);
+}
+
+TEST_F(DetectionSchedulerTest, ShouldStayFullWhenReducedIsNotSupported)
+{
+    DetectionScheduler scheduler{config_, false};
+
+    auto decision = scheduler.decide(0, false);
+    scheduler.reportInference(decision.level, 80 * kMs); // 예산(50ms) 초과
+    for (uint64_t i = 1; i <= 4; ++i)
+    {
+        decision = scheduler.decide(i * 1000 * kMs, false);
+        EXPECT_EQ(decision.action, DetectionAction::DETECT);
+        EXPECT_EQ(decision.level, DetectionLevel::FULL);
+        scheduler.reportInference(decision.level, 80 * kMs);
+    }
+}
+
+TEST_F(DetectionSchedulerTest, ShouldProbeFullLevelPeriodically)
+{
+    DetectionScheduler scheduler{config_};
+    scheduler.reportInference(DetectionLevel::FULL, 80 * kMs);
+    scheduler.reportInference(DetectionLevel::REDUCED, 20 * kMs);
+
+    int reduced_count = 0;
+    bool probed = false;
+    for (uint64_t i = 1; i <= 4; ++i)
+    {
+        auto decision = scheduler.decide(i * 1000 * kMs, false);
+        ASSERT_EQ(decision.action, DetectionAction::DETECT);
+        if (decision.level == DetectionLevel::REDUCED)
+        {
+            ++reduced_count;
+        }
+        else
+        {
+            probed = true;
+        }
+    }
+
+    EXPECT_EQ(reduced_count, 3);
+    EXPECT_TRUE(probed);
+}
+
+TEST_F(DetectionSchedulerTest, ShouldStretchPeriodWhenSlamIsBusy)
+{
+    config_.allowReduced = false;
+    DetectionScheduler scheduler{config_};
+    scheduler.reportInference(DetectionLevel::FULL, 40 * kMs);
+
+    // SLAM 여유: 듀티 0.5 기준 주기 = max(100ms, 40ms / 0.5) = 100ms
+    EXPECT_EQ(scheduler.effectivePeriodUs(), 100 * kMs);
+
+    // 프레임 간격 50ms 중 SLAM 이 40ms 사용 (부하 0.8) -> 듀티 0.1 -> 주기 400ms
+    for (uint64_t i = 0; i < 5; ++i)
+    {
+        scheduler.reportLocalization(i * 50 * kMs, 40 * kMs);
+    }
+    EXPECT_EQ(scheduler.effectivePeriodUs(), 400 * kMs);
+}
+} // namespace vp::service
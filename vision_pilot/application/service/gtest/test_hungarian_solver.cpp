@@ -0,0 +1,96 @@
+#include "hungarian_solver.hpp"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <random>
+
+namespace vp::service
+{
+namespace
+{
+float totalCost(const std::vector<float> &cost, int cols, const std::vector<int> &row_to_col)
+{
+    float total = 0.0f;
+    for (size_t r = 0; r < row_to_col.size(); ++r)
+    {
+        if (row_to_col[r] >= 0)
+        {
+            total += cost[r * cols + row_to_col[r]];
+        }
+    }
+    return total;
+}
+
+// 모든 순열을 비교하는 기준 구현 (rows <= cols)
+float bruteForceCost(const std::vector<float> &cost, int rows, int cols)
+{
+    std::vector<int> perm(cols);
+    std::iota(perm.begin(), perm.end(), 0);
+    float best = std::numeric_limits<float>::max();
+    do
+    {
+        float total = 0.0f;
+        for (int r = 0; r < rows; ++r)
+        {
+            total += cost[static_cast<size_t>(r) * cols + perm[r]];
+        }
+        best = std::min(best, total);
+    } while (std::next_permutation(perm.begin(), perm.end()));
+    return best;
+}
+} // namespace
+
+TEST(HungarianSolverTest, ShouldFindMinimumCostAssignment)
+{
+    const std::vector<float> cost = {4, 1, 3,
+                                     2, 0, 5,
+                                     3, 2, 2};
+    HungarianSolver solver;
+    std::vector<int> row_to_col;
+    solver.solve(cost, 3, 3, row_to_col);
+
+    ASSERT_EQ(row_to_col.size(), 3u);
+    EXPECT_EQ(row_to_col[0], 1);
+    EXPECT_EQ(row_to_col[1], 0);
+    EXPECT_EQ(row_to_col[2], 2);
+}
+
+TEST(HungarianSolverTest, ShouldMatchBruteForceOnRandomRectangularCosts)
+{
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    HungarianSolver solver;
+    std::vector<int> row_to_col;
+
+    for (int trial = 0; trial < 20; ++trial)
+    {
+        const int rows = 1 + trial % 4;
+        const int cols = rows + trial % 3;
+        std::vector<float> cost(static_cast<size_t>(rows) * cols);
+        std::generate(cost.begin(), cost.end(), [&]
+                      { return dist(rng); });
+
+        solver.solve(cost, rows, cols, row_to_col);
+
+        std::vector<int> used(cols, 0);
+        for (int c : row_to_col)
+        {
+            ASSERT_GE(c, 0);
+            EXPECT_EQ(used[c]++, 0);
+        }
+        EXPECT_NEAR(totalCost(cost, cols, row_to_col), bruteForceCost(cost, rows, cols), 1e-5f) << "trial " << trial;
+    }
+}
+
+TEST(HungarianSolverTest, ShouldLeaveExtraRowsUnassigned)
+{
+    const std::vector<float> cost = {0.9f,
+                                     0.1f,
+                                     0.5f};
+    HungarianSolver solver;
+    std::vector<int> row_to_col;
+    solver.solve(cost, 3, 1, row_to_col);
+
+    EXPECT_EQ(row_to_col, (std::vector<int>{-1, 0, -1}));
+}
+} // namespace vp::service
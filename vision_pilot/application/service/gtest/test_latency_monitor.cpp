@@ -0,0 +1,77 @@
+#include "latency_monitor.hpp"
+#include <gtest/gtest.h>
+
+namespace vp::service
+{
+using domain::model::PipelineStage;
+using domain::model::TracePoint;
+
+TEST(LatencyHistogramTest, EmptyHistogramReportsZero)
+{
+    LatencyHistogram histogram;
+
+    auto summary = histogram.summarize();
+    EXPECT_EQ(summary.count, 0U);
+    EXPECT_DOUBLE_EQ(summary.p99_ms, 0.0);
+}
+
+TEST(LatencyHistogramTest, PercentilesWithinBucketError)
+{
+    LatencyHistogram histogram;
+    for (uint64_t i = 1; i <= 1000; ++i)
+    {
+        histogram.record(i * 100); // 0.1ms ~ 100ms 균등 분포
+    }
+
+    auto summary = histogram.summarize();
+    EXPECT_EQ(summary.count, 1000U);
+    EXPECT_NEAR(summary.p50_ms, 50.0, 50.0 * 0.07);
+    EXPECT_NEAR(summary.p95_ms, 95.0, 95.0 * 0.07);
+    EXPECT_NEAR(summary.p99_ms, 99.0, 99.0 * 0.07);
+    EXPECT_DOUBLE_EQ(summary.max_ms, 100.0);
+    EXPECT_NEAR(summary.mean_ms, 50.05, 1e-9);
+}
+
+TEST(LatencyHistogramTest, MergeAccumulatesCounts)
+{
+    LatencyHistogram a;
+    LatencyHistogram b;
+    a.record(10);
+    b.record(20);
+    b.record(5000000000ULL); // 상한 초과 값도 기록 가능
+
+    a.merge(b);
+    EXPECT_EQ(a.count(), 3U);
+    EXPECT_DOUBLE_EQ(a.summarize().max_ms, 5000000.0);
+}
+
+TEST(LatencyMonitorTest, RecordsStagesFromFrameTrace)
+{
+    LatencyMonitor monitor{0};
+
+    domain::model::FrameTrace trace;
+    trace.mark(TracePoint::LOCALIZATION_BEGIN, 1000000);
+    trace.mark(TracePoint::LOCALIZATION_END, 3000000);
+    trace.mark(TracePoint::RENDER_BEGIN, 4000000);
+
+    monitor.record(PipelineStage::LOCALIZATION, trace, TracePoint::LOCALIZATION_BEGIN, TracePoint::LOCALIZATION_END);
+    monitor.record(PipelineStage::RENDER, trace, TracePoint::RENDER_BEGIN, TracePoint::RENDER_END); // 미기록 -> 무시
+
+    auto report = monitor.report();
+    EXPECT_EQ(report.at(PipelineStage::LOCALIZATION).count, 1U);
+    EXPECT_DOUBLE_EQ(report.at(PipelineStage::LOCALIZATION).max_ms, 2.0);
+    EXPECT_EQ(report.at(PipelineStage::RENDER).count, 0U);
+}
+
+TEST(LatencyMonitorTest, ReportIncludesLoggedWindows)
+{
+    LatencyMonitor monitor{1};
+    monitor.logIfDue(1);
+
+    monitor.record(PipelineStage::DETECTION, 1000);
+    monitor.logIfDue(2000000); // 구간 통계가 누적 통계로 이동
+    monitor.record(PipelineStage::DETECTION, 3000);
+
+    EXPECT_EQ(monitor.report().at(PipelineStage::DETECTION).count, 2U);
+}
+} // namespace vp::service
@@ -0,0 +1,131 @@
+#include "object_tracker.hpp"
+#include <gtest/gtest.h>
+
+namespace vp::service
+{
+class ObjectTrackerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        config_.enable = true;
+        config_.highScoreThreshold = 0.5f;
+        config_.newTrackThreshold = 0.6f;
+        config_.matchIou = 0.3f;
+        config_.minHits = 2;
+        config_.maxAgeMs = 300;
+    }
+
+    static domain::model::Detection makeDetection(float x, float y, float confidence = 0.9f,
+                                                  domain::model::ClassId class_id = domain::model::ClassId::CAR)
+    {
+        return {class_id, confidence, {x, y, 50.0f, 40.0f}};
+    }
+
+    config::TrackerConfig config_;
+};
+
+TEST_F(ObjectTrackerTest, ShouldKeepTrackIdAndEstimateVelocity)
+{
+    ObjectTracker tracker{config_};
+
+    // 100ms 마다 x 로 10px 이동 -> 100 px/s
+    EXPECT_TRUE(tracker.update({makeDetection(100.0f, 200.0f)}, 0).empty()); // minHits 미만
+    domain::model::DetectionBuffer tracks;
+    for (uint64_t i = 1; i <= 10; ++i)
+    {
+        tracks = tracker.update({makeDetection(100.0f + 10.0f * i, 200.0f)}, i * 100);
+        ASSERT_EQ(tracks.size(), 1u);
+        EXPECT_EQ(tracks[0].track_id, 1);
+    }
+    EXPECT_NEAR(tracks[0].velocity_x, 100.0f, 10.0f);
+    EXPECT_NEAR(tracks[0].velocity_y, 0.0f, 5.0f);
+    EXPECT_NEAR(tracks[0].bbox.x, 200.0f, 2.0f);
+}
+
+TEST_F(ObjectTrackerTest, ShouldPredictBoxesBetweenDetectionsUntilMaxAge)
+{
+    ObjectTracker tracker{config_};
+    for (uint64_t i = 0; i <= 10; ++i)
+    {
+        tracker.update({makeDetection(100.0f + 10.0f * i, 200.0f)}, i * 100);
+    }
+
+    // 탐지 없는 프레임: 등속 외삽 (상태는 바뀌지 않음)
+    domain::model::DetectionBuffer predicted;
+    tracker.predict(1050, predicted);
+    ASSERT_EQ(predicted.size(), 1u);
+    EXPECT_NEAR(predicted[0].bbox.x, 205.0f, 2.0f);
+    EXPECT_EQ(predicted[0].track_id, 1);
+
+    // 빈 탐지 결과가 와도 maxAgeMs 동안은 유지, 이후 제거
+    EXPECT_EQ(tracker.update({}, 1200).size(), 1u);
+    EXPECT_TRUE(tracker.update({}, 1400).empty());
+    EXPECT_EQ(tracker.trackCount(), 0u);
+}
+
+TEST_F(ObjectTrackerTest, ShouldAssignSeparateIdsAndKeepThemWhenCrossingOrder)
+{
+    ObjectTracker tracker{config_};
+    tracker.update({makeDetection(100.0f, 100.0f), makeDetection(400.0f, 100.0f)}, 0);
+    auto tracks = tracker.update({makeDetection(402.0f, 100.0f), makeDetection(103.0f, 100.0f)}, 100);
+
+    ASSERT_EQ(tracks.size(), 2u);
+    for (const auto &track : tracks)
+    {
+        EXPECT_EQ(track.track_id, track.bbox.x < 250.0f ? 1 : 2);
+    }
+}
+
+TEST_F(ObjectTrackerTest, ShouldMatchLowScoreDetectionsOnlyToExistingTracks)
+{
+    ObjectTracker tracker{config_};
+    tracker.update({makeDetection(100.0f, 100.0f)}, 0);
+    tracker.update({makeDetection(102.0f, 100.0f)}, 100);
+
+    // 가려져 점수가 낮아진 탐지는 기존 트랙을 갱신하지만 새 트랙을 만들지 않음
+    auto tracks = tracker.update({makeDetection(104.0f, 100.0f, 0.3f), makeDetection(500.0f, 300.0f, 0.3f)}, 200);
+    ASSERT_EQ(tracks.size(), 1u);
+    EXPECT_EQ(tracks[0].track_id, 1);
+    EXPECT_FLOAT_EQ(tracks[0].confidence, 0.3f);
+    EXPECT_EQ(tracker.trackCount(), 1u);
+}
+
+TEST_F(ObjectTrackerTest, ShouldNotMatchDifferentClasses)
+{
+    ObjectTracker tracker{config_};
+    tracker.update({makeDetection(100.0f, 100.0f)}, 0);
+    tracker.update({makeDetection(100.0f, 100.0f)}, 100);
+
+    auto tracks = tracker.update({makeDetection(100.0f, 100.0f, 0.9f, domain::model::ClassId::PERSON)}, 200);
+
+    // 기존 CAR 트랙은 예측으로 유지, PERSON 은 새 미확정 트랙
+    ASSERT_EQ(tracks.size(), 1u);
+    EXPECT_EQ(tracks[0].class_id, domain::model::ClassId::CAR);
+    EXPECT_EQ(tracker.trackCount(), 2u);
+}
+
+TEST_F(ObjectTrackerTest, ShouldReportTracksBeyondBufferCapacity)
+{
+    ObjectTracker tracker{config_};
+    constexpr size_t kCapacity = domain::model::DetectionBuffer::kCapacity;
+
+    // 겹치지 않는 탐지 kCapacity + 20 개 -> 트랙은 용량까지만 출력되고 잘림 표시
+    std::vector<domain::model::Detection> detections;
+    for (size_t i = 0; i < kCapacity + 20; ++i)
+    {
+        detections.push_back(makeDetection(60.0f * (i % 40), 50.0f * (i / 40)));
+    }
+    tracker.update(detections, 0);
+    const auto &tracks = tracker.update(detections, 100);
+    EXPECT_EQ(tracker.trackCount(), kCapacity + 20);
+    EXPECT_EQ(tracks.size(), kCapacity);
+    EXPECT_TRUE(tracks.truncated());
+
+    // 복사본도 잘림 표시를 유지하고, 용량 안으로 줄면 해제
+    const domain::model::DetectionBuffer copy = tracks;
+    EXPECT_TRUE(copy.truncated());
+    detections.resize(10);
+    EXPECT_FALSE(tracker.update(detections, 100 + config_.maxAgeMs + 100).truncated());
+}
+} // namespace vp::service
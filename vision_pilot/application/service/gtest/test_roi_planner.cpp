@@ -0,0 +1,137 @@
+#include "roi_planner.hpp"
+#include <cmath>
+#include <gtest/gtest.h>
+
+namespace vp::service
+{
+class RoiPlannerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        config_.enable = true;
+        config_.fullFrameInterval = 3;
+        config_.expandRatio = 0.25f;
+        config_.focalLengthPx = 500.0f;
+        config_.translationGain = 1.0f;
+        config_.maxRotationRad = 0.35f;
+        config_.minRoiSize = 96.0f;
+        config_.maxRois = 4;
+        config_.maxAreaRatio = 0.5f;
+    }
+
+    static domain::model::Pose makePose(double x, double yaw_rad)
+    {
+        domain::model::Pose pose{x, 0.0, 0.0, std::cos(0.5 * yaw_rad), 0.0, std::sin(0.5 * yaw_rad), 0.0};
+        pose.is_lost = false;
+        return pose;
+    }
+
+    static domain::model::Detection makeDetection(float x, float y, float w, float h)
+    {
+        return {domain::model::ClassId::CAR, 0.9f, {x, y, w, h}};
+    }
+
+    static constexpr int kWidth = 1280;
+    static constexpr int kHeight = 720;
+
+    config::RoiDetectionConfig config_;
+};
+
+TEST_F(RoiPlannerTest, ShouldDetectFullFrameWithoutPreviousResult)
+{
+    RoiPlanner planner{config_};
+
+    EXPECT_TRUE(planner.plan(makePose(0.0, 0.0), kWidth, kHeight).full_frame);
+
+    // 이전 탐지 결과가 비어도 전체 프레임
+    planner.update(makePose(0.0, 0.0), {}, true);
+    EXPECT_TRUE(planner.plan(makePose(0.0, 0.0), kWidth, kHeight).full_frame);
+}
+
+TEST_F(RoiPlannerTest, ShouldExpandPreviousBoxWhenStill)
+{
+    RoiPlanner planner{config_};
+    planner.update(makePose(0.0, 0.0), {makeDetection(400.0f, 300.0f, 200.0f, 100.0f)}, true);
+
+    const auto &plan = planner.plan(makePose(0.0, 0.0), kWidth, kHeight);
+
+    ASSERT_FALSE(plan.full_frame);
+    ASSERT_EQ(plan.regions.size(), 1u);
+    // 각 변으로 25% 확장: 가로 200 -> 300, 세로 100 -> 150 (중심 유지)
+    EXPECT_FLOAT_EQ(plan.regions[0].x, 350.0f);
+    EXPECT_FLOAT_EQ(plan.regions[0].y, 275.0f);
+    EXPECT_FLOAT_EQ(plan.regions[0].width, 300.0f);
+    EXPECT_FLOAT_EQ(plan.regions[0].height, 150.0f);
+}
+
+TEST_F(RoiPlannerTest, ShouldGrowRegionWithRotationAndFallBackWhenTooLarge)
+{
+    RoiPlanner planner{config_};
+    planner.update(makePose(0.0, 0.0), {makeDetection(600.0f, 300.0f, 40.0f, 40.0f)}, true);
+
+    // 0.1 rad 회전 -> 각 방향 50px 추가
+    const auto &plan = planner.plan(makePose(0.0, 0.1), kWidth, kHeight);
+    ASSERT_FALSE(plan.full_frame);
+    ASSERT_EQ(plan.regions.size(), 1u);
+    EXPECT_NEAR(plan.regions[0].width, 40.0f * 1.5f + 100.0f, 1e-3f);
+    EXPECT_NEAR(planner.rotationAngle(makePose(0.0, 0.0), makePose(0.0, 0.1)), 0.1, 1e-9);
+
+    EXPECT_TRUE(planner.plan(makePose(0.0, 0.5), kWidth, kHeight).full_frame);
+}
+
+TEST_F(RoiPlannerTest, ShouldMergeOverlappingRegionsAndClipToFrame)
+{
+    RoiPlanner planner{config_};
+    planner.update(makePose(0.0, 0.0),
+                   {makeDetection(100.0f, 100.0f, 100.0f, 100.0f), makeDetection(180.0f, 120.0f, 100.0f, 100.0f), makeDetection(1250.0f, 700.0f, 30.0f, 20.0f)},
+                   true);
+
+    const auto &plan = planner.plan(makePose(0.0, 0.0), kWidth, kHeight);
+
+    ASSERT_FALSE(plan.full_frame);
+    ASSERT_EQ(plan.regions.size(), 2u);
+    for (const auto &region : plan.regions)
+    {
+        EXPECT_GE(region.x, 0.0f);
+        EXPECT_GE(region.y, 0.0f);
+        EXPECT_LE(region.x + region.width, static_cast<float>(kWidth));
+        EXPECT_LE(region.y + region.height, static_cast<float>(kHeight));
+        EXPECT_GE(region.width, config_.minRoiSize);
+        EXPECT_GE(region.height, config_.minRoiSize);
+    }
+}
+
+TEST_F(RoiPlannerTest, ShouldDetectFullFramePeriodicallyAndWhenPoseLost)
+{
+    RoiPlanner planner{config_};
+    const std::vector<domain::model::Detection> detections = {makeDetection(400.0f, 300.0f, 50.0f, 50.0f)};
+    planner.update(makePose(0.0, 0.0), detections, true);
+
+    for (uint32_t i = 0; i < config_.fullFrameInterval; ++i)
+    {
+        const bool full_frame = planner.plan(makePose(0.0, 0.0), kWidth, kHeight).full_frame;
+        EXPECT_FALSE(full_frame) << i;
+        planner.update(makePose(0.0, 0.0), detections, full_frame);
+    }
+    EXPECT_TRUE(planner.plan(makePose(0.0, 0.0), kWidth, kHeight).full_frame);
+    planner.update(makePose(0.0, 0.0), detections, true);
+
+    auto lost = makePose(0.0, 0.0);
+    lost.is_lost = true;
+    EXPECT_TRUE(planner.plan(lost, kWidth, kHeight).full_frame);
+}
+
+TEST_F(RoiPlannerTest, ShouldDetectFullFrameWhenTooManyRegions)
+{
+    RoiPlanner planner{config_};
+    std::vector<domain::model::Detection> detections;
+    for (int i = 0; i < 5; ++i)
+    {
+        detections.push_back(makeDetection(50.0f + 240.0f * i, 300.0f, 20.0f, 20.0f));
+    }
+    planner.update(makePose(0.0, 0.0), detections, true);
+
+    EXPECT_TRUE(planner.plan(makePose(0.0, 0.0), kWidth, kHeight).full_frame);
+}
+} // namespace vp::service
@@ -0,0 +1,145 @@
+#include "fake_ports.hpp"
+#include "vision_pilot_service.hpp"
+#include <gtest/gtest.h>
+
+namespace vp::service
+{
+using test::FakeAsyncDetection;
+using test::FakeDetection;
+using test::FakeLocalization;
+using test::FakeVisualization;
+using test::makeFrame;
+using test::RecordingSink;
+
+class VisionPilotServiceBatchTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        config_.processingMode = config::ProcessingMode::BATCH;
+        config_.batchQueueSize = 2;
+        config_.latencyLogIntervalMs = 0;
+    }
+
+    config::VisionPilotServiceConfig config_;
+    FakeLocalization localization_;
+    FakeVisualization visualization_;
+    FakeDetection detection_;
+    RecordingSink sink_;
+};
+
+TEST_F(VisionPilotServiceBatchTest, ProcessesEveryFrameInOrder)
+{
+    constexpr uint64_t kFrameCount = 50;
+    VisionPilotService service{localization_, visualization_, detection_, config_, &sink_};
+
+    for (uint64_t id = 1; id <= kFrameCount; ++id)
+    {
+        service.onFrameReceived(makeFrame(id));
+    }
+    service.flush();
+
+    ASSERT_EQ(sink_.results.size(), kFrameCount);
+    for (uint64_t i = 0; i < kFrameCount; ++i)
+    {
+        const auto &result = sink_.results[i];
+        EXPECT_EQ(result.frame_id, i + 1);
+        EXPECT_DOUBLE_EQ(result.pose.x, static_cast<double>(i + 1));
+        ASSERT_EQ(result.detections.size(), 1U);
+        EXPECT_FLOAT_EQ(result.detections[0].confidence, static_cast<float>(i + 1));
+    }
+    EXPECT_EQ(detection_.detect_count, static_cast<int>(kFrameCount));
+    EXPECT_TRUE(visualization_.rendered_sources.empty());
+    EXPECT_EQ(sink_.flush_count, 1);
+
+    auto report = service.getLatencyReport();
+    EXPECT_EQ(report.at(domain::model::PipelineStage::DETECTION).count, kFrameCount);
+}
+
+TEST_F(VisionPilotServiceBatchTest, DetectsQueuedFramesInBatchesAndKeepsOrder)
+{
+    constexpr uint64_t kFrameCount = 40;
+    config_.batchQueueSize = 8;
+    config_.detectionBatchSize = 4;
+    FakeDetection slow_detection{5};
+    VisionPilotService service{localization_, visualization_, slow_detection, config_, &sink_};
+
+    for (uint64_t id = 1; id <= kFrameCount; ++id)
+    {
+        service.onFrameReceived(makeFrame(id));
+    }
+    service.flush();
+
+    ASSERT_EQ(sink_.results.size(), kFrameCount);
+    for (uint64_t i = 0; i < kFrameCount; ++i)
+    {
+        EXPECT_EQ(sink_.results[i].frame_id, i + 1);
+        ASSERT_EQ(sink_.results[i].detections.size(), 1U);
+        EXPECT_FLOAT_EQ(sink_.results[i].detections[0].confidence, static_cast<float>(i + 1));
+    }
+    EXPECT_EQ(slow_detection.detect_count, static_cast<int>(kFrameCount));
+    EXPECT_GT(slow_detection.max_batch_size, 1);
+    EXPECT_LE(slow_detection.max_batch_size, 4);
+}
+
+TEST_F(VisionPilotServiceBatchTest, KeepsAsyncDetectionsInFlightAndKeepsOrder)
+{
+    constexpr uint64_t kFrameCount = 30;
+    config_.batchQueueSize = 8;
+    config_.asyncDetectionDepth = 4;
+    FakeAsyncDetection async_detection{3};
+    VisionPilotService service{localization_, visualization_, async_detection, config_, &sink_};
+
+    for (uint64_t id = 1; id <= kFrameCount; ++id)
+    {
+        service.onFrameReceived(makeFrame(id));
+    }
+    service.flush();
+
+    ASSERT_EQ(sink_.results.size(), kFrameCount);
+    for (uint64_t i = 0; i < kFrameCount; ++i)
+    {
+        EXPECT_EQ(sink_.results[i].frame_id, i + 1);
+        EXPECT_DOUBLE_EQ(sink_.results[i].pose.x, static_cast<double>(i + 1));
+        ASSERT_EQ(sink_.results[i].detections.size(), 1U);
+        EXPECT_FLOAT_EQ(sink_.results[i].detections[0].confidence, static_cast<float>(i + 1));
+    }
+    EXPECT_EQ(async_detection.detect_count, static_cast<int>(kFrameCount));
+    EXPECT_GT(async_detection.max_in_flight, 1);
+    EXPECT_LE(async_detection.max_in_flight, 4);
+
+    auto report = service.getLatencyReport();
+    EXPECT_EQ(report.at(domain::model::PipelineStage::DETECTION).count, kFrameCount);
+}
+
+TEST_F(VisionPilotServiceBatchTest, DrainsAsyncDetectionsOnDestruction)
+{
+    constexpr uint64_t kFrameCount = 6;
+    config_.asyncDetectionDepth = 3;
+    FakeAsyncDetection async_detection{2};
+    {
+        VisionPilotService service{localization_, visualization_, async_detection, config_, &sink_};
+        for (uint64_t id = 1; id <= kFrameCount; ++id)
+        {
+            service.onFrameReceived(makeFrame(id));
+        }
+    }
+
+    ASSERT_EQ(sink_.results.size(), kFrameCount);
+    EXPECT_EQ(sink_.results.back().frame_id, kFrameCount);
+}
+
+TEST_F(VisionPilotServiceBatchTest, DrainsQueuedFramesOnDestruction)
+{
+    constexpr uint64_t kFrameCount = 5;
+    {
+        VisionPilotService service{localization_, visualization_, detection_, config_, &sink_};
+        for (uint64_t id = 1; id <= kFrameCount; ++id)
+        {
+            service.onFrameReceived(makeFrame(id));
+        }
+    }
+
+    EXPECT_EQ(sink_.results.size(), kFrameCount);
+}
+} // namespace vp::service
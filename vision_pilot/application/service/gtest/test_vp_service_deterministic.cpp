@@ -0,0 +1,270 @@
+#include "fake_ports.hpp"
+#include "vision_pilot_service.hpp"
+#include <gtest/gtest.h>
+#include <random>
+
+namespace vp::service
+{
+namespace
+{
+// 한 번의 재생 결과 (프레임별 렌더링 입력 + 결과 출력)
+struct ReplayOutput
+{
+    std::vector<uint64_t> rendered_sources;
+    std::vector<uint64_t> result_ids;
+    std::vector<bool> detected;
+    std::vector<uint64_t> detection_sources;
+};
+
+// 프레임마다 일정하게 움직이는 차량 2대를 탐지
+class MovingDetection : public vp::port::out::ObjectDetectionPort
+{
+public:
+    std::vector<domain::model::Detection> detectObject(const domain::model::ImagePacket &image) override
+    {
+        const float t = static_cast<float>(image.frame_id);
+        return {{domain::model::ClassId::CAR, 0.9f, {10.0f + 4.0f * t, 50.0f, 40.0f, 30.0f}},
+                {domain::model::ClassId::CAR, 0.9f, {400.0f - 3.0f * t, 120.0f, 60.0f, 40.0f}}};
+    }
+};
+
+// 전달받은 시각 간격만큼 이동하는 포즈 (SLAM 처럼 시각에 따라 결과가 달라지는 위치 추정)
+class TimedLocalization : public vp::port::out::LocalizationPort
+{
+public:
+    domain::model::Pose update(const domain::model::ImagePacket & /* image */, uint64_t timestamp) override
+    {
+        if (last_timestamp_ > 0)
+        {
+            x_ += static_cast<double>(timestamp - last_timestamp_) * 1e-6;
+        }
+        last_timestamp_ = timestamp;
+
+        domain::model::Pose pose{x_, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0};
+        pose.timestamp = timestamp;
+        pose.is_lost = false;
+        return pose;
+    }
+
+private:
+    uint64_t last_timestamp_ = 0;
+    double x_ = 0.0;
+};
+
+// 포즈/시각 출력 비교용
+struct PoseOutput
+{
+    uint64_t timestamp;
+    double x;
+
+    bool operator==(const PoseOutput &other) const
+    {
+        return timestamp == other.timestamp && x == other.x;
+    }
+};
+
+// 트랙 출력 비교용 (track_id, 박스)
+struct TrackOutput
+{
+    int32_t track_id;
+    float x;
+    float y;
+    float width;
+    float height;
+
+    bool operator==(const TrackOutput &other) const
+    {
+        return track_id == other.track_id && x == other.x && y == other.y && width == other.width && height == other.height;
+    }
+};
+} // namespace
+
+class VisionPilotServiceDeterministicTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        config_.processingMode = config::ProcessingMode::DETERMINISTIC;
+        config_.latencyLogIntervalMs = 0;
+        config_.deterministic.detectionStride = 3;
+    }
+
+    ReplayOutput replay(bool single_thread, uint32_t seed)
+    {
+        config_.deterministic.singleThread = single_thread;
+
+        test::FakeLocalization localization;
+        test::FakeVisualization visualization;
+        test::FakeDetection detection{3, seed};
+        test::RecordingSink sink;
+        {
+            VisionPilotService service{localization, visualization, detection, config_, &sink};
+            for (uint64_t id = 1; id <= kFrameCount; ++id)
+            {
+                service.onFrameReceived(test::makeFrame(id));
+            }
+            service.flush();
+        }
+
+        ReplayOutput output;
+        output.rendered_sources = visualization.rendered_sources;
+        for (const auto &result : sink.results)
+        {
+            output.result_ids.push_back(result.frame_id);
+            output.detected.push_back(result.detected);
+            output.detection_sources.push_back(result.detections.empty() ? 0 : static_cast<uint64_t>(result.detections.front().confidence));
+        }
+        return output;
+    }
+
+    // 읽은 시각(timestamp)을 seed 로 흔들어 재생. 소스 시각은 frame_id 기준으로 고정
+    std::vector<std::vector<TrackOutput>> replayTracks(bool single_thread, uint32_t seed)
+    {
+        config_.deterministic.singleThread = single_thread;
+
+        test::FakeLocalization localization;
+        test::FakeVisualization visualization;
+        MovingDetection detection;
+        test::RecordingSink sink;
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<uint64_t> jitter(0, 500);
+        {
+            VisionPilotService service{localization, visualization, detection, config_, &sink};
+            for (uint64_t id = 1; id <= kFrameCount; ++id)
+            {
+                auto frame = test::makeFrame(id);
+                frame.timestamp = id * 5 + jitter(rng);
+                service.onFrameReceived(frame);
+            }
+            service.flush();
+        }
+
+        std::vector<std::vector<TrackOutput>> tracks;
+        for (const auto &result : sink.results)
+        {
+            auto &frame_tracks = tracks.emplace_back();
+            for (const auto &det : result.detections)
+            {
+                frame_tracks.push_back({det.track_id, det.bbox.x, det.bbox.y, det.bbox.width, det.bbox.height});
+            }
+        }
+        return tracks;
+    }
+
+    // 읽은 시각을 seed 로 흔들어 재생한 결과 시각과 포즈
+    std::vector<PoseOutput> replayPoses(bool single_thread, uint32_t seed)
+    {
+        config_.deterministic.singleThread = single_thread;
+
+        TimedLocalization localization;
+        test::FakeVisualization visualization;
+        test::FakeDetection detection{1, seed};
+        test::RecordingSink sink;
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<uint64_t> jitter(0, 500000);
+        {
+            VisionPilotService service{localization, visualization, detection, config_, &sink};
+            for (uint64_t id = 1; id <= kFrameCount; ++id)
+            {
+                auto frame = test::makeFrame(id);
+                frame.timestamp = id * 5000 + jitter(rng);
+                service.onFrameReceived(frame);
+            }
+            service.flush();
+        }
+
+        std::vector<PoseOutput> poses;
+        for (const auto &result : sink.results)
+        {
+            EXPECT_EQ(result.pose.timestamp, result.timestamp);
+            poses.push_back({result.timestamp, result.pose.x});
+        }
+        return poses;
+    }
+
+    static constexpr uint64_t kFrameCount = 30;
+    config::VisionPilotServiceConfig config_;
+};
+
+TEST_F(VisionPilotServiceDeterministicTest, DetectsOnlyStrideFramesAndRendersPreviousResult)
+{
+    auto output = this->replay(true, 1);
+
+    ASSERT_EQ(output.rendered_sources.size(), kFrameCount);
+    ASSERT_EQ(output.result_ids.size(), kFrameCount);
+    for (uint64_t i = 0; i < kFrameCount; ++i)
+    {
+        const uint64_t id = i + 1;
+        EXPECT_EQ(output.result_ids[i], id);
+        EXPECT_EQ(output.detected[i], id % 3 == 0);
+        EXPECT_EQ(output.detection_sources[i], id % 3 == 0 ? id : 0);
+
+        // 프레임 N 은 N 이전의 마지막 탐지 프레임 결과로 렌더링
+        const uint64_t expected_source = ((id - 1) / 3) * 3;
+        EXPECT_EQ(output.rendered_sources[i], expected_source) << "frame " << id;
+    }
+}
+
+TEST_F(VisionPilotServiceDeterministicTest, PipelinedMatchesSingleThread)
+{
+    auto reference = this->replay(true, 1);
+
+    // 탐지 지연을 바꿔가며 실행해도 출력은 동일해야 함
+    for (uint32_t seed = 2; seed < 5; ++seed)
+    {
+        auto output = this->replay(false, seed);
+        EXPECT_EQ(output.rendered_sources, reference.rendered_sources);
+        EXPECT_EQ(output.result_ids, reference.result_ids);
+        EXPECT_EQ(output.detected, reference.detected);
+        EXPECT_EQ(output.detection_sources, reference.detection_sources);
+    }
+}
+
+TEST_F(VisionPilotServiceDeterministicTest, ZeroStrideDisablesDetection)
+{
+    config_.deterministic.detectionStride = 0;
+    auto output = this->replay(false, 1);
+
+    ASSERT_EQ(output.result_ids.size(), kFrameCount);
+    for (uint64_t i = 0; i < kFrameCount; ++i)
+    {
+        EXPECT_FALSE(output.detected[i]);
+        EXPECT_EQ(output.rendered_sources[i], 0U);
+    }
+}
+TEST_F(VisionPilotServiceDeterministicTest, TracksDoNotDependOnReadTiming)
+{
+    config_.deterministic.detectionStride = 2;
+    config_.tracker.enable = true;
+    auto reference = this->replayTracks(true, 1);
+
+    ASSERT_EQ(reference.size(), kFrameCount);
+    for (uint64_t id = 4; id <= kFrameCount; ++id)
+    {
+        // 트랙 확정 후에는 탐지를 건너뛴 프레임도 예측한 트랙 2개를 출력
+        EXPECT_EQ(reference[id - 1].size(), 2U) << "frame " << id;
+    }
+
+    for (uint32_t seed = 2; seed < 5; ++seed)
+    {
+        EXPECT_EQ(this->replayTracks(seed % 2 == 0, seed), reference) << "seed " << seed;
+    }
+}
+
+TEST_F(VisionPilotServiceDeterministicTest, PosesAndTimestampsDoNotDependOnReadTiming)
+{
+    auto reference = this->replayPoses(true, 1);
+
+    ASSERT_EQ(reference.size(), kFrameCount);
+    for (uint64_t id = 1; id <= kFrameCount; ++id)
+    {
+        // 소스 시각 (us) 으로 위치 추정/출력
+        EXPECT_EQ(reference[id - 1].timestamp, id * 33 * 1000) << "frame " << id;
+    }
+
+    for (uint32_t seed = 2; seed < 5; ++seed)
+    {
+        EXPECT_EQ(this->replayPoses(seed % 2 == 0, seed), reference) << "seed " << seed;
+    }
+}
+} // namespace vp::service
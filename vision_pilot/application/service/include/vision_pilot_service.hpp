@@ -1,7 +1,10 @@
 #pragma once
 #include "frame_receive_usecase.hpp"
+#include "latency_report.hpp"
 #include "localization_port.hpp"
 #include "object_detection_port.hpp"
+#include "result_sink_port.hpp"
+#include "service_config.hpp"
 #include "visualization_port.hpp"
 #include <memory>
 
@@ -12,11 +15,18 @@ class VisionPilotServiceImpl;
 class VisionPilotService : public vp::port::in::FrameReceiveUseCase
 {
 public:
-    VisionPilotService(vp::port::out::LocalizationPort &localization_port, vp::port::out::VisualizationPort &visualization_port, vp::port::out::ObjectDetectionPort &object_detection_port);
+    VisionPilotService(vp::port::out::LocalizationPort &localization_port, vp::port::out::VisualizationPort &visualization_port, vp::port::out::ObjectDetectionPort &object_detection_port,
+                       const config::VisionPilotServiceConfig &config = {}, vp::port::out::ResultSinkPort *result_sink = nullptr);
     ~VisionPilotService();
 
     void onFrameReceived(const domain::model::ImagePacket &frame) override;
 
+    // 대기 중인 탐지를 모두 마칠 때까지 대기한 뒤 결과 출력 포트를 flush (BATCH 모드 종료 시 사용)
+    void flush();
+
+    // 서비스 시작 이후 누적된 구간별 지연 시간 통계 (p50/p95/p99)
+    domain::model::LatencyReport getLatencyReport() const;
+
 private:
     std::unique_ptr<VisionPilotServiceImpl> impl_;
 };
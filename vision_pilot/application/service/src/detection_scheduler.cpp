@@ -0,0 +1,176 @@
+#include "detection_scheduler.hpp"
+#include "gaia_log.hpp"
+#include <algorithm>
+
+namespace
+{
+constexpr double kMicroSecondsInSecond = 1e6;
+constexpr double kMaxSlamLoad = 0.9;         // SLAM 부하가 높아도 탐지에 최소한의 시간은 남김
+constexpr double kMinDutyCycle = 0.05;       // 탐지 간격이 무한히 늘어나지 않도록 하한
+constexpr double kRecoverBudgetRatio = 0.8; // REDUCED -> FULL 복귀 시 히스테리시스
+} // namespace
+
+namespace vp::service
+{
+using vp::port::out::DetectionLevel;
+
+DetectionScheduler::DetectionScheduler(const config::DetectionSchedulerConfig &config, bool reduced_supported)
+    : config_{config}, allow_reduced_{config.allowReduced && reduced_supported}
+{
+    LOG_TRA("");
+    if (config_.enable && config_.allowReduced && !reduced_supported)
+    {
+        // 같은 모델을 REDUCED 로 실행하면 비용이 그대로라 REDUCED 에 머무르게 됨
+        LOG_WRN("Detector has no reduced detection (no reduced model, dynamic input or tiling). allowReduced is ignored.");
+    }
+}
+
+DetectionDecision DetectionScheduler::decide(uint64_t now_us, bool detector_busy)
+{
+    DetectionDecision decision;
+    if (!config_.enable)
+    {
+        return decision;
+    }
+
+    if (detector_busy)
+    {
+        decision.action = DetectionAction::SKIP;
+        return decision;
+    }
+
+    auto level = this->selectLevel();
+    const auto period_us = this->periodUs(level);
+    if (has_detected_ && now_us < next_detect_us_)
+    {
+        decision.action = DetectionAction::SKIP;
+        return decision;
+    }
+
+    // 경량 탐지 중에도 주기적으로 FULL 탐지를 수행해 소요 시간 추정값을 갱신
+    const bool probe = level == DetectionLevel::REDUCED && config_.probeInterval > 0 && reduced_count_ >= config_.probeInterval;
+    if (probe)
+    {
+        level = DetectionLevel::FULL;
+        reduced_count_ = 0;
+    }
+    else
+    {
+        if (level == DetectionLevel::REDUCED)
+        {
+            ++reduced_count_;
+        }
+        if (level != current_level_)
+        {
+            LOG_DBG("Detection level changed: {} -> {} (full: {:.1f}ms, reduced: {:.1f}ms, slam: {:.1f}ms)",
+                    current_level_ == DetectionLevel::FULL ? "FULL" : "REDUCED",
+                    level == DetectionLevel::FULL ? "FULL" : "REDUCED",
+                    full_ewma_us_ / 1000.0, reduced_ewma_us_ / 1000.0, slam_ewma_us_ / 1000.0);
+            current_level_ = level;
+        }
+    }
+
+    // 예정 시각 기준으로 다음 탐지 시각을 잡아 입력 프레임 간격과 무관하게 목표 주기를 유지.
+    // 한 주기 이상 밀린 경우 현재 시각 기준으로 재설정 (몰아서 탐지하지 않음)
+    next_detect_us_ = has_detected_ ? next_detect_us_ + period_us : now_us + period_us;
+    if (next_detect_us_ <= now_us)
+    {
+        next_detect_us_ = now_us + period_us;
+    }
+    has_detected_ = true;
+
+    decision.level = level;
+    return decision;
+}
+
+void DetectionScheduler::reportInference(DetectionLevel level, uint64_t elapsed_us)
+{
+    this->updateEwma(level == DetectionLevel::FULL ? full_ewma_us_ : reduced_ewma_us_, static_cast<double>(elapsed_us));
+}
+
+void DetectionScheduler::reportLocalization(uint64_t now_us, uint64_t elapsed_us)
+{
+    this->updateEwma(slam_ewma_us_, static_cast<double>(elapsed_us));
+
+    if (last_frame_us_ != 0 && now_us > last_frame_us_)
+    {
+        this->updateEwma(frame_interval_ewma_us_, static_cast<double>(now_us - last_frame_us_));
+    }
+    last_frame_us_ = now_us;
+}
+
+uint64_t DetectionScheduler::effectivePeriodUs() const
+{
+    return this->periodUs(current_level_);
+}
+
+double DetectionScheduler::inferenceEwmaUs(DetectionLevel level) const
+{
+    return level == DetectionLevel::FULL ? full_ewma_us_ : reduced_ewma_us_;
+}
+
+DetectionLevel DetectionScheduler::selectLevel() const
+{
+    if (!allow_reduced_ || full_ewma_us_ <= 0.0)
+    {
+        return DetectionLevel::FULL;
+    }
+
+    const double budget_us = config_.latencyBudgetMs * 1000.0;
+    const double limit_us = current_level_ == DetectionLevel::FULL ? budget_us : budget_us * kRecoverBudgetRatio;
+
+    // 1. 지연 예산 초과
+    if (full_ewma_us_ > limit_us)
+    {
+        return DetectionLevel::REDUCED;
+    }
+
+    // 2. FULL 로는 목표 주기를 맞출 수 없고, 경량 탐지가 더 저렴한 경우
+    const auto base_period_us = config_.targetHz > 0.0 ? kMicroSecondsInSecond / config_.targetHz : 0.0;
+    if (static_cast<double>(this->periodUs(DetectionLevel::FULL)) > base_period_us &&
+        this->costUs(DetectionLevel::REDUCED) < full_ewma_us_)
+    {
+        return DetectionLevel::REDUCED;
+    }
+
+    return DetectionLevel::FULL;
+}
+
+uint64_t DetectionScheduler::periodUs(DetectionLevel level) const
+{
+    const double base_period_us = config_.targetHz > 0.0 ? kMicroSecondsInSecond / config_.targetHz : 0.0;
+    const double duty = std::clamp(config_.maxDutyCycle * (1.0 - this->slamLoad()), kMinDutyCycle, 1.0);
+
+    return static_cast<uint64_t>(std::max(base_period_us, this->costUs(level) / duty));
+}
+
+double DetectionScheduler::costUs(DetectionLevel level) const
+{
+    if (level == DetectionLevel::REDUCED && reduced_ewma_us_ <= 0.0)
+    {
+        // 측정값이 없으면 FULL 대비 절반으로 가정
+        return full_ewma_us_ * 0.5;
+    }
+    return this->inferenceEwmaUs(level);
+}
+
+double DetectionScheduler::slamLoad() const
+{
+    if (frame_interval_ewma_us_ <= 0.0)
+    {
+        return 0.0;
+    }
+    return std::clamp(slam_ewma_us_ / frame_interval_ewma_us_, 0.0, kMaxSlamLoad);
+}
+
+void DetectionScheduler::updateEwma(double &ewma, double sample) const
+{
+    if (ewma <= 0.0)
+    {
+        ewma = sample;
+        return;
+    }
+    ewma += config_.ewmaAlpha * (sample - ewma);
+}
+
+} // namespace vp::service
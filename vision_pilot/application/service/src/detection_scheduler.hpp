@@ -0,0 +1,70 @@
+#pragma once
+
+#include "object_detection_port.hpp"
+#include "service_config.hpp"
+#include <cstdint>
+
+namespace vp::service
+{
+
+enum class DetectionAction
+{
+    DETECT = 0,
+    SKIP
+};
+
+struct DetectionDecision
+{
+    DetectionAction action = DetectionAction::DETECT;
+    vp::port::out::DetectionLevel level = vp::port::out::DetectionLevel::FULL;
+};
+
+/**
+ * @brief 목표 탐지 주기와 지연 예산에 맞춰 프레임별 탐지 여부/품질을 결정
+ *
+ * 최근 추론 시간과 SLAM 처리 시간을 지수 이동 평균으로 추적하여,
+ * 탐지가 점유하는 시간 비율이 maxDutyCycle 을 넘지 않도록 탐지 간격을 늘리거나
+ * 경량 탐지로 전환한다. SLAM 이 바쁠수록 탐지에 허용되는 시간 비율이 줄어든다.
+ * 스레드 안전하지 않으므로 호출자가 동기화해야 한다.
+ */
+class DetectionScheduler
+{
+public:
+    // reduced_supported: 탐지기가 REDUCED 를 FULL 보다 가볍게 실행하는지 (false 면 allowReduced 무시)
+    explicit DetectionScheduler(const config::DetectionSchedulerConfig &config, bool reduced_supported = true);
+
+    // 프레임 도착 시점(now_us)에 호출. detector_busy: 탐지 스레드가 아직 이전 프레임 처리 중
+    DetectionDecision decide(uint64_t now_us, bool detector_busy);
+
+    void reportInference(vp::port::out::DetectionLevel level, uint64_t elapsed_us);
+    void reportLocalization(uint64_t now_us, uint64_t elapsed_us);
+
+    // 현재 부하 기준 탐지 간격 (us)
+    uint64_t effectivePeriodUs() const;
+    double inferenceEwmaUs(vp::port::out::DetectionLevel level) const;
+    double localizationEwmaUs() const { return slam_ewma_us_; }
+
+private:
+    vp::port::out::DetectionLevel selectLevel() const;
+    uint64_t periodUs(vp::port::out::DetectionLevel level) const;
+    double costUs(vp::port::out::DetectionLevel level) const;
+    double slamLoad() const;
+    void updateEwma(double &ewma, double sample) const;
+
+    const config::DetectionSchedulerConfig config_;
+    const bool allow_reduced_;
+
+    double full_ewma_us_ = 0.0;    // 0: 아직 측정값 없음
+    double reduced_ewma_us_ = 0.0; // 0: 아직 측정값 없음
+    double slam_ewma_us_ = 0.0;
+    double frame_interval_ewma_us_ = 0.0;
+
+    uint64_t last_frame_us_ = 0;
+    uint64_t next_detect_us_ = 0;
+    bool has_detected_ = false;
+
+    vp::port::out::DetectionLevel current_level_ = vp::port::out::DetectionLevel::FULL;
+    uint32_t reduced_count_ = 0; // 마지막 FULL 재측정(probe) 이후 경량 탐지 횟수
+};
+
+} // namespace vp::service
@@ -0,0 +1,91 @@
+#include "hungarian_solver.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace vp::service
+{
+
+void HungarianSolver::solve(const std::vector<float> &cost, int rows, int cols, std::vector<int> &row_to_col)
+{
+    row_to_col.assign(static_cast<size_t>(std::max(rows, 0)), -1);
+    if (rows <= 0 || cols <= 0)
+    {
+        return;
+    }
+
+    // 1-based 포텐셜 방식. p_[j]: 열 j 에 배정된 행 (0: 없음)
+    const int n = std::max(rows, cols);
+    const auto at = [&](int i, int j) -> double
+    {
+        return (i <= rows && j <= cols) ? cost[static_cast<size_t>(i - 1) * cols + (j - 1)] : 0.0;
+    };
+    constexpr double kInf = std::numeric_limits<double>::infinity();
+    u_.assign(n + 1, 0.0);
+    v_.assign(n + 1, 0.0);
+    p_.assign(n + 1, 0);
+    way_.assign(n + 1, 0);
+
+    for (int i = 1; i <= n; ++i)
+    {
+        p_[0] = i;
+        int j0 = 0;
+        min_v_.assign(n + 1, kInf);
+        used_.assign(n + 1, 0);
+        do
+        {
+            used_[j0] = 1;
+            const int i0 = p_[j0];
+            double delta = kInf;
+            int j1 = 0;
+            for (int j = 1; j <= n; ++j)
+            {
+                if (used_[j])
+                {
+                    continue;
+                }
+                const double reduced = at(i0, j) - u_[i0] - v_[j];
+                if (reduced < min_v_[j])
+                {
+                    min_v_[j] = reduced;
+                    way_[j] = j0;
+                }
+                if (min_v_[j] < delta)
+                {
+                    delta = min_v_[j];
+                    j1 = j;
+                }
+            }
+            for (int j = 0; j <= n; ++j)
+            {
+                if (used_[j])
+                {
+                    u_[p_[j]] += delta;
+                    v_[j] -= delta;
+                }
+                else
+                {
+                    min_v_[j] -= delta;
+                }
+            }
+            j0 = j1;
+        } while (p_[j0] != 0);
+
+        // 증가 경로를 따라 배정 갱신
+        do
+        {
+            const int j1 = way_[j0];
+            p_[j0] = p_[j1];
+            j0 = j1;
+        } while (j0 != 0);
+    }
+
+    for (int j = 1; j <= cols; ++j)
+    {
+        if (p_[j] >= 1 && p_[j] <= rows)
+        {
+            row_to_col[p_[j] - 1] = j - 1;
+        }
+    }
+}
+
+} // namespace vp::service
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <vector>
+
+namespace vp::service
+{
+
+/**
+ * @brief 최소 비용 할당 (Hungarian / Kuhn-Munkres, O(n^3))
+ *
+ * 행과 열 수가 다르면 비용 0 인 가상 행/열로 정방 행렬을 만들어 푼다.
+ * 내부 버퍼를 재사용하므로 스레드 안전하지 않다.
+ */
+class HungarianSolver
+{
+public:
+    // cost: rows x cols (row-major). row_to_col: 행별 배정된 열 (-1: 미배정)
+    void solve(const std::vector<float> &cost, int rows, int cols, std::vector<int> &row_to_col);
+
+private:
+    std::vector<double> u_;
+    std::vector<double> v_;
+    std::vector<double> min_v_;
+    std::vector<int> p_;
+    std::vector<int> way_;
+    std::vector<char> used_;
+};
+
+} // namespace vp::service
@@ -0,0 +1,202 @@
+#include "latency_monitor.hpp"
+#include "gaia_log.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+constexpr double kMicroSecondsInMilliSecond = 1000.0;
+constexpr uint64_t kNanoSecondsInMilliSecond = 1000000;
+} // namespace
+
+namespace vp::service
+{
+using domain::model::PipelineStage;
+
+uint32_t LatencyHistogram::bucketIndex(uint64_t value_us)
+{
+    if (value_us < kSubBucketCount)
+    {
+        return static_cast<uint32_t>(value_us);
+    }
+
+    const auto exponent = static_cast<uint32_t>(63 - __builtin_clzll(value_us));
+    if (exponent > kMaxExponent)
+    {
+        return kBucketCount - 1;
+    }
+
+    const auto sub_bucket = static_cast<uint32_t>((value_us >> (exponent - kSubBucketBits)) & (kSubBucketCount - 1));
+    return kSubBucketCount + (exponent - kSubBucketBits) * kSubBucketCount + sub_bucket;
+}
+
+double LatencyHistogram::bucketMidUs(uint32_t index)
+{
+    if (index < kSubBucketCount)
+    {
+        return static_cast<double>(index);
+    }
+
+    const uint32_t exponent = (index - kSubBucketCount) / kSubBucketCount + kSubBucketBits;
+    const uint32_t sub_bucket = (index - kSubBucketCount) % kSubBucketCount;
+    const double width = std::ldexp(1.0, static_cast<int>(exponent - kSubBucketBits));
+    const double lower = std::ldexp(1.0, static_cast<int>(exponent)) + sub_bucket * width;
+
+    return lower + width / 2.0;
+}
+
+void LatencyHistogram::record(uint64_t value_us)
+{
+    ++buckets_.at(bucketIndex(value_us));
+    ++count_;
+    sum_us_ += value_us;
+    max_us_ = std::max(max_us_, value_us);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram &other)
+{
+    for (size_t i = 0; i < buckets_.size(); ++i)
+    {
+        buckets_.at(i) += other.buckets_.at(i);
+    }
+    count_ += other.count_;
+    sum_us_ += other.sum_us_;
+    max_us_ = std::max(max_us_, other.max_us_);
+}
+
+void LatencyHistogram::reset()
+{
+    buckets_.fill(0);
+    count_ = 0;
+    sum_us_ = 0;
+    max_us_ = 0;
+}
+
+double LatencyHistogram::percentileUs(double percentile) const
+{
+    if (count_ == 0)
+    {
+        return 0.0;
+    }
+
+    const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(count_))));
+    uint64_t cumulative = 0;
+    for (uint32_t i = 0; i < kBucketCount; ++i)
+    {
+        cumulative += buckets_.at(i);
+        if (cumulative >= rank)
+        {
+            // 버킷 중간값이 실제 최대값을 넘지 않도록 보정
+            return std::min(bucketMidUs(i), static_cast<double>(max_us_));
+        }
+    }
+    return static_cast<double>(max_us_);
+}
+
+domain::model::StageLatency LatencyHistogram::summarize() const
+{
+    domain::model::StageLatency summary;
+    summary.count = count_;
+    if (count_ == 0)
+    {
+        return summary;
+    }
+
+    summary.mean_ms = static_cast<double>(sum_us_) / static_cast<double>(count_) / kMicroSecondsInMilliSecond;
+    summary.p50_ms = this->percentileUs(50.0) / kMicroSecondsInMilliSecond;
+    summary.p95_ms = this->percentileUs(95.0) / kMicroSecondsInMilliSecond;
+    summary.p99_ms = this->percentileUs(99.0) / kMicroSecondsInMilliSecond;
+    summary.max_ms = static_cast<double>(max_us_) / kMicroSecondsInMilliSecond;
+    return summary;
+}
+
+LatencyMonitor::LatencyMonitor(uint32_t log_interval_ms)
+    : log_interval_ns_{static_cast<uint64_t>(log_interval_ms) * kNanoSecondsInMilliSecond}
+{
+    LOG_TRA("");
+}
+
+void LatencyMonitor::record(PipelineStage stage, uint64_t elapsed_us)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    window_.at(static_cast<size_t>(stage)).record(elapsed_us);
+}
+
+void LatencyMonitor::record(PipelineStage stage, const domain::model::FrameTrace &trace,
+                            domain::model::TracePoint from, domain::model::TracePoint to)
+{
+    uint64_t elapsed_us = 0;
+    if (trace.elapsedUs(from, to, elapsed_us))
+    {
+        this->record(stage, elapsed_us);
+    }
+}
+
+domain::model::LatencyReport LatencyMonitor::report() const
+{
+    Histograms merged;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        merged = total_;
+        for (size_t i = 0; i < merged.size(); ++i)
+        {
+            merged.at(i).merge(window_.at(i));
+        }
+    }
+    return summarize(merged);
+}
+
+void LatencyMonitor::logIfDue(uint64_t now_ns)
+{
+    if (log_interval_ns_ == 0)
+    {
+        return;
+    }
+
+    Histograms window;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (last_log_ns_ == 0)
+        {
+            last_log_ns_ = now_ns;
+            return;
+        }
+        if (now_ns - last_log_ns_ < log_interval_ns_)
+        {
+            return;
+        }
+        last_log_ns_ = now_ns;
+
+        window = window_;
+        for (size_t i = 0; i < window_.size(); ++i)
+        {
+            total_.at(i).merge(window_.at(i));
+            window_.at(i).reset();
+        }
+    }
+
+    const auto report = summarize(window);
+    for (size_t i = 0; i < report.stages.size(); ++i)
+    {
+        const auto &stage = report.stages.at(i);
+        if (stage.count == 0)
+        {
+            continue;
+        }
+        LOG_INF("[latency] {:<14} n={:<5} mean={:.2f}ms p50={:.2f}ms p95={:.2f}ms p99={:.2f}ms max={:.2f}ms",
+                domain::model::toString(static_cast<PipelineStage>(i)), stage.count,
+                stage.mean_ms, stage.p50_ms, stage.p95_ms, stage.p99_ms, stage.max_ms);
+    }
+}
+
+domain::model::LatencyReport LatencyMonitor::summarize(const Histograms &histograms)
+{
+    domain::model::LatencyReport report;
+    for (size_t i = 0; i < histograms.size(); ++i)
+    {
+        report.stages.at(i) = histograms.at(i).summarize();
+    }
+    return report;
+}
+
+} // namespace vp::service
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "frame_trace.hpp"
+#include "latency_report.hpp"
+#include <array>
+#include <cstdint>
+#include <mutex>
+
+namespace vp::service
+{
+
+/**
+ * @brief 고정 크기 로그-선형 버킷 히스토그램 (단위: us)
+ *
+ * 2의 거듭제곱 구간마다 8개의 하위 버킷을 두어 상대 오차 약 6% 이내로 백분위를 추정한다.
+ * 기록 시 메모리 할당이 없다.
+ */
+class LatencyHistogram
+{
+public:
+    void record(uint64_t value_us);
+    void merge(const LatencyHistogram &other);
+    void reset();
+
+    uint64_t count() const { return count_; }
+    double percentileUs(double percentile) const;
+    domain::model::StageLatency summarize() const;
+
+private:
+    static constexpr uint32_t kSubBucketBits = 3;
+    static constexpr uint32_t kSubBucketCount = 1U << kSubBucketBits;
+    static constexpr uint32_t kMaxExponent = 40; // 2^41 us 이상은 마지막 버킷으로
+    static constexpr uint32_t kBucketCount = kSubBucketCount + (kMaxExponent - kSubBucketBits + 1) * kSubBucketCount;
+
+    static uint32_t bucketIndex(uint64_t value_us);
+    static double bucketMidUs(uint32_t index);
+
+    std::array<uint64_t, kBucketCount> buckets_{};
+    uint64_t count_ = 0;
+    uint64_t sum_us_ = 0;
+    uint64_t max_us_ = 0;
+};
+
+/**
+ * @brief 프레임 트레이스를 구간별 히스토그램으로 집계
+ *
+ * 여러 스레드(라우터/탐지)에서 기록되므로 내부 뮤텍스로 보호한다.
+ * 누적 통계와 주기적 로그용 구간(window) 통계를 함께 유지한다.
+ */
+class LatencyMonitor
+{
+public:
+    explicit LatencyMonitor(uint32_t log_interval_ms);
+
+    void record(domain::model::PipelineStage stage, uint64_t elapsed_us);
+    void record(domain::model::PipelineStage stage, const domain::model::FrameTrace &trace,
+                domain::model::TracePoint from, domain::model::TracePoint to);
+
+    domain::model::LatencyReport report() const;
+
+    // 로그 주기가 지났으면 구간 통계를 로그로 출력하고 누적 통계에 합산
+    void logIfDue(uint64_t now_ns);
+
+private:
+    using Histograms = std::array<LatencyHistogram, domain::model::kPipelineStageCount>;
+
+    static domain::model::LatencyReport summarize(const Histograms &histograms);
+
+    const uint64_t log_interval_ns_;
+
+    mutable std::mutex mutex_{};
+    Histograms total_{};
+    Histograms window_{};
+    uint64_t last_log_ns_ = 0;
+};
+
+} // namespace vp::service
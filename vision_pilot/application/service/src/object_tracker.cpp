@@ -0,0 +1,221 @@
+#include "object_tracker.hpp"
+#include "gaia_log.hpp"
+#include <algorithm>
+
+namespace
+{
+using vp::domain::model::BoundingBox;
+
+constexpr double kMilliSecondsInSecond = 1000.0;
+constexpr double kInitialVelocityStd = 200.0; // 새 트랙 속도 불확실성 (px/s)
+
+float iou(const BoundingBox &a, const BoundingBox &b)
+{
+    const float w = std::min(a.x + a.width, b.x + b.width) - std::max(a.x, b.x);
+    const float h = std::min(a.y + a.height, b.y + b.height) - std::max(a.y, b.y);
+    if (w <= 0.0f || h <= 0.0f)
+    {
+        return 0.0f;
+    }
+    const float inter = w * h;
+    return inter / (a.width * a.height + b.width * b.height - inter);
+}
+
+double elapsedSeconds(uint64_t from_ms, uint64_t to_ms)
+{
+    return to_ms > from_ms ? static_cast<double>(to_ms - from_ms) / kMilliSecondsInSecond : 0.0;
+}
+} // namespace
+
+namespace vp::service
+{
+
+ObjectTracker::ObjectTracker(const config::TrackerConfig &config)
+    : config_{config}
+{
+    LOG_TRA("");
+}
+
+void ObjectTracker::AxisFilter::predict(double dt, double accel_var)
+{
+    // x' = F x, P' = F P F^T + Q (연속 백색 가속도 잡음)
+    position += velocity * dt;
+    p00 += dt * (2.0 * p01 + dt * p11) + accel_var * dt * dt * dt / 3.0;
+    p01 += dt * p11 + accel_var * dt * dt / 2.0;
+    p11 += accel_var * dt;
+}
+
+void ObjectTracker::AxisFilter::correct(double measurement, double measurement_var)
+{
+    const double s = p00 + measurement_var;
+    const double k0 = p00 / s;
+    const double k1 = p01 / s;
+    const double innovation = measurement - position;
+    position += k0 * innovation;
+    velocity += k1 * innovation;
+    p11 -= k1 * p01;
+    p01 *= 1.0 - k0;
+    p00 *= 1.0 - k0;
+}
+
+const domain::model::DetectionBuffer &ObjectTracker::update(const std::vector<domain::model::Detection> &detections, uint64_t timestamp_ms)
+{
+    // 1. 모든 트랙을 탐지 시점으로 예측
+    const double accel_var = static_cast<double>(config_.accelerationNoise) * config_.accelerationNoise;
+    for (auto &track : tracks_)
+    {
+        const double dt = elapsedSeconds(track.time_ms, timestamp_ms);
+        for (auto &axis : track.axes)
+        {
+            axis.predict(dt, accel_var);
+        }
+        track.time_ms = std::max(track.time_ms, timestamp_ms);
+        track.matched = false;
+    }
+
+    // 2. 높은 점수 탐지 -> 전체 트랙, 낮은 점수 탐지 -> 남은 트랙 순서로 매칭
+    high_.clear();
+    low_.clear();
+    for (size_t i = 0; i < detections.size(); ++i)
+    {
+        (detections[i].confidence >= config_.highScoreThreshold ? high_ : low_).push_back(static_cast<int>(i));
+    }
+    this->associate(detections, high_, timestamp_ms);
+    this->associate(detections, low_, timestamp_ms);
+
+    // 3. 매칭되지 않은 트랙 정리: 미확정 트랙은 바로, 확정 트랙은 maxAgeMs 동안 예측으로 유지
+    tracks_.erase(std::remove_if(tracks_.begin(), tracks_.end(), [&](const Track &track)
+                                 { return !track.matched && (!isConfirmed(track) || timestamp_ms > track.last_hit_ms + config_.maxAgeMs); }),
+                  tracks_.end());
+
+    // 4. 매칭되지 않은 높은 점수 탐지로 새 트랙 생성
+    for (int index : high_)
+    {
+        if (detections[index].confidence >= config_.newTrackThreshold)
+        {
+            this->addTrack(detections[index], timestamp_ms);
+        }
+    }
+
+    this->predict(timestamp_ms, output_);
+    return output_;
+}
+
+void ObjectTracker::predict(uint64_t timestamp_ms, domain::model::DetectionBuffer &tracks) const
+{
+    tracks.clear();
+    for (const auto &track : tracks_)
+    {
+        if (isConfirmed(track) && timestamp_ms <= track.last_hit_ms + config_.maxAgeMs)
+        {
+            tracks.push_back(this->toDetection(track, timestamp_ms));
+        }
+    }
+}
+
+void ObjectTracker::associate(const std::vector<domain::model::Detection> &detections, std::vector<int> &detection_indices, uint64_t timestamp_ms)
+{
+    candidates_.clear();
+    for (size_t i = 0; i < tracks_.size(); ++i)
+    {
+        if (!tracks_[i].matched)
+        {
+            candidates_.push_back(static_cast<int>(i));
+        }
+    }
+    if (candidates_.empty() || detection_indices.empty())
+    {
+        return;
+    }
+
+    // 비용 = 1 - IoU (다른 클래스는 매칭 불가)
+    const int rows = static_cast<int>(candidates_.size());
+    const int cols = static_cast<int>(detection_indices.size());
+    cost_.assign(static_cast<size_t>(rows) * cols, 1.0f);
+    for (int r = 0; r < rows; ++r)
+    {
+        const auto &track = tracks_[candidates_[r]];
+        const auto predicted = this->toDetection(track, track.time_ms).bbox;
+        for (int c = 0; c < cols; ++c)
+        {
+            const auto &detection = detections[detection_indices[c]];
+            if (detection.class_id == track.class_id)
+            {
+                cost_[static_cast<size_t>(r) * cols + c] = 1.0f - iou(predicted, detection.bbox);
+            }
+        }
+    }
+    solver_.solve(cost_, rows, cols, assignment_);
+
+    for (int r = 0; r < rows; ++r)
+    {
+        const int c = assignment_[r];
+        if (c < 0 || 1.0f - cost_[static_cast<size_t>(r) * cols + c] < config_.matchIou)
+        {
+            continue;
+        }
+        this->correct(tracks_[candidates_[r]], detections[detection_indices[c]], timestamp_ms);
+        detection_indices[c] = -1;
+    }
+    detection_indices.erase(std::remove(detection_indices.begin(), detection_indices.end(), -1), detection_indices.end());
+}
+
+void ObjectTracker::correct(Track &track, const domain::model::Detection &detection, uint64_t timestamp_ms) const
+{
+    const double measurement_var = static_cast<double>(config_.measurementNoise) * config_.measurementNoise;
+    const auto &box = detection.bbox;
+    const double measurements[4] = {box.x + 0.5 * box.width, box.y + 0.5 * box.height, box.width, box.height};
+    for (int i = 0; i < 4; ++i)
+    {
+        track.axes[i].correct(measurements[i], measurement_var);
+    }
+    track.confidence = detection.confidence;
+    track.last_hit_ms = timestamp_ms;
+    ++track.hits;
+    track.matched = true;
+}
+
+void ObjectTracker::addTrack(const domain::model::Detection &detection, uint64_t timestamp_ms)
+{
+    const double measurement_var = static_cast<double>(config_.measurementNoise) * config_.measurementNoise;
+    const auto &box = detection.bbox;
+    const double measurements[4] = {box.x + 0.5 * box.width, box.y + 0.5 * box.height, box.width, box.height};
+
+    Track track;
+    track.id = next_id_++;
+    track.class_id = detection.class_id;
+    track.confidence = detection.confidence;
+    track.model = detection.model;
+    for (int i = 0; i < 4; ++i)
+    {
+        track.axes[i].position = measurements[i];
+        track.axes[i].p00 = measurement_var;
+        track.axes[i].p11 = kInitialVelocityStd * kInitialVelocityStd;
+    }
+    track.time_ms = timestamp_ms;
+    track.last_hit_ms = timestamp_ms;
+    track.hits = 1;
+    track.matched = true;
+    tracks_.push_back(std::move(track));
+}
+
+domain::model::Detection ObjectTracker::toDetection(const Track &track, uint64_t timestamp_ms) const
+{
+    const double dt = elapsedSeconds(track.time_ms, timestamp_ms);
+    const auto extrapolate = [&](const AxisFilter &axis)
+    { return static_cast<float>(axis.position + axis.velocity * dt); };
+
+    const float cx = extrapolate(track.axes[0]);
+    const float cy = extrapolate(track.axes[1]);
+    const float w = std::max(1.0f, extrapolate(track.axes[2]));
+    const float h = std::max(1.0f, extrapolate(track.axes[3]));
+
+    domain::model::Detection detection{track.class_id, track.confidence, {cx - 0.5f * w, cy - 0.5f * h, w, h}};
+    detection.track_id = track.id;
+    detection.model = track.model;
+    detection.velocity_x = static_cast<float>(track.axes[0].velocity);
+    detection.velocity_y = static_cast<float>(track.axes[1].velocity);
+    return detection;
+}
+
+} // namespace vp::service
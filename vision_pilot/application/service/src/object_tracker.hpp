@@ -0,0 +1,81 @@
+#pragma once
+
+#include "detection_buffer.hpp"
+#include "hungarian_solver.hpp"
+#include "service_config.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace vp::service
+{
+
+/**
+ * @brief 탐지 결과에 지속 ID 를 부여하는 다중 객체 추적기 (SORT/ByteTrack 방식)
+ *
+ * 트랙마다 박스 중심/크기를 축별 등속 칼만 필터로 추정하고, 예측 박스와 탐지 박스의 IoU 를
+ * Hungarian 할당으로 매칭한다. 높은 점수 탐지를 먼저 매칭한 뒤 남은 트랙을 낮은 점수 탐지와 한 번 더 매칭한다.
+ * 탐지가 없는 프레임에는 predict() 로 마지막 상태를 외삽하여 출력하므로 출력 주기가 탐지 주기와 분리된다.
+ * 스레드 안전하지 않으므로 호출자가 동기화해야 한다.
+ */
+class ObjectTracker
+{
+public:
+    explicit ObjectTracker(const config::TrackerConfig &config);
+
+    // timestamp_ms 시점 탐지 결과로 트랙 갱신. 반환: 같은 시점의 출력 대상 트랙 (다음 update 전까지 유효)
+    const domain::model::DetectionBuffer &update(const std::vector<domain::model::Detection> &detections, uint64_t timestamp_ms);
+
+    // 상태를 바꾸지 않고 timestamp_ms 시점으로 외삽한 출력 대상 트랙
+    void predict(uint64_t timestamp_ms, domain::model::DetectionBuffer &tracks) const;
+
+    size_t trackCount() const { return tracks_.size(); }
+
+private:
+    // 등속 모델 1차원 칼만 필터 (위치, 속도)
+    struct AxisFilter
+    {
+        double position = 0.0;
+        double velocity = 0.0;
+        double p00 = 0.0; // 공분산 [위치, 속도]
+        double p01 = 0.0;
+        double p11 = 0.0;
+
+        void predict(double dt, double accel_var);
+        void correct(double measurement, double measurement_var);
+    };
+
+    struct Track
+    {
+        int32_t id = 0;
+        domain::model::ClassId class_id = domain::model::ClassId::UNKNOWN;
+        float confidence = 0.0f;
+        uint8_t model = 0;        // 트랙을 만든 탐지 모델
+        AxisFilter axes[4];       // 중심 x, 중심 y, 폭, 높이
+        uint64_t time_ms = 0;     // 필터 상태 시점
+        uint64_t last_hit_ms = 0; // 마지막 매칭 시점
+        uint32_t hits = 0;
+        bool matched = false; // 이번 갱신에서 매칭됨
+    };
+
+    void associate(const std::vector<domain::model::Detection> &detections, std::vector<int> &detection_indices, uint64_t timestamp_ms);
+    void correct(Track &track, const domain::model::Detection &detection, uint64_t timestamp_ms) const;
+    void addTrack(const domain::model::Detection &detection, uint64_t timestamp_ms);
+    domain::model::Detection toDetection(const Track &track, uint64_t timestamp_ms) const;
+    bool isConfirmed(const Track &track) const { return track.hits >= config_.minHits; }
+
+    const config::TrackerConfig config_;
+
+    std::vector<Track> tracks_;
+    int32_t next_id_ = 1;
+
+    // 매칭 버퍼 (호출마다 재사용)
+    HungarianSolver solver_;
+    std::vector<float> cost_;
+    std::vector<int> assignment_;
+    std::vector<int> candidates_;
+    std::vector<int> high_;
+    std::vector<int> low_;
+    domain::model::DetectionBuffer output_;
+};
+
+} // namespace vp::service
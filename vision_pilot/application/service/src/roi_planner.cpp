@@ -0,0 +1,147 @@
+#include "roi_planner.hpp"
+#include "gaia_log.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+using vp::domain::model::BoundingBox;
+
+bool overlaps(const BoundingBox &a, const BoundingBox &b)
+{
+    return a.x < b.x + b.width && b.x < a.x + a.width && a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+BoundingBox unite(const BoundingBox &a, const BoundingBox &b)
+{
+    const float x1 = std::min(a.x, b.x);
+    const float y1 = std::min(a.y, b.y);
+    const float x2 = std::max(a.x + a.width, b.x + b.width);
+    const float y2 = std::max(a.y + a.height, b.y + b.height);
+    return {x1, y1, x2 - x1, y2 - y1};
+}
+
+// 중심을 유지한 채 [min_size, limit] 로 맞춘 구간 시작점과 길이
+void fitRange(float center, float size, float min_size, float limit, float &begin, float &length)
+{
+    length = std::min(std::max(size, min_size), limit);
+    begin = std::min(std::max(center - 0.5f * length, 0.0f), limit - length);
+}
+} // namespace
+
+namespace vp::service
+{
+
+RoiPlanner::RoiPlanner(const config::RoiDetectionConfig &config)
+    : config_{config}
+{
+    LOG_TRA("");
+}
+
+const RoiPlan &RoiPlanner::plan(const domain::model::Pose &pose, int frame_w, int frame_h)
+{
+    plan_.full_frame = !this->planRegions(pose, frame_w, frame_h);
+    if (plan_.full_frame)
+    {
+        plan_.regions.clear();
+    }
+    return plan_;
+}
+
+void RoiPlanner::update(const domain::model::Pose &pose, const std::vector<domain::model::Detection> &detections, bool full_frame)
+{
+    previous_boxes_.clear();
+    for (const auto &detection : detections)
+    {
+        previous_boxes_.push_back(detection.bbox);
+    }
+    previous_pose_ = pose;
+    has_previous_ = true;
+    roi_count_ = full_frame ? 0 : roi_count_ + 1;
+}
+
+double RoiPlanner::rotationAngle(const domain::model::Pose &a, const domain::model::Pose &b)
+{
+    // 상대 회전 q_a^-1 * q_b 의 회전각 = 2 * acos(|<q_a, q_b>|)
+    const double norm = std::sqrt((a.qw * a.qw + a.qx * a.qx + a.qy * a.qy + a.qz * a.qz) *
+                                  (b.qw * b.qw + b.qx * b.qx + b.qy * b.qy + b.qz * b.qz));
+    if (norm <= 0.0)
+    {
+        return 0.0;
+    }
+    const double dot = std::abs(a.qw * b.qw + a.qx * b.qx + a.qy * b.qy + a.qz * b.qz) / norm;
+    return 2.0 * std::acos(std::min(1.0, dot));
+}
+
+bool RoiPlanner::planRegions(const domain::model::Pose &pose, int frame_w, int frame_h)
+{
+    // 새로 나타난 객체를 놓치지 않도록 주기적으로, 또는 근거가 없으면 전체 프레임
+    if (!config_.enable || !has_previous_ || previous_boxes_.empty() || frame_w <= 0 || frame_h <= 0 ||
+        pose.is_lost || previous_pose_.is_lost || roi_count_ >= config_.fullFrameInterval)
+    {
+        return false;
+    }
+
+    const double rotation = rotationAngle(previous_pose_, pose);
+    if (rotation > config_.maxRotationRad)
+    {
+        return false;
+    }
+    const double dx = pose.x - previous_pose_.x;
+    const double dy = pose.y - previous_pose_.y;
+    const double dz = pose.z - previous_pose_.z;
+    const auto translation = static_cast<float>(std::sqrt(dx * dx + dy * dy + dz * dz));
+
+    // 카메라 좌표계와 객체 거리를 모르므로 이동 방향 없이 모든 방향으로 같은 양만큼 넓힘
+    const auto shift = static_cast<float>(config_.focalLengthPx * rotation);
+    const float ratio = config_.expandRatio + config_.translationGain * translation;
+    const auto width = static_cast<float>(frame_w);
+    const auto height = static_cast<float>(frame_h);
+    plan_.regions.clear();
+    for (const auto &box : previous_boxes_)
+    {
+        BoundingBox region;
+        fitRange(box.x + 0.5f * box.width, box.width * (1.0f + 2.0f * ratio) + 2.0f * shift, config_.minRoiSize, width, region.x, region.width);
+        fitRange(box.y + 0.5f * box.height, box.height * (1.0f + 2.0f * ratio) + 2.0f * shift, config_.minRoiSize, height, region.y, region.height);
+        plan_.regions.push_back(region);
+    }
+    this->mergeOverlapping();
+
+    float area = 0.0f;
+    for (const auto &region : plan_.regions)
+    {
+        area += region.width * region.height;
+    }
+    if (plan_.regions.size() > config_.maxRois || area > config_.maxAreaRatio * width * height)
+    {
+        LOG_DBG("ROI detection skipped (regions: {}, area ratio: {:.2f}).", plan_.regions.size(), area / (width * height));
+        return false;
+    }
+    return true;
+}
+
+void RoiPlanner::mergeOverlapping()
+{
+    // 겹치는 영역을 더 이상 없을 때까지 합침 (영역 수가 적으므로 단순 반복)
+    auto &regions = plan_.regions;
+    bool merged = true;
+    while (merged)
+    {
+        merged = false;
+        for (size_t i = 0; i < regions.size() && !merged; ++i)
+        {
+            for (size_t j = i + 1; j < regions.size(); ++j)
+            {
+                if (overlaps(regions[i], regions[j]))
+                {
+                    regions[i] = unite(regions[i], regions[j]);
+                    regions.erase(regions.begin() + static_cast<std::ptrdiff_t>(j));
+                    merged = true;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+} // namespace vp::service
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "detection.hpp"
+#include "pose.hpp"
+#include "service_config.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace vp::service
+{
+
+struct RoiPlan
+{
+    bool full_frame = true;                          // true: 전체 프레임 탐지
+    std::vector<domain::model::BoundingBox> regions; // full_frame == false 일 때 탐지 영역 (Top-Left 기준)
+};
+
+/**
+ * @brief 이전 탐지 결과와 자세 변화로 다음 탐지 영역(ROI)을 결정
+ *
+ * 마지막 탐지 이후의 회전각과 이동 거리만큼 이전 박스를 넓혀 탐지 영역으로 사용한다.
+ * 회전은 focalLengthPx 로 화면 이동량으로 환산하고, 이동은 거리를 알 수 없으므로 박스 크기에 비례해 넓힌다.
+ * 자세를 잃었거나, 움직임이 크거나, 영역이 너무 많거나 넓으면 전체 프레임 탐지로 돌아간다.
+ * 스레드 안전하지 않으므로 호출자가 동기화해야 한다.
+ */
+class RoiPlanner
+{
+public:
+    explicit RoiPlanner(const config::RoiDetectionConfig &config);
+
+    // 탐지 직전에 호출
+    const RoiPlan &plan(const domain::model::Pose &pose, int frame_w, int frame_h);
+
+    // 탐지 직후 호출. full_frame: 이번 탐지가 전체 프레임 탐지였는지
+    void update(const domain::model::Pose &pose, const std::vector<domain::model::Detection> &detections, bool full_frame);
+
+    // 두 자세 사이의 회전각 (rad)
+    static double rotationAngle(const domain::model::Pose &a, const domain::model::Pose &b);
+
+private:
+    bool planRegions(const domain::model::Pose &pose, int frame_w, int frame_h);
+    void mergeOverlapping();
+
+    const config::RoiDetectionConfig config_;
+
+    RoiPlan plan_;
+    std::vector<domain::model::BoundingBox> previous_boxes_; // 마지막 탐지 결과
+    domain::model::Pose previous_pose_;                      // 마지막 탐지 시점 자세
+    bool has_previous_ = false;
+    uint32_t roi_count_ = 0; // 마지막 전체 프레임 탐지 이후 영역 탐지 횟수
+};
+
+} // namespace vp::service
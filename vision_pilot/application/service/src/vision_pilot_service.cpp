@@ -6,8 +6,9 @@
 
 namespace vp::service
 {
-VisionPilotService::VisionPilotService(vp::port::out::LocalizationPort &localization_port, vp::port::out::VisualizationPort &visualization_port, vp::port::out::ObjectDetectionPort &object_detection_port)
-    : impl_(std::make_unique<VisionPilotServiceImpl>(localization_port, visualization_port, object_detection_port))
+VisionPilotService::VisionPilotService(vp::port::out::LocalizationPort &localization_port, vp::port::out::VisualizationPort &visualization_port, vp::port::out::ObjectDetectionPort &object_detection_port,
+                                       const config::VisionPilotServiceConfig &config, vp::port::out::ResultSinkPort *result_sink)
+    : impl_(std::make_unique<VisionPilotServiceImpl>(localization_port, visualization_port, object_detection_port, config, result_sink))
 {
     LOG_TRA("");
 }
@@ -21,4 +22,14 @@ void VisionPilotService::onFrameReceived(const domain::model::ImagePacket &frame
 {
     impl_->onFrameReceived(frame);
 }
+
+void VisionPilotService::flush()
+{
+    impl_->flush();
+}
+
+domain::model::LatencyReport VisionPilotService::getLatencyReport() const
+{
+    return impl_->getLatencyReport();
+}
 } // namespace vp::service
\ No newline at end of file
@@ -1,21 +1,88 @@
 #include "vision_pilot_service_impl.hpp"
+#include "gaia_cpu_affinity.hpp"
 #include "gaia_log.hpp"
+#include "gaia_trace.hpp"
 #include "vision_pilot_service.hpp"
+#include <algorithm>
+#include <type_traits>
+#include <variant>
+
+namespace
+{
+// 탐지 대상 이미지(스테레오는 왼쪽) 크기
+bool frameSize(const vp::domain::model::ImagePacket &packet, int &width, int &height)
+{
+    const auto &raw = std::visit([](auto &&arg) -> const vp::domain::model::RawImage &
+                                 {
+        using T = std::decay_t<decltype(arg)>;
+        if constexpr (std::is_same_v<T, vp::domain::model::MonoImagePacket>)
+        {
+            return arg.frame;
+        }
+        else
+        {
+            return arg.left;
+        } }, packet.payload);
+    width = raw.width;
+    height = raw.height;
+    return width > 0 && height > 0;
+}
+} // namespace
 
 namespace vp::service
 {
 
 VisionPilotServiceImpl::VisionPilotServiceImpl(vp::port::out::LocalizationPort &localization_port,
                                                vp::port::out::VisualizationPort &visualization_port,
-                                               vp::port::out::ObjectDetectionPort &object_detection_port)
+                                               vp::port::out::ObjectDetectionPort &object_detection_port,
+                                               const config::VisionPilotServiceConfig &config,
+                                               vp::port::out::ResultSinkPort *result_sink)
     : localization_port_{localization_port},
       visualization_port_{visualization_port},
-      object_detection_port_{object_detection_port}
+      object_detection_port_{object_detection_port},
+      result_sink_{result_sink},
+      config_{config},
+      detection_scheduler_{config_.detectionScheduler, object_detection_port.supportsLevel(vp::port::out::DetectionLevel::REDUCED)},
+      roi_planner_{config_.roiDetection},
+      tracker_{config_.tracker},
+      latency_monitor_{config_.latencyLogIntervalMs}
 {
     LOG_TRA("Starting VisionPilot Service...");
 
     is_running_ = true;
-    detection_thread_ = std::thread(&VisionPilotServiceImpl::detectionLoop, this);
+    if (config_.processingMode == config::ProcessingMode::BATCH)
+    {
+        if (config_.asyncDetectionDepth > 0)
+        {
+            LOG_INF("VisionPilot Service running in batch mode (queue size: {}, async detection depth: {}).", config_.batchQueueSize, config_.asyncDetectionDepth);
+            detection_thread_ = std::thread(&VisionPilotServiceImpl::asyncDetectionLoop, this);
+        }
+        else
+        {
+            LOG_INF("VisionPilot Service running in batch mode (queue size: {}, detection batch: {}).", config_.batchQueueSize, config_.detectionBatchSize);
+            detection_thread_ = std::thread(&VisionPilotServiceImpl::orderedDetectionLoop, this);
+        }
+    }
+    else if (config_.processingMode == config::ProcessingMode::DETERMINISTIC)
+    {
+        LOG_INF("VisionPilot Service running in deterministic mode (detection stride: {}, {}).",
+                config_.deterministic.detectionStride, config_.deterministic.singleThread ? "single thread" : "pipelined");
+        if (!config_.deterministic.singleThread)
+        {
+            detection_thread_ = std::thread(&VisionPilotServiceImpl::orderedDetectionLoop, this);
+        }
+    }
+    else
+    {
+        detection_thread_ = std::thread(&VisionPilotServiceImpl::detectionLoop, this);
+    }
+
+    if (detection_thread_.joinable() && config_.detectionAffinity.enable)
+    {
+        LOG_INF("Detection thread affinity: CPU {} ~ {}", config_.detectionAffinity.cpu_index,
+                config_.detectionAffinity.cpu_index + std::max<uint32_t>(config_.detectionAffinity.cpu_count, 1) - 1);
+        setCpuAffinity(detection_thread_, config_.detectionAffinity);
+    }
 }
 
 VisionPilotServiceImpl::~VisionPilotServiceImpl()
@@ -28,38 +95,292 @@ VisionPilotServiceImpl::~VisionPilotServiceImpl()
         new_frame_available_ = true; // 자고 있는 스레드를 깨우기 위해 true 설정
     }
     detection_cv_.notify_all(); // 스레드 깨움
+    ordered_space_cv_.notify_all();
 
     if (detection_thread_.joinable())
     {
         detection_thread_.join();
     }
+
+    if (truncated_frames_ > 0)
+    {
+        LOG_WRN("{} frames had results truncated to {} entries.", truncated_frames_, domain::model::DetectionBuffer::kCapacity);
+    }
 }
 
 void VisionPilotServiceImpl::onFrameReceived(const domain::model::ImagePacket &frame)
 {
-    auto pose = localization_port_.update(frame, frame.timestamp);
+    using domain::model::PipelineStage;
+    using domain::model::TracePoint;
+
+    if (config_.processingMode == config::ProcessingMode::BATCH)
+    {
+        this->enqueueBatchFrame(frame);
+        return;
+    }
+    if (config_.processingMode == config::ProcessingMode::DETERMINISTIC)
+    {
+        this->processDeterministicFrame(frame);
+        return;
+    }
+
+    // 입력 프레임은 const 이므로 트레이스만 복사해서 기록
+    auto trace = frame.trace;
+
+    trace.mark(TracePoint::LOCALIZATION_BEGIN);
+    auto pose = [&]
+    {
+        TRACE_SCOPE("localization.update");
+        return localization_port_.update(frame, frame.timestamp);
+    }();
+    trace.mark(TracePoint::LOCALIZATION_END);
+
+    const auto localization_begin_us = trace.at(TracePoint::LOCALIZATION_BEGIN) / 1000;
+    const auto localization_end_us = trace.at(TracePoint::LOCALIZATION_END) / 1000;
 
+    bool detect = false;
     {
         std::lock_guard<std::mutex> lock(data_mutex_);
-        latest_frame_ = frame; // 최신 프레임 덮어쓰기 (큐가 아님! 이전거 버림)
-        new_frame_available_ = true;
+        detection_scheduler_.reportLocalization(localization_end_us, localization_end_us - localization_begin_us);
+
+        auto decision = detection_scheduler_.decide(localization_end_us, detection_busy_);
+        if (decision.action == DetectionAction::DETECT)
+        {
+            latest_frame_ = frame; // 최신 프레임 덮어쓰기 (큐가 아님! 이전거 버림)
+            latest_frame_->trace = trace;
+            latest_frame_->trace.mark(TracePoint::DETECTION_QUEUED);
+            pending_level_ = decision.level;
+            pending_pose_ = pose;
+            new_frame_available_ = true;
+            detect = true;
+        }
+    }
+    if (detect)
+    {
+        detection_cv_.notify_one(); // 자고 있는 탐지기 깨우기
+    }
+
+    domain::model::DetectionBuffer current_detections;
+    {
+        std::lock_guard<std::mutex> lock(data_mutex_);
+        this->currentDetections(this->trackerTime(frame), current_detections); // 가장 최근 결과 복사 (추적 시 현재 시점 예측)
+    }
+
+    trace.mark(TracePoint::RENDER_BEGIN);
+    {
+        TRACE_SCOPE("visualization.render");
+        visualization_port_.render(pose, current_detections, frame);
+    }
+    trace.mark(TracePoint::RENDER_END);
+
+    latency_monitor_.record(PipelineStage::QUEUE, trace, TracePoint::ENQUEUED, TracePoint::DEQUEUED);
+    latency_monitor_.record(PipelineStage::LOCALIZATION, trace, TracePoint::LOCALIZATION_BEGIN, TracePoint::LOCALIZATION_END);
+    latency_monitor_.record(PipelineStage::RENDER, trace, TracePoint::RENDER_BEGIN, TracePoint::RENDER_END);
+    latency_monitor_.record(PipelineStage::END_TO_END, trace,
+                            trace.has(TracePoint::CAPTURED) ? TracePoint::CAPTURED : TracePoint::LOCALIZATION_BEGIN,
+                            TracePoint::RENDER_END);
+    latency_monitor_.logIfDue(trace.at(TracePoint::RENDER_END));
+}
+
+VisionPilotServiceImpl::OrderedItem VisionPilotServiceImpl::localizeFrame(const domain::model::ImagePacket &frame)
+{
+    using domain::model::PipelineStage;
+    using domain::model::TracePoint;
+
+    OrderedItem item{frame, {}, 0};
+    auto &trace = item.frame.trace;
+
+    trace.mark(TracePoint::LOCALIZATION_BEGIN);
+    {
+        TRACE_SCOPE("localization.update");
+        item.pose = localization_port_.update(item.frame, this->frameTime(item.frame));
     }
-    detection_cv_.notify_one(); // 자고 있는 탐지기 깨우기
+    trace.mark(TracePoint::LOCALIZATION_END);
+    trace.elapsedUs(TracePoint::LOCALIZATION_BEGIN, TracePoint::LOCALIZATION_END, item.localization_us);
 
-    std::vector<domain::model::Detection> current_detections;
+    latency_monitor_.record(PipelineStage::QUEUE, trace, TracePoint::ENQUEUED, TracePoint::DEQUEUED);
+    latency_monitor_.record(PipelineStage::LOCALIZATION, item.localization_us);
+    return item;
+}
+
+void VisionPilotServiceImpl::enqueueBatchFrame(const domain::model::ImagePacket &frame)
+{
+    auto item = this->localizeFrame(frame);
+
+    {
+        // 탐지가 밀리면 여기서 대기 -> 라우터/이벤트 큐(BLOCK)를 거쳐 로더까지 역압이 전달됨
+        std::unique_lock<std::mutex> lock(data_mutex_);
+        ordered_space_cv_.wait(lock, [this]
+                               { return !is_running_ || ordered_queue_.size() < config_.batchQueueSize; });
+        if (!is_running_)
+        {
+            LOG_WRN("Service stopped. Frame {} is not processed.", frame.frame_id);
+            return;
+        }
+
+        item.frame.trace.mark(domain::model::TracePoint::DETECTION_QUEUED);
+        ordered_queue_.push_back(std::move(item));
+    }
+    detection_cv_.notify_one();
+}
+
+void VisionPilotServiceImpl::processDeterministicFrame(const domain::model::ImagePacket &frame)
+{
+    using domain::model::PipelineStage;
+    using domain::model::TracePoint;
+
+    if (has_last_frame_id_ && frame.frame_id <= last_frame_id_)
+    {
+        LOG_WRN("Frame id is not increasing ({} -> {}). Replay order may differ between runs.", last_frame_id_, frame.frame_id);
+    }
+    last_frame_id_ = frame.frame_id;
+    has_last_frame_id_ = true;
+
+    auto item = this->localizeFrame(frame);
+
+    // 이전 프레임들의 탐지가 모두 끝난 뒤 렌더링 -> 프레임 N 은 항상 N 이전 탐지 결과로 그려짐
+    domain::model::DetectionBuffer current_detections;
+    {
+        std::unique_lock<std::mutex> lock(data_mutex_);
+        idle_cv_.wait(lock, [this]
+                      { return ordered_queue_.empty() && !detection_busy_; });
+        this->currentDetections(this->trackerTime(frame), current_detections);
+    }
+
+    auto &trace = item.frame.trace;
+    trace.mark(TracePoint::RENDER_BEGIN);
+    {
+        TRACE_SCOPE("visualization.render");
+        visualization_port_.render(item.pose, current_detections, item.frame);
+    }
+    trace.mark(TracePoint::RENDER_END);
+    latency_monitor_.record(PipelineStage::RENDER, trace, TracePoint::RENDER_BEGIN, TracePoint::RENDER_END);
+
+    const auto stride = config_.deterministic.detectionStride;
+    if (stride == 0 || frame.frame_id % stride != 0)
+    {
+        if (result_sink_ != nullptr)
+        {
+            domain::model::FrameResult result;
+            result.frame_id = frame.frame_id;
+            result.timestamp = this->frameTime(frame);
+            result.pose = item.pose;
+            result.localization_us = item.localization_us;
+            result.detected = false;
+            if (config_.tracker.enable)
+            {
+                // 탐지를 건너뛴 프레임은 렌더링과 같은 트랙 예측 결과를 출력
+                result.detections.assign(current_detections.begin(), current_detections.end());
+            }
+            result_sink_->publish(result);
+        }
+        return;
+    }
+
+    trace.mark(TracePoint::DETECTION_QUEUED);
+    if (config_.deterministic.singleThread)
     {
+        std::vector<OrderedItem> items;
+        items.push_back(std::move(item));
+        this->completeDetections(items);
+        return;
+    }
+
+    {
+        // 탐지는 다음 프레임의 위치 추정과 겹쳐서 수행
         std::lock_guard<std::mutex> lock(data_mutex_);
-        current_detections = latest_results_; // 가장 최근 결과 복사
+        ordered_queue_.push_back(std::move(item));
+    }
+    detection_cv_.notify_one();
+}
+
+void VisionPilotServiceImpl::flush()
+{
+    {
+        std::unique_lock<std::mutex> lock(data_mutex_);
+        idle_cv_.wait(lock, [this]
+                      { return ordered_queue_.empty() && !detection_busy_; });
+    }
+
+    if (result_sink_ != nullptr)
+    {
+        result_sink_->flush();
+    }
+}
+
+domain::model::LatencyReport VisionPilotServiceImpl::getLatencyReport() const
+{
+    return latency_monitor_.report();
+}
+
+uint64_t VisionPilotServiceImpl::frameTime(const domain::model::ImagePacket &frame) const
+{
+    // source_time 은 ms, timestamp 는 us
+    return config_.processingMode == config::ProcessingMode::REALTIME ? frame.timestamp : frame.source_time * 1000;
+}
+
+uint64_t VisionPilotServiceImpl::trackerTime(const domain::model::ImagePacket &frame) const
+{
+    return this->frameTime(frame) / 1000;
+}
+
+void VisionPilotServiceImpl::currentDetections(uint64_t timestamp, domain::model::DetectionBuffer &detections) const
+{
+    if (!config_.tracker.enable)
+    {
+        detections = latest_results_;
+        return;
+    }
+    TRACE_SCOPE("tracker.predict");
+    tracker_.predict(timestamp, detections);
+}
+
+void VisionPilotServiceImpl::noteTruncated(uint64_t frame_id, bool truncated)
+{
+    if (!truncated)
+    {
+        return;
+    }
+    // 처음 한 번과 이후 100 프레임마다 경고
+    if (truncated_frames_++ % 100 == 0)
+    {
+        LOG_WRN("Frame {}: results exceed {} entries and are truncated ({} frames so far). Lower maxDetections or the number of registry models.",
+                frame_id, domain::model::DetectionBuffer::kCapacity, truncated_frames_);
+    }
+}
+
+std::vector<domain::model::Detection> VisionPilotServiceImpl::runDetection(domain::model::ImagePacket &frame, vp::port::out::DetectionLevel level, uint64_t &elapsed_us,
+                                                                          const std::vector<domain::model::BoundingBox> *regions)
+{
+    using domain::model::PipelineStage;
+    using domain::model::TracePoint;
+
+    auto &trace = frame.trace;
+    trace.mark(TracePoint::DETECTION_BEGIN);
+    std::vector<domain::model::Detection> detections;
+    {
+        TRACE_SCOPE("detection.infer");
+        detections = regions == nullptr ? object_detection_port_.detectObject(frame, level)
+                                        : object_detection_port_.detectObjectInRegions(frame, *regions, level);
     }
+    trace.mark(TracePoint::DETECTION_END);
 
-    visualization_port_.render(pose, current_detections, frame);
+    elapsed_us = 0;
+    trace.elapsedUs(TracePoint::DETECTION_BEGIN, TracePoint::DETECTION_END, elapsed_us);
+    latency_monitor_.record(PipelineStage::DETECTION_WAIT, trace, TracePoint::DETECTION_QUEUED, TracePoint::DETECTION_BEGIN);
+    latency_monitor_.record(PipelineStage::DETECTION, elapsed_us);
+    return detections;
 }
 
 void VisionPilotServiceImpl::detectionLoop()
 {
+    TRACE_THREAD_NAME("detection");
+
     while (is_running_)
     {
         domain::model::ImagePacket frame_to_process;
+        domain::model::Pose pose;
+        auto level = vp::port::out::DetectionLevel::FULL;
 
         {
             std::unique_lock<std::mutex> lock(data_mutex_);
@@ -76,7 +397,10 @@ void VisionPilotServiceImpl::detectionLoop()
             if (latest_frame_.has_value())
             {
                 frame_to_process = latest_frame_.value();
+                level = pending_level_;
+                pose = pending_pose_;
                 new_frame_available_ = false; // 처리 시작하니까 플래그 내림
+                detection_busy_ = true;
             }
             else
             {
@@ -84,13 +408,250 @@ void VisionPilotServiceImpl::detectionLoop()
             }
         }
 
-        auto detections = object_detection_port_.detectObject(frame_to_process);
+        // 이전 결과 주변만 탐지할 수 있으면 영역 탐지, 아니면 전체 프레임
+        const RoiPlan *roi_plan = nullptr;
+        int frame_w = 0;
+        int frame_h = 0;
+        if (config_.roiDetection.enable && frameSize(frame_to_process, frame_w, frame_h))
+        {
+            roi_plan = &roi_planner_.plan(pose, frame_w, frame_h);
+        }
+        const bool full_frame = roi_plan == nullptr || roi_plan->full_frame;
+
+        uint64_t inference_elapsed_us = 0;
+        auto detections = this->runDetection(frame_to_process, level, inference_elapsed_us, full_frame ? nullptr : &roi_plan->regions);
+        if (roi_plan != nullptr)
+        {
+            roi_planner_.update(pose, detections, full_frame);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(data_mutex_);
+            bool truncated = false;
+            if (config_.tracker.enable)
+            {
+                TRACE_SCOPE("tracker.update");
+                truncated = tracker_.update(detections, this->trackerTime(frame_to_process)).truncated();
+            }
+            truncated |= !latest_results_.assign(detections.begin(), detections.end());
+            this->noteTruncated(frame_to_process.frame_id, truncated);
+            detection_scheduler_.reportInference(level, inference_elapsed_us);
+            detection_busy_ = false;
+        }
+        idle_cv_.notify_all();
+    }
+}
+
+void VisionPilotServiceImpl::orderedDetectionLoop()
+{
+    TRACE_THREAD_NAME("detection");
+
+    // BATCH 모드에서는 대기 중인 프레임을 최대 detectionBatchSize 장까지 한 번에 탐지
+    const size_t max_batch = config_.processingMode == config::ProcessingMode::BATCH ? std::max<size_t>(1, config_.detectionBatchSize) : 1;
+    std::vector<OrderedItem> items;
+    items.reserve(max_batch);
+
+    while (true)
+    {
+        items.clear();
+        {
+            std::unique_lock<std::mutex> lock(data_mutex_);
+            detection_cv_.wait(lock, [this]
+                               { return !is_running_ || !ordered_queue_.empty(); });
+
+            // 종료 요청 후에도 이미 들어온 프레임은 모두 처리
+            if (ordered_queue_.empty())
+            {
+                break;
+            }
+
+            while (!ordered_queue_.empty() && items.size() < max_batch)
+            {
+                items.push_back(std::move(ordered_queue_.front()));
+                ordered_queue_.pop_front();
+            }
+            detection_busy_ = true;
+        }
+        ordered_space_cv_.notify_all();
+
+        this->completeDetections(items);
+
+        {
+            std::lock_guard<std::mutex> lock(data_mutex_);
+            detection_busy_ = false;
+        }
+        idle_cv_.notify_all();
+    }
+}
+
+void VisionPilotServiceImpl::asyncDetectionLoop()
+{
+    TRACE_THREAD_NAME("detection");
+
+    // 프레임 N 의 결과를 기다리는 동안 N+1 이후 프레임도 미리 요청 -> 어댑터가 전처리/추론을 겹치거나 배치로 묶을 수 있음
+    const size_t depth = config_.asyncDetectionDepth;
+    std::deque<PendingDetection> in_flight;
+    while (true)
+    {
+        std::optional<OrderedItem> next;
+        {
+            std::unique_lock<std::mutex> lock(data_mutex_);
+            if (in_flight.empty())
+            {
+                detection_cv_.wait(lock, [this]
+                                   { return !is_running_ || !ordered_queue_.empty(); });
+
+                // 종료 요청 후에도 이미 들어온 프레임은 모두 처리
+                if (ordered_queue_.empty())
+                {
+                    break;
+                }
+            }
+            if (in_flight.size() < depth && !ordered_queue_.empty())
+            {
+                next = std::move(ordered_queue_.front());
+                ordered_queue_.pop_front();
+                detection_busy_ = true;
+            }
+        }
+
+        if (next.has_value())
+        {
+            ordered_space_cv_.notify_all();
+            next->frame.trace.mark(domain::model::TracePoint::DETECTION_BEGIN);
+            auto detections = object_detection_port_.detectObjectAsync(next->frame, vp::port::out::DetectionLevel::FULL);
+            in_flight.push_back({std::move(*next), std::move(detections)});
+            continue;
+        }
+
+        // 더 요청할 자리나 프레임이 없으면 가장 오래된 결과부터 받음
+        this->completeOldest(in_flight);
+        if (in_flight.empty())
+        {
+            {
+                std::lock_guard<std::mutex> lock(data_mutex_);
+                detection_busy_ = false;
+            }
+            idle_cv_.notify_all();
+        }
+    }
+}
+
+void VisionPilotServiceImpl::completeOldest(std::deque<PendingDetection> &in_flight)
+{
+    using domain::model::PipelineStage;
+    using domain::model::TracePoint;
+
+    std::vector<OrderedItem> items;
+    std::vector<std::vector<domain::model::Detection>> detections(1);
+    {
+        TRACE_SCOPE("detection.wait");
+        detections[0] = in_flight.front().detections.get();
+    }
+    items.push_back(std::move(in_flight.front().item));
+    in_flight.pop_front();
+
+    // 탐지 소요 시간은 요청부터 결과 수신까지 (어댑터 대기열에서 기다린 시간 포함)
+    auto &trace = items[0].frame.trace;
+    trace.mark(TracePoint::DETECTION_END);
+    uint64_t detection_us = 0;
+    trace.elapsedUs(TracePoint::DETECTION_BEGIN, TracePoint::DETECTION_END, detection_us);
+    latency_monitor_.record(PipelineStage::DETECTION_WAIT, trace, TracePoint::DETECTION_QUEUED, TracePoint::DETECTION_BEGIN);
+    latency_monitor_.record(PipelineStage::DETECTION, detection_us);
+
+    this->publishResults(items, detections, detection_us);
+}
+
+void VisionPilotServiceImpl::completeDetections(std::vector<OrderedItem> &items)
+{
+    uint64_t detection_us = 0;
+    auto detections = this->runDetections(items, detection_us);
+    this->publishResults(items, detections, detection_us);
+}
 
+void VisionPilotServiceImpl::publishResults(std::vector<OrderedItem> &items, std::vector<std::vector<domain::model::Detection>> &detections, uint64_t detection_us)
+{
+    using domain::model::PipelineStage;
+    using domain::model::TracePoint;
+
+    // 결과 출력은 frame_id 순서. 다음 프레임은 이 결과가 반영된 뒤에 렌더링/출력됨
+    domain::model::FrameResult result;
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+        auto &item = items[i];
+        result.frame_id = item.frame.frame_id;
+        result.timestamp = this->frameTime(item.frame);
+        result.pose = item.pose;
+        result.localization_us = item.localization_us;
+        result.detection_us = detection_us;
+        result.detections = std::move(detections[i]);
+        if (config_.tracker.enable)
         {
+            // 트랙은 frame_id 순서와 소스 시각으로 갱신되므로 실행 간 같은 ID/박스가 나옴
+            TRACE_SCOPE("tracker.update");
             std::lock_guard<std::mutex> lock(data_mutex_);
-            latest_results_ = std::move(detections);
+            const auto &tracks = tracker_.update(result.detections, this->trackerTime(item.frame));
+            result.detections.assign(tracks.begin(), tracks.end());
+            this->noteTruncated(item.frame.frame_id, tracks.truncated());
+        }
+        if (result_sink_ != nullptr)
+        {
+            result_sink_->publish(result);
         }
+
+        const auto &trace = item.frame.trace;
+        latency_monitor_.record(PipelineStage::END_TO_END, trace,
+                                trace.has(TracePoint::CAPTURED) ? TracePoint::CAPTURED : TracePoint::LOCALIZATION_BEGIN,
+                                TracePoint::DETECTION_END);
+        latency_monitor_.logIfDue(trace.at(TracePoint::DETECTION_END));
+    }
+
+    std::lock_guard<std::mutex> lock(data_mutex_);
+    if (!latest_results_.assign(result.detections.begin(), result.detections.end()))
+    {
+        // 추적을 끄면 출력은 전부 나가지만 다음 프레임 렌더링용 결과는 잘림
+        this->noteTruncated(result.frame_id, true);
+    }
+}
+
+std::vector<std::vector<domain::model::Detection>> VisionPilotServiceImpl::runDetections(std::vector<OrderedItem> &items, uint64_t &elapsed_us)
+{
+    using domain::model::PipelineStage;
+    using domain::model::TracePoint;
+
+    if (items.size() == 1)
+    {
+        std::vector<std::vector<domain::model::Detection>> detections(1);
+        detections[0] = this->runDetection(items[0].frame, vp::port::out::DetectionLevel::FULL, elapsed_us);
+        return detections;
+    }
+
+    std::vector<const domain::model::ImagePacket *> frames;
+    frames.reserve(items.size());
+    for (auto &item : items)
+    {
+        item.frame.trace.mark(TracePoint::DETECTION_BEGIN);
+        frames.push_back(&item.frame);
+    }
+
+    std::vector<std::vector<domain::model::Detection>> detections;
+    {
+        TRACE_SCOPE("detection.infer");
+        detections = object_detection_port_.detectObjects(frames, vp::port::out::DetectionLevel::FULL);
+    }
+    detections.resize(items.size());
+
+    // 배치 안의 프레임은 모두 같은 탐지 소요 시간을 가짐
+    elapsed_us = 0;
+    for (auto &item : items)
+    {
+        auto &trace = item.frame.trace;
+        trace.mark(TracePoint::DETECTION_END);
+        trace.elapsedUs(TracePoint::DETECTION_BEGIN, TracePoint::DETECTION_END, elapsed_us);
+        latency_monitor_.record(PipelineStage::DETECTION_WAIT, trace, TracePoint::DETECTION_QUEUED, TracePoint::DETECTION_BEGIN);
+        latency_monitor_.record(PipelineStage::DETECTION, elapsed_us);
     }
+    return detections;
 }
 
-} // namespace vp::service
\ No newline at end of file
+} // namespace vp::service
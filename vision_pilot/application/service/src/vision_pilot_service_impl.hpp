@@ -1,12 +1,19 @@
 #pragma once
 
+#include "detection_scheduler.hpp"
+#include "latency_monitor.hpp"
 #include "localization_port.hpp"
 #include "object_detection_port.hpp"
+#include "object_tracker.hpp"
+#include "result_sink_port.hpp"
+#include "roi_planner.hpp"
 #include "vision_pilot_service.hpp"
 #include "visualization_port.hpp"
 
 #include <atomic>
 #include <condition_variable>
+#include <deque>
+#include <future>
 #include <mutex>
 #include <optional>
 #include <thread>
@@ -19,18 +26,63 @@ class VisionPilotServiceImpl
 public:
     VisionPilotServiceImpl(vp::port::out::LocalizationPort &localization_port,
                            vp::port::out::VisualizationPort &visualization_port,
-                           vp::port::out::ObjectDetectionPort &object_detection_port);
+                           vp::port::out::ObjectDetectionPort &object_detection_port,
+                           const config::VisionPilotServiceConfig &config,
+                           vp::port::out::ResultSinkPort *result_sink);
     ~VisionPilotServiceImpl();
 
     void onFrameReceived(const domain::model::ImagePacket &frame);
+    void flush();
+    domain::model::LatencyReport getLatencyReport() const;
 
 private:
+    // BATCH/DETERMINISTIC 모드 탐지 대기열 항목 (위치 추정까지 끝난 프레임)
+    struct OrderedItem
+    {
+        domain::model::ImagePacket frame;
+        domain::model::Pose pose;
+        uint64_t localization_us = 0;
+    };
+
+    // BATCH 모드 비동기 탐지 요청 (asyncDetectionDepth > 0)
+    struct PendingDetection
+    {
+        OrderedItem item;
+        std::future<std::vector<domain::model::Detection>> detections;
+    };
+
+    OrderedItem localizeFrame(const domain::model::ImagePacket &frame);
+    void enqueueBatchFrame(const domain::model::ImagePacket &frame);
+    void processDeterministicFrame(const domain::model::ImagePacket &frame);
     void detectionLoop();
+    void orderedDetectionLoop();
+    // 탐지 포트의 비동기 요청으로 여러 프레임의 탐지를 겹쳐 진행하고 요청 순서대로 결과 출력
+    void asyncDetectionLoop();
+    // in_flight 의 가장 오래된 요청 결과를 기다려 출력
+    void completeOldest(std::deque<PendingDetection> &in_flight);
+    void completeDetections(std::vector<OrderedItem> &items);
+    // 탐지 결과를 frame_id 순서로 추적/출력하고 최근 결과 갱신
+    void publishResults(std::vector<OrderedItem> &items, std::vector<std::vector<domain::model::Detection>> &detections, uint64_t detection_us);
+    // 위치 추정/결과 출력 시각 (us). BATCH/DETERMINISTIC 모드는 소스 기준 시각을 써서 읽는 속도와 무관하게 같은 포즈/출력이 나옴
+    uint64_t frameTime(const domain::model::ImagePacket &frame) const;
+    // 추적기 시각 (ms). frameTime 기준이라 BATCH/DETERMINISTIC 모드는 읽는 속도와 무관하게 같은 트랙이 나옴
+    uint64_t trackerTime(const domain::model::ImagePacket &frame) const;
+    // 렌더링할 탐지 결과. 추적 사용 시 timestamp 시점으로 예측한 트랙 (data_mutex_ 잠근 상태에서 호출)
+    void currentDetections(uint64_t timestamp, domain::model::DetectionBuffer &detections) const;
+    // DetectionBuffer 용량 초과로 결과가 잘린 프레임 집계/경고 (data_mutex_ 잠근 상태에서 호출)
+    void noteTruncated(uint64_t frame_id, bool truncated);
+    // regions != nullptr 이면 해당 영역 주변만 탐지
+    std::vector<domain::model::Detection> runDetection(domain::model::ImagePacket &frame, vp::port::out::DetectionLevel level, uint64_t &elapsed_us,
+                                                       const std::vector<domain::model::BoundingBox> *regions = nullptr);
+    // 여러 프레임을 한 번에 탐지. elapsed_us: 배치 전체 탐지 소요 시간
+    std::vector<std::vector<domain::model::Detection>> runDetections(std::vector<OrderedItem> &items, uint64_t &elapsed_us);
 
 private:
     vp::port::out::LocalizationPort &localization_port_;
     vp::port::out::VisualizationPort &visualization_port_;
     vp::port::out::ObjectDetectionPort &object_detection_port_;
+    vp::port::out::ResultSinkPort *result_sink_; // nullptr: 결과 출력 안 함
+    const config::VisionPilotServiceConfig config_;
 
     // --- 스레드 관리 ---
     std::thread detection_thread_{};
@@ -42,8 +94,33 @@ private:
 
     // 공유 데이터
     std::optional<domain::model::ImagePacket> latest_frame_{}; // 탐지기가 처리할 최신 이미지
-    std::vector<domain::model::Detection> latest_results_{};   // 탐지 완료된 결과
+    domain::model::DetectionBuffer latest_results_{};          // 탐지 완료된 결과 (프레임마다 복사하므로 고정 용량)
     bool new_frame_available_ = false;                         // 새 프레임 도착 플래그
+    bool detection_busy_ = false;                              // 탐지 스레드 추론 중 여부
+    std::condition_variable idle_cv_{};                        // 탐지 완료 알림 (flush 대기용)
+
+    // --- BATCH/DETERMINISTIC 모드 (data_mutex_ 로 보호) ---
+    std::deque<OrderedItem> ordered_queue_{};    // 위치 추정 순서대로 탐지 대기
+    std::condition_variable ordered_space_cv_{}; // 대기열에 자리가 나면 생산자 깨움
+
+    // --- DETERMINISTIC 모드 프레임 순서 확인 (프레임 수신 스레드 전용) ---
+    uint64_t last_frame_id_ = 0;
+    bool has_last_frame_id_ = false;
+
+    // --- 탐지 스케줄링 (data_mutex_ 로 보호) ---
+    DetectionScheduler detection_scheduler_;
+    vp::port::out::DetectionLevel pending_level_ = vp::port::out::DetectionLevel::FULL;
+    domain::model::Pose pending_pose_{}; // latest_frame_ 의 위치 추정 결과
+
+    // --- 영역 탐지 계획 (탐지 스레드 전용) ---
+    RoiPlanner roi_planner_;
+
+    // --- 객체 추적 (data_mutex_ 로 보호) ---
+    ObjectTracker tracker_;
+    uint64_t truncated_frames_ = 0; // 탐지/트랙 결과가 DetectionBuffer::kCapacity 를 넘어 잘린 프레임 수
+
+    // --- 구간별 지연 시간 통계 (내부 동기화) ---
+    LatencyMonitor latency_monitor_;
 };
 
 } // namespace vp::service
\ No newline at end of file
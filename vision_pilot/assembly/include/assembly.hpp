@@ -14,9 +14,16 @@ public:
     Assembly(const config::AssemblyConfig &config);
     ~Assembly();
 
-    void startService();
+    // 포트 생성 또는 입력 시작에 실패하면 생성한 자원을 정리하고 false
+    bool startService();
     void stopService();
 
+    // BATCH/DETERMINISTIC 모드에서 입력을 모두 처리했으면 true (REALTIME 모드는 stopService() 전까지 false)
+    bool isFinished();
+
+    // 실행 중 탐지 모델 교체 (config 의 modelPath 로 다시 로드, 파이프라인은 멈추지 않음)
+    void reloadDetectionModels(const config::AssemblyConfig &config);
+
 private:
     std::unique_ptr<AssemblyImpl> impl_;
 };
@@ -15,10 +15,10 @@ Assembly::~Assembly()
     LOG_TRA("");
 }
 
-void Assembly::startService()
+bool Assembly::startService()
 {
     LOG_TRA("");
-    impl_->startService();
+    return impl_->startService();
 }
 
 void Assembly::stopService()
@@ -26,4 +26,15 @@ void Assembly::stopService()
     LOG_TRA("");
     impl_->stopService();
 }
+
+bool Assembly::isFinished()
+{
+    return impl_->isFinished();
+}
+
+void Assembly::reloadDetectionModels(const config::AssemblyConfig &config)
+{
+    LOG_TRA("");
+    impl_->reloadDetectionModels(config);
+}
 } // namespace vp::assembly
\ No newline at end of file
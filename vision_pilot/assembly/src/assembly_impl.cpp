@@ -1,26 +1,305 @@
 #include "assembly_impl.hpp"
 #include "gaia_log.hpp"
+#include "gaia_trace.hpp"
+#include "mono_vslam_adapter.hpp"
+#include "no_slam_adapter.hpp"
+#include "none_viewer_adapter.hpp"
+#include "opencv_viewer_adapter.hpp"
+#include "pangolin_viewer_adapter.hpp"
+#include <algorithm>
+#include <opencv2/core.hpp>
 
 namespace vp::assembly
 {
 AssemblyImpl::AssemblyImpl(const config::AssemblyConfig &config)
-    : config_{config}
+    : config_{config},
+      offline_mode_{config.serviceConfig.processingMode != config::ProcessingMode::REALTIME},
+      video_loader_config_{config.videoLoaderConfig},
+      viewer_config_{config.vslamViewerConfig},
+      result_sink_config_{config.resultSinkConfig},
+      yolo_config_{config.yoloConfig},
+      model_registry_config_{config.modelRegistryConfig}
 {
     LOG_TRA("");
+
+    if (config_.traceConfig.enable)
+    {
+        vp::trace::traceInit(config_.traceConfig.eventsPerThread);
+    }
+
+    if (offline_mode_)
+    {
+        // 배치/재현 처리: 재생 속도 제한 없이 모든 프레임을 읽고 결과를 파일로 저장
+        video_loader_config_.paceToFps = false;
+    }
+    if (config_.serviceConfig.processingMode == config::ProcessingMode::BATCH)
+    {
+        viewer_config_.viewerType = config::VslamViewerType::NONE;
+    }
+    if (config_.serviceConfig.processingMode == config::ProcessingMode::DETERMINISTIC)
+    {
+        // 소요 시간은 실행마다 달라지므로 재생 결과 비교를 위해 기록하지 않음
+        result_sink_config_.writeTimings = false;
+    }
+
+    // 탐지 어댑터가 만드는 작업 스레드 (추론 풀, 비동기 대기열) 도 탐지 스레드와 같은 코어에 고정
+    const auto &detection_affinity = config_.serviceConfig.detectionAffinity;
+    if (!yolo_config_.workerAffinity.enable)
+    {
+        yolo_config_.workerAffinity = detection_affinity;
+    }
+    if (!model_registry_config_.workerAffinity.enable)
+    {
+        model_registry_config_.workerAffinity = detection_affinity;
+    }
+    for (auto &model : model_registry_config_.models)
+    {
+        if (!model.yolo.workerAffinity.enable)
+        {
+            model.yolo.workerAffinity = detection_affinity;
+        }
+    }
 }
 
 AssemblyImpl::~AssemblyImpl()
 {
     LOG_TRA("");
+    this->stopService();
+    this->dumpTrace();
 }
 
-void AssemblyImpl::startService()
+bool AssemblyImpl::startService()
 {
     LOG_TRA("");
+
+    if (running_)
+    {
+        return true;
+    }
+
+    if (!this->createPorts())
+    {
+        LOG_ERR("Failed to create ports. Service is not started.");
+        this->releaseComponents();
+        return false;
+    }
+
+    service_ = std::make_unique<service::VisionPilotService>(*localization_adapter_, *visualization_adapter_, *object_detection_adapter_,
+                                                             config_.serviceConfig, result_sink_adapter_.get());
+
+    // 배치/재현 처리는 프레임 유실이 없도록 큐가 가득 차면 로더가 대기
+    event_queue_ = std::make_unique<infrastructure::event::EventQueue>(
+        config_.eventQueueSize, offline_mode_ ? infrastructure::event::OverflowPolicy::BLOCK : infrastructure::event::OverflowPolicy::DROP_OLDEST);
+    event_router_ = std::make_unique<infrastructure::event::EventRouter>(*event_queue_, *service_);
+    video_loader_ = std::make_unique<adapter::in::frame_loader::VideoLoader>(video_loader_config_, *event_queue_);
+
+    event_router_->start();
+    if (!video_loader_->start())
+    {
+        // 입력이 없으면 isFinished() 가 끝나지 않으므로 시작하지 않음
+        LOG_ERR("Failed to start video loader. Service is not started.");
+        this->releaseComponents();
+        return false;
+    }
+    running_ = true;
+    LOG_INF("VisionPilot started ({} mode).", nlohmann::json(config_.serviceConfig.processingMode).get<std::string>());
+    return true;
 }
 
 void AssemblyImpl::stopService()
 {
     LOG_TRA("");
+
+    if (running_)
+    {
+        this->releaseComponents();
+        running_ = false;
+        LOG_INF("VisionPilot stopped.");
+    }
+
+    this->dumpTrace();
+}
+
+void AssemblyImpl::releaseComponents()
+{
+    // 큐를 닫아 대기 중인 로더를 깨운 뒤 생산자부터 정지
+    if (event_queue_ != nullptr)
+    {
+        event_queue_->close();
+    }
+    if (video_loader_ != nullptr)
+    {
+        video_loader_->stop();
+    }
+    if (event_router_ != nullptr)
+    {
+        event_router_->stop();
+    }
+    if (service_ != nullptr)
+    {
+        service_->flush();
+    }
+
+    video_loader_.reset();
+    event_router_.reset();
+    service_.reset();
+    event_queue_.reset();
+    result_sink_adapter_.reset();
+    yolo_adapter_ = nullptr;
+    model_registry_adapter_ = nullptr;
+    object_detection_adapter_.reset();
+    visualization_adapter_.reset();
+    localization_adapter_.reset();
+}
+
+bool AssemblyImpl::isFinished()
+{
+    if (!running_)
+    {
+        return true;
+    }
+    if (!offline_mode_ || !video_loader_->isFinished())
+    {
+        return false;
+    }
+
+    // 입력이 끝나면 큐를 닫고, 라우터가 남은 이벤트를 모두 전달할 때까지 대기
+    event_queue_->close();
+    if (event_router_->isRunning())
+    {
+        return false;
+    }
+    service_->flush();
+    return true;
+}
+
+void AssemblyImpl::reloadDetectionModels(const config::AssemblyConfig &config)
+{
+    LOG_TRA("");
+
+    if (!running_)
+    {
+        LOG_WRN("Service is not running. Model reload ignored.");
+        return;
+    }
+
+    // 모델 경로만 반영 (입력 크기, 임계값 등 나머지 설정 변경은 재시작 필요)
+    if (yolo_adapter_ != nullptr)
+    {
+        yolo_adapter_->reloadModel(config.yoloConfig.modelPath);
+    }
+    else if (model_registry_adapter_ != nullptr)
+    {
+        for (const auto &model : config.modelRegistryConfig.models)
+        {
+            model_registry_adapter_->reloadModel(model.name, model.yolo.modelPath);
+        }
+    }
+}
+
+bool AssemblyImpl::createPorts()
+{
+    LOG_TRA("");
+
+    if (config_.vslamAdapterConfig.method == config::VslamMethod::DISABLED)
+    {
+        auto adapter = std::make_unique<adapter::out::NoSlamAdapter>(config_.vslamAdapterConfig);
+        adapter->initialize();
+        localization_adapter_ = std::move(adapter);
+    }
+    else
+    {
+        auto adapter = std::make_unique<adapter::out::MonoVSlamAdapter>(config_.vslamAdapterConfig);
+        if (!adapter->initialize())
+        {
+            LOG_ERR("Failed to initialize VSLAM adapter.");
+            return false;
+        }
+        localization_adapter_ = std::move(adapter);
+    }
+
+    switch (viewer_config_.viewerType)
+    {
+    case config::VslamViewerType::OPENCV:
+    {
+        auto adapter = std::make_unique<adapter::out::OpenCVViewerAdapter>(viewer_config_);
+        adapter->start();
+        visualization_adapter_ = std::move(adapter);
+        break;
+    }
+    case config::VslamViewerType::PANGOLIN:
+    {
+        auto adapter = std::make_unique<adapter::out::PangolinViewerAdapter>(viewer_config_);
+        adapter->start();
+        visualization_adapter_ = std::move(adapter);
+        break;
+    }
+    case config::VslamViewerType::NONE:
+    default:
+        visualization_adapter_ = std::make_unique<adapter::out::NoneViewerAdapter>(viewer_config_);
+        break;
+    }
+
+    // OpenCV 스레드 수는 프로세스 전역 (전처리, SLAM 에도 적용) 이므로 모델마다 덮어쓰지 않고 여기서 한 번만 설정
+    int opencv_threads = yolo_config_.backend == config::InferenceBackendType::OPENCV_DNN ? yolo_config_.numThreads : 0;
+    if (!model_registry_config_.models.empty())
+    {
+        opencv_threads = 0;
+        for (const auto &model : model_registry_config_.models)
+        {
+            if (model.yolo.backend == config::InferenceBackendType::OPENCV_DNN)
+            {
+                opencv_threads = std::max(opencv_threads, model.yolo.numThreads);
+            }
+        }
+    }
+    if (opencv_threads > 0)
+    {
+        LOG_INF("OpenCV threads: {}", opencv_threads);
+        cv::setNumThreads(opencv_threads);
+    }
+
+    if (!model_registry_config_.models.empty())
+    {
+        // 여러 탐지 모델을 한 프로세스에서 실행 (입력/전처리 공유)
+        auto adapter = std::make_unique<adapter::out::ModelRegistryAdapter>(model_registry_config_);
+        if (!adapter->initialize())
+        {
+            LOG_ERR("Failed to initialize model registry adapter.");
+            return false;
+        }
+        model_registry_adapter_ = adapter.get();
+        object_detection_adapter_ = std::move(adapter);
+    }
+    else
+    {
+        auto adapter = std::make_unique<adapter::out::YOLOv8Adapter>(yolo_config_);
+        if (!adapter->initialize())
+        {
+            LOG_ERR("Failed to initialize object detection adapter.");
+            return false;
+        }
+        yolo_adapter_ = adapter.get();
+        object_detection_adapter_ = std::move(adapter);
+    }
+
+    if (offline_mode_)
+    {
+        result_sink_adapter_ = std::make_unique<adapter::out::JsonlResultSinkAdapter>(result_sink_config_);
+        if (!result_sink_adapter_->initialize())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void AssemblyImpl::dumpTrace()
+{
+    // 기록 중일 때만 저장되므로 중복 호출해도 한 번만 기록된다
+    if (config_.traceConfig.enable)
+    {
+        vp::trace::traceDump(config_.traceConfig.outputPath);
+    }
 }
-} // namespace vp::assembly
\ No newline at end of file
+} // namespace vp::assembly
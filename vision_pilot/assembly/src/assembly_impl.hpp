@@ -1,4 +1,15 @@
 #include "assembly_config.hpp"
+#include "event_queue.hpp"
+#include "event_router.hpp"
+#include "jsonl_result_sink_adapter.hpp"
+#include "localization_port.hpp"
+#include "model_registry_adapter.hpp"
+#include "object_detection_port.hpp"
+#include "video_loader.hpp"
+#include "vision_pilot_service.hpp"
+#include "visualization_port.hpp"
+#include "yolov8_adapter.hpp"
+#include <memory>
 
 namespace vp::assembly
 {
@@ -8,10 +19,39 @@ public:
     AssemblyImpl(const config::AssemblyConfig &config);
     ~AssemblyImpl();
 
-    void startService();
+    bool startService();
     void stopService();
+    bool isFinished();
+    void reloadDetectionModels(const config::AssemblyConfig &config);
 
 private:
+    bool createPorts();
+    // 생성된 구성 요소를 정지/해제 (생산자 -> 소비자 순)
+    void releaseComponents();
+    void dumpTrace();
+
     const config::AssemblyConfig &config_;
+    const bool offline_mode_; // BATCH/DETERMINISTIC: 모든 프레임을 처리하고 입력이 끝나면 종료
+
+    // 처리 모드에 맞게 조정한 설정 사본 (어댑터가 참조로 보관)
+    config::VideoLoaderConfig video_loader_config_;
+    config::VslamViewerConfig viewer_config_;
+    config::ResultSinkConfig result_sink_config_;
+    config::YoloConfig yolo_config_;
+    config::ModelRegistryConfig model_registry_config_;
+
+    // 생성 역순으로 소멸되도록 선언 순서 유지 (로더 -> 라우터 -> 서비스 -> 어댑터 순 정지)
+    std::unique_ptr<port::out::LocalizationPort> localization_adapter_;
+    std::unique_ptr<port::out::VisualizationPort> visualization_adapter_;
+    std::unique_ptr<port::out::ObjectDetectionPort> object_detection_adapter_;
+    adapter::out::YOLOv8Adapter *yolo_adapter_ = nullptr;                 // object_detection_adapter_ 가 단일 모델일 때 (모델 교체용)
+    adapter::out::ModelRegistryAdapter *model_registry_adapter_ = nullptr; // object_detection_adapter_ 가 레지스트리일 때
+    std::unique_ptr<adapter::out::JsonlResultSinkAdapter> result_sink_adapter_;
+    std::unique_ptr<service::VisionPilotService> service_;
+    std::unique_ptr<infrastructure::event::EventQueue> event_queue_;
+    std::unique_ptr<infrastructure::event::EventRouter> event_router_;
+    std::unique_ptr<adapter::in::frame_loader::VideoLoader> video_loader_;
+
+    bool running_ = false;
 };
-} // namespace vp::assembly
\ No newline at end of file
+} // namespace vp::assembly
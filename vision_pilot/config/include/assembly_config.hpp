@@ -1,5 +1,10 @@
 #pragma once
+#include "model_registry_config.hpp"
+#include "result_sink_config.hpp"
+#include "service_config.hpp"
+#include "trace_config.hpp"
 #include "vslam_config.hpp"
+#include "yolov8_config.hpp"
 #include <video_loader_config.hpp>
 
 namespace vp::config
@@ -8,9 +13,23 @@ struct AssemblyConfig
 {
     VideoLoaderConfig videoLoaderConfig;
     VslamAdapterConfig vslamAdapterConfig;
+    VslamViewerConfig vslamViewerConfig;
+    YoloConfig yoloConfig;
+    ModelRegistryConfig modelRegistryConfig; // 여러 탐지 모델 동시 실행 (models 가 비어 있으면 yoloConfig 사용)
+    VisionPilotServiceConfig serviceConfig;
+    ResultSinkConfig resultSinkConfig; // BATCH 모드 결과 출력
+    uint32_t eventQueueSize = 10;      // 로더 -> 라우터 이벤트 큐 크기
+    TraceConfig traceConfig;
 };
 
-NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(AssemblyConfig,
-                                   videoLoaderConfig,
-                                   vslamAdapterConfig)
-} // namespace vp::config
\ No newline at end of file
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(AssemblyConfig,
+                                                videoLoaderConfig,
+                                                vslamAdapterConfig,
+                                                vslamViewerConfig,
+                                                yoloConfig,
+                                                modelRegistryConfig,
+                                                serviceConfig,
+                                                resultSinkConfig,
+                                                eventQueueSize,
+                                                traceConfig)
+} // namespace vp::config
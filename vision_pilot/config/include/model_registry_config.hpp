@@ -0,0 +1,42 @@
+#pragma once
+#include "nlohmann/json.hpp"
+#include "yolov8_config.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vp::config
+{
+
+// 레지스트리에 등록할 탐지 모델 하나
+struct DetectorModelConfig
+{
+    std::string name;           // 로그 구분용 이름
+    YoloConfig yolo;            // 모델 경로, 입력 크기, 클래스 필터 등 모델별 설정
+    uint32_t minIntervalMs = 0; // 최소 실행 간격 (소스 시각 기준 ms, 0: 매 프레임)
+    bool holdResults = true;    // 건너뛴 프레임에 마지막 결과를 그대로 사용 (false: 결과 없음, 추적기로 보간할 때)
+    std::vector<int> classMap;  // 모델 클래스 -> ClassId 변환 (비어 있으면 그대로, -1: 결과에서 제외)
+};
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(DetectorModelConfig,
+                                                name,
+                                                yolo,
+                                                minIntervalMs,
+                                                holdResults,
+                                                classMap)
+
+// 여러 탐지 모델을 한 프로세스에서 같은 프레임에 실행 (범용 탐지 + 특화 모델)
+struct ModelRegistryConfig
+{
+    std::vector<DetectorModelConfig> models; // 비어 있으면 yoloConfig 단일 모델 사용
+    int numWorkers = 2;                      // 공유 추론 풀 스레드 수 (호출 스레드 포함)
+    float mergeIou = 0.7f;                   // 모델 간 같은 클래스 중복 박스 제거 IoU 기준 (0: 제거 안 함)
+    Affinity workerAffinity;                 // 추론 풀 스레드 CPU 고정 (비활성화 시 assembly 가 서비스 detectionAffinity 로 채움)
+};
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(ModelRegistryConfig,
+                                                models,
+                                                numWorkers,
+                                                mergeIou,
+                                                workerAffinity)
+} // namespace vp::config
@@ -0,0 +1,20 @@
+#pragma once
+#include "nlohmann/json.hpp"
+#include <cstdint>
+#include <string>
+
+namespace vp::config
+{
+
+struct ResultSinkConfig
+{
+    std::string outputPath = "vp_results.jsonl"; // 프레임별 결과를 한 줄씩 기록할 JSON Lines 파일
+    uint32_t flushInterval = 30;                 // N 프레임마다 파일에 반영 (0: 종료 시에만)
+    bool writeTimings = true;                    // 구간 소요 시간(localizationUs, detectionUs) 기록. DETERMINISTIC 모드는 실행 간 같은 출력을 위해 끔
+};
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(ResultSinkConfig,
+                                                outputPath,
+                                                flushInterval,
+                                                writeTimings)
+} // namespace vp::config
@@ -0,0 +1,128 @@
+#pragma once
+#include "gaia_cpu_affinity.hpp"
+#include "nlohmann/json.hpp"
+
+namespace vp::config
+{
+
+enum class ProcessingMode
+{
+    REALTIME = 0, // 최신 프레임 위주 처리. 탐지/큐 적체 시 프레임을 건너뜀
+    BATCH,        // 모든 프레임을 순서대로 한 번씩 처리 (시각화 없음, 결과는 ResultSinkPort 로 출력)
+    DETERMINISTIC // 스레드 타이밍과 무관하게 frame_id 순서로 단계 실행 (실행 간 결과 비교용)
+};
+
+NLOHMANN_JSON_SERIALIZE_ENUM(ProcessingMode,
+                             {
+                                 {ProcessingMode::REALTIME, "realtime"},
+                                 {ProcessingMode::BATCH, "batch"},
+                                 {ProcessingMode::DETERMINISTIC, "deterministic"},
+                             })
+
+struct DetectionSchedulerConfig
+{
+    bool enable = false;            // false: 탐지 스레드가 비는 즉시 최신 프레임 처리 (기존 동작)
+    double targetHz = 10.0;         // 목표 탐지 주기 (Hz)
+    double latencyBudgetMs = 100.0; // 탐지 1회 허용 지연. 초과 시 경량 모델/해상도로 전환
+    double maxDutyCycle = 0.5;      // 탐지가 점유할 수 있는 최대 시간 비율 (0.0 ~ 1.0)
+    double ewmaAlpha = 0.2;         // 추론/SLAM 소요 시간 지수 이동 평균 가중치
+    bool allowReduced = true;       // 부하 시 경량 탐지(DetectionLevel::REDUCED) 허용. 탐지기가 지원하지 않으면 무시
+    uint32_t probeInterval = 30;    // 경량 탐지 중 N회마다 FULL 탐지로 소요 시간 재측정
+};
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(DetectionSchedulerConfig,
+                                                enable,
+                                                targetHz,
+                                                latencyBudgetMs,
+                                                maxDutyCycle,
+                                                ewmaAlpha,
+                                                allowReduced,
+                                                probeInterval)
+
+// 이전 탐지 결과 주변만 다시 탐지 (REALTIME 모드). 자세 변화가 클수록 영역을 넓히고, 주기적으로 전체 프레임 탐지
+struct RoiDetectionConfig
+{
+    bool enable = false;
+    uint32_t fullFrameInterval = 10; // 영역 탐지 N 회마다 전체 프레임 탐지 (새로 나타난 객체 발견용)
+    float expandRatio = 0.25f;       // 이전 박스 크기 대비 기본 확장 비율 (객체 자체 움직임 여유)
+    float focalLengthPx = 500.0f;    // 회전각(rad) -> 화면 이동량(px) 환산 초점 거리
+    float translationGain = 1.0f;    // 이동 거리 1m 당 박스 크기 대비 추가 확장 비율
+    float maxRotationRad = 0.35f;    // 마지막 탐지 이후 회전이 이보다 크면 전체 프레임 탐지
+    float minRoiSize = 96.0f;        // 영역 한 변 최소 크기 (px)
+    uint32_t maxRois = 8;            // 병합 후 영역 수가 이보다 많으면 전체 프레임 탐지
+    float maxAreaRatio = 0.5f;       // 영역 면적 합이 프레임 대비 이 비율을 넘으면 전체 프레임 탐지
+};
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(RoiDetectionConfig,
+                                                enable,
+                                                fullFrameInterval,
+                                                expandRatio,
+                                                focalLengthPx,
+                                                translationGain,
+                                                maxRotationRad,
+                                                minRoiSize,
+                                                maxRois,
+                                                maxAreaRatio)
+
+// 탐지 결과에 추적 ID/속도를 부여하고, 탐지가 없는 프레임에는 예측 위치를 출력 (SORT/ByteTrack 방식)
+struct TrackerConfig
+{
+    bool enable = false;
+    float highScoreThreshold = 0.5f;  // 이 점수 이상 탐지를 먼저 매칭. 나머지는 남은 트랙과 2차 매칭
+    float newTrackThreshold = 0.6f;   // 매칭되지 않은 탐지 중 이 점수 이상만 새 트랙 생성
+    float matchIou = 0.3f;            // 트랙 예측 박스와 탐지 박스 최소 IoU
+    uint32_t minHits = 2;             // 이 횟수 이상 매칭된 트랙만 출력
+    uint32_t maxAgeMs = 300;          // 매칭 없이 예측만으로 유지하는 시간 (ms)
+    float accelerationNoise = 300.0f; // 칼만 필터 가속도 잡음 표준편차 (px/s^2)
+    float measurementNoise = 4.0f;    // 탐지 박스 좌표 잡음 표준편차 (px)
+};
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(TrackerConfig,
+                                                enable,
+                                                highScoreThreshold,
+                                                newTrackThreshold,
+                                                matchIou,
+                                                minHits,
+                                                maxAgeMs,
+                                                accelerationNoise,
+                                                measurementNoise)
+
+// 프레임 N 은 N 이전 프레임들의 탐지 결과로 렌더링되며, 결과는 frame_id 순서로 출력된다
+struct DeterministicConfig
+{
+    uint32_t detectionStride = 1; // frame_id % stride == 0 인 프레임만 탐지 (0: 탐지 안 함)
+    bool singleThread = true;     // true: 모든 단계를 프레임 수신 스레드에서 순차 실행
+                                  // false: 탐지를 다음 프레임의 위치 추정과 겹쳐 실행 (출력은 동일)
+};
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(DeterministicConfig,
+                                                detectionStride,
+                                                singleThread)
+
+struct VisionPilotServiceConfig
+{
+    ProcessingMode processingMode = ProcessingMode::REALTIME;
+    DetectionSchedulerConfig detectionScheduler; // REALTIME 모드에서만 사용
+    RoiDetectionConfig roiDetection;             // REALTIME 모드에서만 사용
+    TrackerConfig tracker;                       // 모든 모드. 렌더링/결과 출력에 추적 결과 사용
+    uint32_t latencyLogIntervalMs = 5000;        // 구간별 지연 시간 통계 로그 주기 (0: 로그 비활성화)
+    uint32_t batchQueueSize = 8;                 // BATCH 모드 탐지 대기열 크기. 가득 차면 위치 추정 단계가 대기
+    uint32_t detectionBatchSize = 1;             // BATCH 모드에서 대기열의 프레임을 최대 N 장씩 묶어 탐지
+    uint32_t asyncDetectionDepth = 0;            // BATCH 모드에서 결과를 기다리지 않고 미리 요청해 둘 탐지 수 (0: 동기 탐지)
+    DeterministicConfig deterministic;           // DETERMINISTIC 모드에서만 사용
+    Affinity detectionAffinity;                  // 탐지 스레드와 탐지 어댑터 작업 스레드 CPU 고정 (SLAM 스레드와 코어 분리용).
+                                                 // 추론 런타임 내부 스레드는 고정되지 않으므로 yoloConfig.numThreads 로 제한
+};
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(VisionPilotServiceConfig,
+                                                processingMode,
+                                                detectionScheduler,
+                                                roiDetection,
+                                                tracker,
+                                                latencyLogIntervalMs,
+                                                batchQueueSize,
+                                                detectionBatchSize,
+                                                asyncDetectionDepth,
+                                                deterministic,
+                                                detectionAffinity)
+} // namespace vp::config
@@ -0,0 +1,20 @@
+#pragma once
+#include "nlohmann/json.hpp"
+#include <cstdint>
+#include <string>
+
+namespace vp::config
+{
+
+struct TraceConfig
+{
+    bool enable = false;                     // true: 파이프라인 구간을 Chrome trace 형식으로 기록
+    std::string outputPath = "vp_trace.json"; // 서비스 종료 시 저장할 경로 (chrome://tracing, Perfetto 에서 열기)
+    uint32_t eventsPerThread = 65536;         // 스레드별 최대 스팬 수. 초과분은 버림
+};
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(TraceConfig,
+                                                enable,
+                                                outputPath,
+                                                eventsPerThread)
+} // namespace vp::config
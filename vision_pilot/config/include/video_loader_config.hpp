@@ -34,15 +34,17 @@ NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(ImageSize,
 
 struct VideoLoaderConfig
 {
-    ImageSize frameSize;   // 프레임 크기
-    std::string source;    // 비디오 소스 경로 또는 장치 ID
-    SourceType sourceType; // 비디오 소스 유형
-    uint32_t fps = 30;     // 프레임 속도 (지원하는 경우)
+    ImageSize frameSize;                            // 프레임 크기
+    std::string source;                             // 비디오 소스 경로 또는 장치 ID
+    SourceType sourceType = SourceType::VIDEO_FILE; // 비디오 소스 유형
+    uint32_t fps = 30;                              // 프레임 속도 (지원하는 경우)
+    bool paceToFps = true;                          // 파일/프레임셋 소스를 fps 간격으로 재생 (false: 최대 속도로 읽기)
 };
 
-NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(VideoLoaderConfig,
-                                   frameSize,
-                                   source,
-                                   sourceType,
-                                   fps)
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(VideoLoaderConfig,
+                                                frameSize,
+                                                source,
+                                                sourceType,
+                                                fps,
+                                                paceToFps)
 } // namespace vp::config
\ No newline at end of file
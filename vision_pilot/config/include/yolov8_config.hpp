@@ -1,15 +1,185 @@
 #pragma once
+#include "gaia_cpu_affinity.hpp"
+#include "nlohmann/json.hpp"
 #include <string>
+#include <vector>
 
 namespace vp::config
 {
+enum class NmsMethod
+{
+    HARD = 0,     // IoU 기준 초과 시 제거 (기존 동작)
+    SOFT_LINEAR,  // 제거 대신 점수를 (1 - IoU) 배로 감쇠
+    SOFT_GAUSSIAN // 점수를 exp(-IoU^2 / sigma) 배로 감쇠
+};
+
+NLOHMANN_JSON_SERIALIZE_ENUM(NmsMethod,
+                             {
+                                 {NmsMethod::HARD, "hard"},
+                                 {NmsMethod::SOFT_LINEAR, "soft_linear"},
+                                 {NmsMethod::SOFT_GAUSSIAN, "soft_gaussian"},
+                             })
+
+enum class InferenceBackendType
+{
+    OPENCV_DNN = 0, // cv::dnn (CPU 또는 useCuda 시 CUDA)
+    ONNXRUNTIME     // ONNX Runtime CPU (VP_WITH_ONNXRUNTIME 빌드 필요)
+};
+
+NLOHMANN_JSON_SERIALIZE_ENUM(InferenceBackendType,
+                             {
+                                 {InferenceBackendType::OPENCV_DNN, "opencv_dnn"},
+                                 {InferenceBackendType::ONNXRUNTIME, "onnxruntime"},
+                             })
+
+enum class ModelPrecision
+{
+    FP32 = 0, // 기존 동작
+    FP16,     // OPENCV_DNN: FP16 연산 타깃 사용. ONNXRUNTIME: 모델 입출력 형식을 따름
+    INT8      // 양자화(QDQ) 모델. 입력 양자화/출력 역양자화는 어댑터가 수행
+};
+
+NLOHMANN_JSON_SERIALIZE_ENUM(ModelPrecision,
+                             {
+                                 {ModelPrecision::FP32, "fp32"},
+                                 {ModelPrecision::FP16, "fp16"},
+                                 {ModelPrecision::INT8, "int8"},
+                             })
+
+// 모델 출력 헤드 종류
+enum class YoloTask
+{
+    DETECT = 0, // [N, 4 + classes, anchors]
+    SEGMENT,    // [N, 4 + classes + numMasks, anchors] + 마스크 프로토타입 [N, numMasks, H/4, W/4]
+    POSE        // [N, 4 + classes + numKeypoints * keypointDims, anchors]
+};
+
+NLOHMANN_JSON_SERIALIZE_ENUM(YoloTask,
+                             {
+                                 {YoloTask::DETECT, "detect"},
+                                 {YoloTask::SEGMENT, "segment"},
+                                 {YoloTask::POSE, "pose"},
+                             })
+
+// 타일 분할 영역 (프레임 크기 대비 비율 좌표)
+struct TileRegion
+{
+    float left = 0.0f;
+    float top = 0.0f;
+    float right = 1.0f;
+    float bottom = 1.0f;
+    int tileSize = 640; // 원본 px 기준 타일 한 변. 작을수록 촘촘하게 나뉘고 작은 객체가 더 크게 보임
+};
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(TileRegion,
+                                                left,
+                                                top,
+                                                right,
+                                                bottom,
+                                                tileSize)
+
+// 고해상도 프레임을 겹치는 타일로 나누어 추론 (원거리 소형 객체용). DetectionLevel::FULL 에서만 사용
+struct TilingConfig
+{
+    bool enable = false;
+    float overlap = 0.2f;            // 이웃 타일 겹침 비율 (0.0 ~ 0.5)
+    bool fullFrame = true;           // 전체 프레임 추론도 함께 수행 (타일 경계에 걸친 큰 객체용)
+    std::vector<TileRegion> regions; // 비어 있으면 프레임 전체를 640 타일로 분할
+};
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(TilingConfig,
+                                                enable,
+                                                overlap,
+                                                fullFrame,
+                                                regions)
+
+// 클래스별 신뢰도 기준 (confThreshold 대신 사용)
+struct ClassThreshold
+{
+    int classId = 0; // COCO 클래스 ID (domain::model::ClassId)
+    float threshold = 0.25f;
+};
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(ClassThreshold,
+                                                classId,
+                                                threshold)
+
 struct YoloConfig
 {
     std::string modelPath;
+    YoloTask task = YoloTask::DETECT;
+    int numMasks = 32;          // SEGMENT: 마스크 계수/프로토타입 수
+    float maskThreshold = 0.5f; // SEGMENT: 마스크 픽셀 기준 (sigmoid 값)
+    int numKeypoints = 17;      // POSE: 키포인트 수
+    int keypointDims = 3;       // POSE: 키포인트당 값 수 (x, y[, visibility])
     float confThreshold = 0.25f;
+    std::vector<int> classes;                    // 탐지할 클래스 ID (비어 있으면 전체). 나머지는 디코딩 단계에서 평가하지 않음
+    std::vector<ClassThreshold> classThresholds; // 클래스별 신뢰도 기준 (없는 클래스는 confThreshold). 기준을 넘은 클래스 중 최고 점수 클래스로 탐지
     float nmsThreshold = 0.45f;
-    int inputWidth = 640;
+    bool nmsPerClass = true;   // false: 클래스와 무관하게 겹치는 박스 제거
+    NmsMethod nmsMethod = NmsMethod::HARD;
+    float softNmsSigma = 0.5f; // SOFT_GAUSSIAN 감쇠 폭
+    int nmsTopK = 1000;        // NMS 전 점수 상위 N 개만 사용 (0: 제한 없음)
+    int maxDetections = 300;   // NMS 후 최대 결과 수 (0: 제한 없음)
+    int inputWidth = 640; // 입력 텐서 크기 (stride 배수). dynamicInput 이면 최대 크기
     int inputHeight = 640;
-    bool useCuda = false; // GPU 사용 여부
+    // 동적 입력 크기 모델 (ONNX dynamic axes). 프레임 비율에 맞춘 직사각형 입력(예: 16:9 -> 640x384)으로 패딩 연산을 줄이고,
+    // 경량 모델이 없으면 REDUCED 탐지를 기본 모델의 reducedInput 크기로 실행. 모델이 거부하면 고정 크기로 돌아감
+    bool dynamicInput = false;
+    int inputStride = 32; // 모델 최대 stride (입력 크기 정렬 단위)
+    InferenceBackendType backend = InferenceBackendType::OPENCV_DNN;
+    bool useCuda = false; // GPU 사용 여부 (OPENCV_DNN)
+    int numThreads = 0;   // 추론 스레드 수 (0: 런타임 기본값). SLAM 스레드와 코어를 나눌 때 지정.
+                          // OPENCV_DNN 은 프로세스 전역 값 하나 (assembly 가 모델 중 최대값으로 한 번 설정), ONNXRUNTIME 은 모델별
+    int warmupRuns = 3;   // 초기화 시 빈 입력으로 미리 실행할 추론 횟수 (0: 워밍업 안 함)
+    ModelPrecision precision = ModelPrecision::FP32;
+    int maxBatchSize = 4; // detectObjects 한 번의 추론에 넣을 최대 이미지(타일) 수
+    int asyncQueueSize = 8; // submitDetection 대기 요청 최대 수 (가득 차면 요청이 대기). 대기 요청은 maxBatchSize 장씩 묶어 탐지
+    bool pipelineOverlap = false; // 배치가 여러 개인 탐지에서 전처리/추론/후처리를 서로 다른 배치끼리 겹쳐 실행 (스레드 2 개 추가)
+    Affinity workerAffinity; // 비동기 탐지/단계 겹침 작업 스레드 CPU 고정 (비활성화 시 assembly 가 서비스 detectionAffinity 로 채움)
+    TilingConfig tiling;
+
+    // 부하 시 사용할 경량 탐지 (DetectionLevel::REDUCED). 경로가 비어 있으면 기본 모델 사용 (dynamicInput 이면 reducedInput 크기로)
+    std::string reducedModelPath;
+    int reducedInputWidth = 320;
+    int reducedInputHeight = 320;
+
+    // (선택) 탐지 결과 캐시 파일. 같은 데이터셋을 반복 재생할 때 모델/설정/프레임 내용이 같으면 추론을 건너뜀 (영역 탐지 제외)
+    std::string cachePath;
 };
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(YoloConfig,
+                                                modelPath,
+                                                task,
+                                                numMasks,
+                                                maskThreshold,
+                                                numKeypoints,
+                                                keypointDims,
+                                                confThreshold,
+                                                classes,
+                                                classThresholds,
+                                                nmsThreshold,
+                                                nmsPerClass,
+                                                nmsMethod,
+                                                softNmsSigma,
+                                                nmsTopK,
+                                                maxDetections,
+                                                inputWidth,
+                                                inputHeight,
+                                                dynamicInput,
+                                                inputStride,
+                                                backend,
+                                                useCuda,
+                                                numThreads,
+                                                warmupRuns,
+                                                precision,
+                                                maxBatchSize,
+                                                asyncQueueSize,
+                                                pipelineOverlap,
+                                                workerAffinity,
+                                                tiling,
+                                                reducedModelPath,
+                                                reducedInputWidth,
+                                                reducedInputHeight,
+                                                cachePath)
 } // namespace vp::config
\ No newline at end of file
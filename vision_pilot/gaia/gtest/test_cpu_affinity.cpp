@@ -0,0 +1,91 @@
+#include "gaia_cpu_affinity.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+
+namespace vp
+{
+
+TEST(CpuAffinityTest, ShouldPinThreadToCpuRange)
+{
+    const auto cpus = std::thread::hardware_concurrency();
+    if (cpus < 2)
+    {
+        GTEST_SKIP() << "needs at least 2 CPUs";
+    }
+
+    std::atomic<bool> done{false};
+    std::thread worker([&]
+                       { while (!done) std::this_thread::yield(); });
+
+    Affinity affinity;
+    affinity.enable = true;
+    affinity.cpu_index = 0;
+    affinity.cpu_count = 2;
+    const bool ok = setCpuAffinity(worker, affinity);
+
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    pthread_getaffinity_np(worker.native_handle(), sizeof(cpu_set_t), &cpuset);
+    done = true;
+    worker.join();
+
+    ASSERT_TRUE(ok);
+    EXPECT_EQ(CPU_COUNT(&cpuset), 2);
+    EXPECT_TRUE(CPU_ISSET(0, &cpuset));
+    EXPECT_TRUE(CPU_ISSET(1, &cpuset));
+}
+
+TEST(CpuAffinityTest, ShouldRejectCpuIndexOutOfRange)
+{
+    std::atomic<bool> done{false};
+    std::thread worker([&]
+                       { while (!done) std::this_thread::yield(); });
+
+    Affinity affinity;
+    affinity.enable = true;
+    affinity.cpu_index = CPU_SETSIZE;
+    const bool beyond_set = setCpuAffinity(worker, affinity);
+    affinity.cpu_index = std::thread::hardware_concurrency();
+    const bool beyond_hardware = setCpuAffinity(worker, affinity);
+    done = true;
+    worker.join();
+
+    EXPECT_FALSE(beyond_set);
+    EXPECT_FALSE(beyond_hardware);
+}
+
+TEST(CpuAffinityTest, ShouldClampCpuCountToAvailableCpus)
+{
+    std::atomic<bool> done{false};
+    std::thread worker([&]
+                       { while (!done) std::this_thread::yield(); });
+
+    Affinity affinity;
+    affinity.enable = true;
+    affinity.cpu_index = 0;
+    affinity.cpu_count = CPU_SETSIZE * 2;
+    const bool ok = setCpuAffinity(worker, affinity);
+
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    pthread_getaffinity_np(worker.native_handle(), sizeof(cpu_set_t), &cpuset);
+    done = true;
+    worker.join();
+
+    ASSERT_TRUE(ok);
+    EXPECT_TRUE(CPU_ISSET(0, &cpuset));
+    EXPECT_LE(CPU_COUNT(&cpuset), static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+TEST(CpuAffinityTest, ShouldReadCpuCountFromJson)
+{
+    const auto affinity = nlohmann::json::parse(R"({"enable": true, "cpu_index": 2, "cpu_count": 4})").get<Affinity>();
+    EXPECT_TRUE(affinity.enable);
+    EXPECT_EQ(affinity.cpu_index, 2u);
+    EXPECT_EQ(affinity.cpu_count, 4u);
+
+    // 기존 설정 (cpu_count 없음) 은 코어 하나
+    EXPECT_EQ(nlohmann::json::parse(R"({"enable": true, "cpu_index": 1})").get<Affinity>().cpu_count, 1u);
+}
+
+} // namespace vp
@@ -0,0 +1,96 @@
+#include "gaia_trace.hpp"
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace
+{
+std::string readFile(const std::string &path)
+{
+    std::ifstream ifs(path);
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    return ss.str();
+}
+
+size_t countOf(const std::string &str, const std::string &token)
+{
+    size_t count = 0;
+    for (auto pos = str.find(token); pos != std::string::npos; pos = str.find(token, pos + token.size()))
+    {
+        ++count;
+    }
+    return count;
+}
+} // namespace
+
+namespace vp
+{
+
+class TraceTest : public ::testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        trace::traceDump(path_); // 다른 테스트에 영향이 없도록 기록 중지
+        std::remove(path_.c_str());
+    }
+
+    const std::string path_ = "test_trace_output.json";
+};
+
+TEST_F(TraceTest, DisabledTraceDoesNotDump)
+{
+    {
+        TRACE_SCOPE("disabled.scope");
+    }
+    ASSERT_FALSE(trace::isTraceEnabled());
+    ASSERT_FALSE(trace::traceDump(path_));
+}
+
+TEST_F(TraceTest, DumpWritesChromeTraceEvents)
+{
+    trace::traceInit(16);
+    TRACE_THREAD_NAME("main");
+    {
+        TRACE_SCOPE("outer");
+        TRACE_SCOPE("inner");
+    }
+
+    std::thread worker([]
+                       {
+        TRACE_THREAD_NAME("worker");
+        TRACE_SCOPE("worker.job"); });
+    worker.join();
+
+    ASSERT_TRUE(trace::traceDump(path_));
+    ASSERT_FALSE(trace::isTraceEnabled());
+
+    auto json = readFile(path_);
+    EXPECT_EQ(countOf(json, "\"ph\":\"X\""), 3U);
+    EXPECT_EQ(countOf(json, "\"thread_name\""), 2U);
+    EXPECT_NE(json.find("\"name\":\"outer\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"worker.job\""), std::string::npos);
+    EXPECT_NE(json.find("\"args\":{\"name\":\"worker\"}"), std::string::npos);
+
+    // 이미 덤프했으므로 재호출은 무시
+    ASSERT_FALSE(trace::traceDump(path_));
+}
+
+TEST_F(TraceTest, FullBufferDropsSpans)
+{
+    trace::traceInit(2);
+    for (int i = 0; i < 5; ++i)
+    {
+        TRACE_SCOPE("span");
+    }
+    ASSERT_TRUE(trace::traceDump(path_));
+
+    auto json = readFile(path_);
+    EXPECT_EQ(countOf(json, "\"ph\":\"X\""), 2U);
+}
+
+} // namespace vp
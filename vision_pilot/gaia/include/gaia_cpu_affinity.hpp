@@ -2,6 +2,7 @@
 
 #include "gaia_json_util.hpp"
 #include "gaia_log.hpp"
+#include <algorithm>
 #include <cstdint>
 #include <thread>
 
@@ -12,9 +13,10 @@ struct Affinity
 {
     bool enable = false;
     uint32_t cpu_index = 0;
+    uint32_t cpu_count = 1; // [cpu_index, cpu_index + cpu_count) 코어 중 하나에서 실행
 };
 
-NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(Affinity, enable, cpu_index)
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(Affinity, enable, cpu_index, cpu_count)
 
 inline bool setCpuAffinity(std::thread &thread, Affinity affinity)
 {
@@ -24,21 +26,38 @@ inline bool setCpuAffinity(std::thread &thread, Affinity affinity)
 #else
     if (affinity.enable)
     {
+        // CPU_SETSIZE 이상은 CPU_SET 범위 밖이고, 없는 코어는 pthread_setaffinity_np 가 EINVAL 로 실패
+        const uint64_t hardware = std::thread::hardware_concurrency();
+        const uint64_t limit = hardware > 0 ? std::min<uint64_t>(hardware, CPU_SETSIZE) : CPU_SETSIZE;
+        if (affinity.cpu_index >= limit)
+        {
+            LOG_ERR("Invalid CPU affinity: cpu_index {} (available CPUs: 0 ~ {})", affinity.cpu_index, limit - 1);
+            return false;
+        }
+        const uint64_t end = std::min<uint64_t>(uint64_t{affinity.cpu_index} + std::max<uint32_t>(affinity.cpu_count, 1), limit);
+        if (end - affinity.cpu_index < affinity.cpu_count)
+        {
+            LOG_WRN("CPU affinity clamped to CPU {} ~ {} (requested {} CPUs from {})", affinity.cpu_index, end - 1, affinity.cpu_count, affinity.cpu_index);
+        }
+
         cpu_set_t cpuset;
         CPU_ZERO(&cpuset);
-        CPU_SET(affinity.cpu_index, &cpuset); // NOLINT: C-API
+        for (uint64_t cpu = affinity.cpu_index; cpu < end; ++cpu)
+        {
+            CPU_SET(cpu, &cpuset); // NOLINT: C-API
+        }
 
         int rc = pthread_setaffinity_np(thread.native_handle(),
                                         sizeof(cpu_set_t), &cpuset);
         if (rc != 0)
         {
-            LOG_WRN("Error calling pthread_setaffinity_np: {}", rc);
+            LOG_ERR("Error calling pthread_setaffinity_np: {}", rc);
             return false;
         }
     }
+#endif
 
     return true;
-#endif
 }
 
 } // namespace vp
\ No newline at end of file
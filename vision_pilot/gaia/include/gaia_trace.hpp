@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>  // for atomic
+#include <cstddef> // for size_t
+#include <cstdint> // for uint64_t
+#include <string>  // for string
+
+// Chrome trace (chrome://tracing, Perfetto) 형식 스팬 기록기
+// - traceInit() 이전/traceDump() 이후에는 atomic load 1회로 끝나므로 비활성 시 비용이 거의 없다.
+// - 스레드별 고정 크기 버퍼에 기록하며, 기록 경로에는 락이 없다. 버퍼가 가득 차면 이후 스팬은 버린다.
+// - 스팬 이름은 정적 수명 문자열(문자열 리터럴)이어야 한다.
+namespace vp::trace
+{
+namespace _global
+{
+extern std::atomic<bool> enabled;
+} // namespace _global
+
+inline bool isTraceEnabled()
+{
+    return _global::enabled.load(std::memory_order_relaxed);
+}
+
+uint64_t traceNowNs();
+
+// 스레드별 버퍼 크기를 지정하고 기록을 시작한다. 이전 기록은 모두 지워진다.
+void traceInit(size_t events_per_thread = 65536);
+
+// 기록을 중단하고 Chrome trace JSON 으로 저장한다. 기록 중이 아니었다면 false
+bool traceDump(const std::string &path);
+
+// 현재 스레드 이름 (트레이스 뷰어의 트랙 이름). 기록 여부와 무관하게 호출 가능
+void traceSetThreadName(const char *name);
+
+void traceRecordSpan(const char *name, uint64_t begin_ns, uint64_t end_ns);
+
+class TraceScope
+{
+public:
+    explicit TraceScope(const char *name)
+        : name_{name}, begin_ns_{isTraceEnabled() ? traceNowNs() : 0}
+    {
+    }
+
+    ~TraceScope()
+    {
+        if (begin_ns_ != 0)
+        {
+            traceRecordSpan(name_, begin_ns_, traceNowNs());
+        }
+    }
+
+    TraceScope(const TraceScope &) = delete;
+    TraceScope &operator=(const TraceScope &) = delete;
+    TraceScope(TraceScope &&) = delete;
+    TraceScope &operator=(TraceScope &&) = delete;
+
+private:
+    const char *name_;
+    uint64_t begin_ns_;
+};
+
+} // namespace vp::trace
+
+#define VP_TRACE_CONCAT_IMPL(a, b) a##b
+#define VP_TRACE_CONCAT(a, b) VP_TRACE_CONCAT_IMPL(a, b)
+
+#define TRACE_SCOPE(name) vp::trace::TraceScope VP_TRACE_CONCAT(_vp_trace_scope_, __LINE__) { name }
+#define TRACE_THREAD_NAME(name) vp::trace::traceSetThreadName(name)
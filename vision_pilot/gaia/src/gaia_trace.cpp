@@ -0,0 +1,230 @@
+#include "gaia_trace.hpp"
+#include "gaia_log.hpp" // for LOG_INF, LOG_ERR
+#include <algorithm>    // for min
+#include <chrono>       // for steady_clock
+#include <cstdio>       // for fopen, fclose
+#include <memory>       // for shared_ptr
+#include <mutex>        // for mutex, lock_guard
+#include <vector>       // for vector
+
+namespace
+{
+struct TraceEvent
+{
+    const char *name;
+    uint64_t begin_ns;
+    uint64_t end_ns;
+};
+
+// 소유 스레드만 기록(단일 생산자), 덤프 시에는 size 를 acquire 로 읽어 기록 완료된 구간만 읽는다.
+struct ThreadBuffer
+{
+    uint32_t tid = 0;
+    std::string name;
+    std::vector<TraceEvent> events;
+    std::atomic<size_t> size{0};
+    std::atomic<uint64_t> dropped{0};
+};
+
+struct Registry
+{
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    size_t events_per_thread = 0;
+    std::atomic<uint32_t> generation{0};
+    uint32_t next_tid = 1;
+};
+
+Registry &registry()
+{
+    static Registry inst;
+    return inst;
+}
+
+struct ThreadState
+{
+    uint32_t generation = 0;
+    std::shared_ptr<ThreadBuffer> buffer;
+    std::string name;
+};
+
+ThreadState &threadState()
+{
+    thread_local ThreadState state;
+    return state;
+}
+
+ThreadBuffer *acquireBuffer()
+{
+    auto &state = threadState();
+    auto &reg = registry();
+
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    const auto generation = reg.generation.load(std::memory_order_relaxed);
+    if (state.buffer != nullptr && state.generation == generation)
+    {
+        return state.buffer.get();
+    }
+
+    auto buffer = std::make_shared<ThreadBuffer>();
+    buffer->tid = reg.next_tid++;
+    buffer->name = state.name.empty() ? "thread-" + std::to_string(buffer->tid) : state.name;
+    buffer->events.resize(reg.events_per_thread);
+    reg.buffers.push_back(buffer);
+
+    state.buffer = buffer;
+    state.generation = generation;
+    return buffer.get();
+}
+
+void writeEscaped(FILE *fp, const std::string &str)
+{
+    for (char c : str)
+    {
+        if (c == '"' || c == '\\')
+        {
+            fputc('\\', fp);
+        }
+        fputc(c, fp);
+    }
+}
+} // namespace
+
+namespace vp::trace
+{
+namespace _global
+{
+std::atomic<bool> enabled{false};
+} // namespace _global
+
+uint64_t traceNowNs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+void traceInit(size_t events_per_thread)
+{
+    auto &reg = registry();
+    {
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.buffers.clear();
+        reg.events_per_thread = events_per_thread;
+        reg.generation.fetch_add(1, std::memory_order_relaxed);
+        reg.next_tid = 1;
+    }
+    _global::enabled.store(true, std::memory_order_release);
+    LOG_INF("Trace recording started ({} events per thread).", events_per_thread);
+}
+
+bool traceDump(const std::string &path)
+{
+    if (!_global::enabled.exchange(false, std::memory_order_acq_rel))
+    {
+        return false;
+    }
+
+    auto &reg = registry();
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    std::vector<std::string> names;
+    {
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        buffers = reg.buffers;
+        for (const auto &buffer : buffers)
+        {
+            names.push_back(buffer->name);
+        }
+    }
+
+    FILE *fp = fopen(path.c_str(), "w"); // NOLINT(cppcoreguidelines-owning-memory)
+    if (fp == nullptr)
+    {
+        LOG_ERR("Failed to open trace output file: {}", path);
+        return false;
+    }
+
+    // 가장 이른 스팬을 0 으로 맞춰 뷰어에서 보기 쉽게 한다
+    uint64_t origin_ns = UINT64_MAX;
+    for (const auto &buffer : buffers)
+    {
+        const auto count = buffer->size.load(std::memory_order_acquire);
+        for (size_t i = 0; i < count; ++i)
+        {
+            origin_ns = std::min(origin_ns, buffer->events[i].begin_ns);
+        }
+    }
+
+    size_t total = 0;
+    uint64_t dropped = 0;
+    bool first = true;
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", fp);
+    for (size_t b = 0; b < buffers.size(); ++b)
+    {
+        const auto &buffer = buffers[b];
+        fmt::print(fp, "{}{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":\"", first ? "" : ",\n", buffer->tid);
+        writeEscaped(fp, names[b]);
+        fputs("\"}}", fp);
+        first = false;
+
+        const auto count = buffer->size.load(std::memory_order_acquire);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto &event = buffer->events[i];
+            fputs(",\n{\"name\":\"", fp);
+            writeEscaped(fp, event.name);
+            fmt::print(fp, "\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+                       buffer->tid,
+                       static_cast<double>(event.begin_ns - origin_ns) / 1000.0,
+                       static_cast<double>(event.end_ns - event.begin_ns) / 1000.0);
+        }
+        total += count;
+        dropped += buffer->dropped.load(std::memory_order_relaxed);
+    }
+    fputs("\n]}\n", fp);
+    fclose(fp);
+
+    LOG_INF("Trace saved to {} ({} spans, {} threads, {} dropped).", path, total, buffers.size(), dropped);
+    return true;
+}
+
+void traceSetThreadName(const char *name)
+{
+    auto &state = threadState();
+    state.name = name;
+
+    auto &reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    if (state.buffer != nullptr && state.generation == reg.generation.load(std::memory_order_relaxed))
+    {
+        state.buffer->name = state.name;
+    }
+}
+
+void traceRecordSpan(const char *name, uint64_t begin_ns, uint64_t end_ns)
+{
+    if (!isTraceEnabled())
+    {
+        return;
+    }
+
+    auto &state = threadState();
+    auto *buffer = state.buffer.get();
+    // generation 은 traceInit 때만 바뀐다. 불일치 시에만 락을 잡고 버퍼를 새로 등록
+    if (buffer == nullptr || state.generation != registry().generation.load(std::memory_order_relaxed))
+    {
+        buffer = acquireBuffer();
+    }
+
+    const auto index = buffer->size.load(std::memory_order_relaxed);
+    if (index >= buffer->events.size())
+    {
+        buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    buffer->events[index] = TraceEvent{name, begin_ns, end_ns};
+    buffer->size.store(index + 1, std::memory_order_release);
+}
+
+} // namespace vp::trace
@@ -0,0 +1,81 @@
+#include "event_queue.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace vp::infrastructure::event
+{
+namespace
+{
+domain::model::Event makeEvent(uint64_t timestamp)
+{
+    return domain::model::Event{domain::model::EventType::IMAGE, std::monostate{}, timestamp};
+}
+} // namespace
+
+TEST(EventQueueTest, DropOldestWhenFull)
+{
+    EventQueue queue{2};
+    ASSERT_TRUE(queue.push(makeEvent(1)));
+    ASSERT_TRUE(queue.push(makeEvent(2)));
+    ASSERT_TRUE(queue.push(makeEvent(3)));
+
+    EXPECT_EQ(queue.droppedCount(), 1U);
+    EXPECT_EQ(queue.pop().timestamp, 2U);
+    EXPECT_EQ(queue.pop().timestamp, 3U);
+}
+
+TEST(EventQueueTest, BlockPolicyKeepsEveryEvent)
+{
+    constexpr uint64_t kCount = 100;
+    EventQueue queue{2, OverflowPolicy::BLOCK};
+
+    std::thread producer([&queue]
+                         {
+        for (uint64_t i = 1; i <= kCount; ++i)
+        {
+            queue.push(makeEvent(i));
+        }
+        queue.close(); });
+
+    uint64_t expected = 1;
+    domain::model::Event evt;
+    while (!queue.isDrained())
+    {
+        if (queue.popFor(evt, std::chrono::milliseconds(100)))
+        {
+            EXPECT_EQ(evt.timestamp, expected++);
+        }
+    }
+    producer.join();
+
+    EXPECT_EQ(expected, kCount + 1);
+    EXPECT_EQ(queue.droppedCount(), 0U);
+}
+
+TEST(EventQueueTest, CloseReleasesBlockedProducer)
+{
+    EventQueue queue{1, OverflowPolicy::BLOCK};
+    ASSERT_TRUE(queue.push(makeEvent(1)));
+
+    std::atomic<bool> pushed{true};
+    std::thread producer([&]
+                         { pushed = queue.push(makeEvent(2)); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    queue.close();
+    producer.join();
+
+    EXPECT_FALSE(pushed);
+    EXPECT_FALSE(queue.isDrained());
+    EXPECT_EQ(queue.pop().timestamp, 1U);
+    EXPECT_TRUE(queue.isDrained());
+}
+
+TEST(EventQueueTest, PopForTimesOutOnEmptyQueue)
+{
+    EventQueue queue;
+    domain::model::Event evt;
+    EXPECT_FALSE(queue.popFor(evt, std::chrono::milliseconds(1)));
+}
+} // namespace vp::infrastructure::event
@@ -1,6 +1,7 @@
 // infrastructure/event/include/event_queue.hpp
 #pragma once
 #include "event.hpp" // domain/model/event.hpp 전제
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
 #include <queue>
@@ -8,21 +9,42 @@
 namespace vp::infrastructure::event
 {
 
+// 큐가 가득 찼을 때의 동작
+enum class OverflowPolicy
+{
+    DROP_OLDEST = 0, // 가장 오래된 이벤트를 버림 (실시간 처리)
+    BLOCK            // 자리가 날 때까지 생산자 대기 (배치 처리, 유실 없음)
+};
+
 class EventQueue
 {
 public:
-    explicit EventQueue(size_t max_size = 10) : max_size_(max_size) {}
+    explicit EventQueue(size_t max_size = 10, OverflowPolicy policy = OverflowPolicy::DROP_OLDEST)
+        : max_size_(max_size), policy_(policy) {}
 
-    void push(domain::model::Event event)
+    // close() 이후에는 push 하지 않고 false 반환
+    bool push(domain::model::Event event)
     {
         std::unique_lock<std::mutex> lock(mutex_);
+        if (policy_ == OverflowPolicy::BLOCK)
+        {
+            not_full_cv_.wait(lock, [this]
+                              { return closed_ || queue_.size() < max_size_; });
+        }
+        if (closed_)
+        {
+            return false;
+        }
+
         // 큐가 가득 찼을 경우 가장 오래된 데이터를 버림 (자율주행 실시간성 유지)
         if (queue_.size() >= max_size_)
         {
             queue_.pop();
+            ++dropped_count_;
         }
         queue_.push(std::move(event));
         cv_.notify_one();
+        return true;
     }
 
     domain::model::Event pop()
@@ -33,20 +55,66 @@ public:
 
         domain::model::Event event = std::move(queue_.front());
         queue_.pop();
+        not_full_cv_.notify_one();
         return event;
     }
 
+    // timeout 동안 이벤트가 없거나 close() 된 빈 큐이면 false
+    bool popFor(domain::model::Event &event, std::chrono::milliseconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!cv_.wait_for(lock, timeout, [this]
+                          { return closed_ || !queue_.empty(); }) ||
+            queue_.empty())
+        {
+            return false;
+        }
+
+        event = std::move(queue_.front());
+        queue_.pop();
+        not_full_cv_.notify_one();
+        return true;
+    }
+
+    // 대기 중인 생산자/소비자를 깨우고 이후 push 를 거부. 남은 이벤트는 계속 pop 가능
+    void close()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+        }
+        cv_.notify_all();
+        not_full_cv_.notify_all();
+    }
+
     bool empty() const
     {
         std::lock_guard<std::mutex> lock(mutex_);
         return queue_.empty();
     }
 
+    // close() 되었고 남은 이벤트가 없음
+    bool isDrained() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return closed_ && queue_.empty();
+    }
+
+    size_t droppedCount() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return dropped_count_;
+    }
+
 private:
     std::queue<domain::model::Event> queue_;
     mutable std::mutex mutex_;
     std::condition_variable cv_;
+    std::condition_variable not_full_cv_;
     size_t max_size_;
+    OverflowPolicy policy_;
+    bool closed_ = false;
+    size_t dropped_count_ = 0;
 };
 
-} // namespace vp::infrastructure::event
\ No newline at end of file
+} // namespace vp::infrastructure::event
@@ -19,6 +19,9 @@ public:
     void start();
     void stop();
 
+    // 배치 처리 시 close() 된 큐를 모두 소진하면 스스로 종료하여 false
+    bool isRunning() const;
+
 private:
     void run();
 
@@ -1,9 +1,15 @@
 // infrastructure/event/src/event_router.cpp
 #include "event_router.hpp"
 #include "gaia_log.hpp"
+#include "gaia_trace.hpp"
 #include <exception>
 #include <variant>
 
+namespace
+{
+constexpr std::chrono::milliseconds kPopTimeout{100};
+} // namespace
+
 namespace vp::infrastructure::event
 {
 
@@ -30,6 +36,11 @@ void EventRouter::start()
     }
 }
 
+bool EventRouter::isRunning() const
+{
+    return running_;
+}
+
 void EventRouter::stop()
 {
     LOG_INF("Stopping EventRouter...");
@@ -43,16 +54,23 @@ void EventRouter::stop()
 void EventRouter::run()
 {
     LOG_TRA("EventRouter run loop started.");
+    TRACE_THREAD_NAME("router");
+
     while (running_)
     {
-        // 큐에서 이벤트 하나 꺼내기 (데이터가 올 때까지 blocking)
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-
-        if (queue_.empty())
+        // 큐에서 이벤트 하나 꺼내기. stop() 확인을 위해 주기적으로 깨어남
+        domain::model::Event evt;
+        if (!queue_.popFor(evt, kPopTimeout))
         {
+            if (queue_.isDrained())
+            {
+                // close() 된 큐를 모두 소진 (배치 처리 종료)
+                LOG_INF("Event queue drained. EventRouter finished.");
+                running_ = false;
+            }
             continue;
         }
-        domain::model::Event evt = queue_.pop();
+        TRACE_SCOPE("router.dispatch");
 
         try
         {
@@ -61,8 +79,9 @@ void EventRouter::run()
             case domain::model::EventType::IMAGE:
             {
                 auto *packet = std::get_if<domain::model::ImageEventPayload>(&evt.data);
-                if (packet != nullptr)
+                if (packet != nullptr && *packet != nullptr)
                 {
+                    (*packet)->trace.mark(domain::model::TracePoint::DEQUEUED);
                     image_port_.onFrameReceived(**packet);
                 }
                 break;
@@ -1,7 +1,11 @@
 #include "assembly.hpp"
 #include "config_loader.hpp"
 #include "gaia_log.hpp"
+#include <atomic>
+#include <chrono>
+#include <csignal>
 #include <iostream>
+#include <thread>
 
 namespace
 {
@@ -30,6 +34,7 @@ void printUsage(const std::string &program_name)
         << "  -c <config_path>   Path to config file (default: etc/obu.conf)\n"
         << "  -h                 Show this help\n"
         << "  LOG_LEVEL            [trace|debug|info|warning|error|critical|off] Set the log level\n"
+        << "  SIGHUP             Reload detection models from the config file without restarting\n"
         << "example: " << program_name << " -c vision_pilot/res/etc/assembly_config.json info\n";
 }
 
@@ -102,12 +107,19 @@ bool parseArgs(const std::vector<std::string> &args,
 } // namespace
 
 std::atomic<bool> g_running{false};
+std::atomic<bool> g_reload{false};
 
 void signalHandler([[maybe_unused]] int signum)
 {
     g_running.store(false, std::memory_order_release);
 }
 
+// SIGHUP: 설정 파일을 다시 읽어 탐지 모델만 교체 (VSLAM 맵과 추적 상태 유지)
+void reloadHandler([[maybe_unused]] int signum)
+{
+    g_reload.store(true, std::memory_order_release);
+}
+
 int main(int argc, char **argv)
 {
     CliOptions options{};
@@ -129,9 +141,8 @@ int main(int argc, char **argv)
     vp::logger::logInitFromMain(argc, argv);
 
     vp::config::ConfigLoader configLoader;
-    auto loaded = configLoader.loadConfig(options.config_path.empty()
-                                              ? "vision_pilot/res/etc/assembly_config.json"
-                                              : options.config_path);
+    const std::string config_path = options.config_path.empty() ? "vision_pilot/res/etc/assembly_config.json" : options.config_path;
+    auto loaded = configLoader.loadConfig(config_path);
 
     if (!loaded || !configLoader.isLoaded())
     {
@@ -140,7 +151,36 @@ int main(int argc, char **argv)
     }
 
     vp::assembly::Assembly assembly(configLoader.getAssemblyConfig());
-    assembly.startService();
+
+    g_running.store(true, std::memory_order_release);
+    std::signal(SIGINT, signalHandler);
+    std::signal(SIGTERM, signalHandler);
+    std::signal(SIGHUP, reloadHandler);
+
+    if (!assembly.startService())
+    {
+        std::cerr << "Failed to start VisionPilot service.\n";
+        return 1;
+    }
+
+    // 종료 시그널 또는 배치 처리 완료까지 대기
+    while (g_running.load(std::memory_order_acquire) && !assembly.isFinished())
+    {
+        if (g_reload.exchange(false, std::memory_order_acq_rel))
+        {
+            vp::config::ConfigLoader reloadLoader;
+            if (reloadLoader.loadConfig(config_path) && reloadLoader.isLoaded())
+            {
+                assembly.reloadDetectionModels(reloadLoader.getAssemblyConfig());
+            }
+            else
+            {
+                std::cerr << "Failed to reload configuration: " << config_path << "\n";
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    assembly.stopService();
 
     return 0;
 }
\ No newline at end of file